@@ -0,0 +1,378 @@
+#include <benchmark/benchmark.h>
+#include <prrng.h>
+#include <xtensor/xtensor.hpp>
+
+// Use fixed seeds: the state should not be a source of variation between runs.
+#define SEED 42
+
+using Data1 = xt::xtensor<double, 1>;
+using Data2 = xt::xtensor<double, 2>;
+using Data3 = xt::xtensor<double, 3>;
+using Index1 = xt::xtensor<ptrdiff_t, 1>;
+using Index2 = xt::xtensor<ptrdiff_t, 2>;
+
+// pcg32: raw output
+
+static void pcg32_operator(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gen());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(pcg32_operator);
+
+static void pcg32_next_double(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gen.next_double());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(pcg32_next_double);
+
+static void pcg32_advance(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    int64_t distance = state.range(0);
+    for (auto _ : state) {
+        gen.advance(distance);
+        benchmark::DoNotOptimize(gen.state());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(pcg32_advance)->RangeMultiplier(1000)->Range(1, 1000000000);
+
+static void pcg32_distance(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    prrng::pcg32 other(SEED);
+    other.advance(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(other.distance(gen));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(pcg32_distance)->RangeMultiplier(1000)->Range(1, 1000000000);
+
+// philox: raw output and random access
+
+static void philox_operator(benchmark::State& state)
+{
+    prrng::philox gen(SEED);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gen());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(philox_operator);
+
+static void philox_advance(benchmark::State& state)
+{
+    prrng::philox gen(SEED);
+    int64_t distance = state.range(0);
+    for (auto _ : state) {
+        gen.advance(distance);
+        benchmark::DoNotOptimize(gen());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(philox_advance)->RangeMultiplier(1000)->Range(1, 1000000000);
+
+// pcg32: distributions (scalar draws)
+
+#define PRRNG_BENCHMARK_SCALAR(name, call) \
+    static void pcg32_##name(benchmark::State& state) \
+    { \
+        prrng::pcg32 gen(SEED); \
+        for (auto _ : state) { \
+            benchmark::DoNotOptimize(gen.call); \
+        } \
+        state.SetItemsProcessed(state.iterations()); \
+    } \
+    BENCHMARK(pcg32_##name)
+
+PRRNG_BENCHMARK_SCALAR(random, random());
+PRRNG_BENCHMARK_SCALAR(randint, randint(1000));
+PRRNG_BENCHMARK_SCALAR(fast_randint, fast_randint(1000));
+PRRNG_BENCHMARK_SCALAR(delta, delta(1.0));
+PRRNG_BENCHMARK_SCALAR(exponential, exponential(1.0));
+PRRNG_BENCHMARK_SCALAR(power, power(2.0));
+PRRNG_BENCHMARK_SCALAR(gamma, gamma(2.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(pareto, pareto(2.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(weibull, weibull(2.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(normal, normal(0.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(fast_normal, fast_normal(0.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(fast_exponential, fast_exponential(1.0));
+PRRNG_BENCHMARK_SCALAR(fast_gamma, fast_gamma(2.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(fast_power, fast_power(2.0));
+PRRNG_BENCHMARK_SCALAR(fast_pareto, fast_pareto(2.0, 1.0));
+PRRNG_BENCHMARK_SCALAR(fast_weibull, fast_weibull(2.0, 1.0));
+
+// pcg32: distributions (list of draws)
+
+#define PRRNG_BENCHMARK_LIST(name, call) \
+    static void pcg32_list_##name(benchmark::State& state) \
+    { \
+        prrng::pcg32 gen(SEED); \
+        std::array<size_t, 1> shape = {static_cast<size_t>(state.range(0))}; \
+        for (auto _ : state) { \
+            benchmark::DoNotOptimize(gen.call); \
+        } \
+        state.SetItemsProcessed(state.iterations() * state.range(0)); \
+    } \
+    BENCHMARK(pcg32_list_##name)->RangeMultiplier(100)->Range(100, 100000)
+
+PRRNG_BENCHMARK_LIST(random, random(shape));
+PRRNG_BENCHMARK_LIST(randint, randint(shape, 1000));
+PRRNG_BENCHMARK_LIST(fast_randint, fast_randint(shape, 1000));
+PRRNG_BENCHMARK_LIST(exponential, exponential(shape, 1.0));
+PRRNG_BENCHMARK_LIST(gamma, gamma(shape, 2.0, 1.0));
+PRRNG_BENCHMARK_LIST(weibull, weibull(shape, 2.0, 1.0));
+PRRNG_BENCHMARK_LIST(fast_weibull, fast_weibull(shape, 2.0, 1.0));
+PRRNG_BENCHMARK_LIST(normal, normal(shape, 0.0, 1.0));
+
+// pcg32: distribution with arithmetic, evaluated directly in the output or via temporaries
+
+static void pcg32_list_exponential_affine(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    std::array<size_t, 1> shape = {static_cast<size_t>(state.range(0))};
+    Data1 out = xt::empty<double>(shape);
+    for (auto _ : state) {
+        xt::noalias(out) = 2.0 * gen.exponential(shape, 1.0) + 1.0;
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(pcg32_list_exponential_affine)->RangeMultiplier(100)->Range(100, 100000);
+
+static void pcg32_list_lazy_exponential_affine(benchmark::State& state)
+{
+    prrng::pcg32 gen(SEED);
+    std::array<size_t, 1> shape = {static_cast<size_t>(state.range(0))};
+    Data1 out = xt::empty<double>(shape);
+    for (auto _ : state) {
+        xt::noalias(out) = 2.0 * gen.lazy_exponential(shape, 1.0) + 1.0;
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(pcg32_list_lazy_exponential_affine)->RangeMultiplier(100)->Range(100, 100000);
+
+// pcg32_array: one draw per generator
+
+#define PRRNG_BENCHMARK_ARRAY(name, call) \
+    static void pcg32_array_##name(benchmark::State& state) \
+    { \
+        size_t n = static_cast<size_t>(state.range(0)); \
+        xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(n); \
+        prrng::pcg32_array gen(seed); \
+        std::array<size_t, 1> shape = {1}; \
+        for (auto _ : state) { \
+            benchmark::DoNotOptimize(gen.call); \
+        } \
+        state.SetItemsProcessed(state.iterations() * state.range(0)); \
+    } \
+    BENCHMARK(pcg32_array_##name)->RangeMultiplier(100)->Range(1, 1000000)
+
+PRRNG_BENCHMARK_ARRAY(random, random(shape));
+PRRNG_BENCHMARK_ARRAY(randint, randint(shape, 1000));
+PRRNG_BENCHMARK_ARRAY(fast_randint, fast_randint(shape, 1000));
+PRRNG_BENCHMARK_ARRAY(exponential, exponential(shape, 1.0));
+PRRNG_BENCHMARK_ARRAY(weibull, weibull(shape, 2.0, 1.0));
+PRRNG_BENCHMARK_ARRAY(fast_weibull, fast_weibull(shape, 2.0, 1.0));
+PRRNG_BENCHMARK_ARRAY(normal, normal(shape, 0.0, 1.0));
+
+// pcg32_array: one decision per generator (bool, bit-packed, indices of accepted generators)
+
+#define PRRNG_BENCHMARK_DECIDE(name) \
+    static void pcg32_array_##name(benchmark::State& state) \
+    { \
+        size_t n = static_cast<size_t>(state.range(0)); \
+        xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(n); \
+        prrng::pcg32_array gen(seed); \
+        xt::xtensor<double, 1> p = gen.random({}); \
+        for (auto _ : state) { \
+            benchmark::DoNotOptimize(gen.name(p).data()); \
+        } \
+        state.SetItemsProcessed(state.iterations() * state.range(0)); \
+    } \
+    BENCHMARK(pcg32_array_##name)->RangeMultiplier(100)->Range(1, 1000000)
+
+PRRNG_BENCHMARK_DECIDE(decide);
+PRRNG_BENCHMARK_DECIDE(decide_packed);
+PRRNG_BENCHMARK_DECIDE(decide_indices);
+
+static void pcg32_array_advance(benchmark::State& state)
+{
+    size_t n = static_cast<size_t>(state.range(0));
+    xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(n);
+    prrng::pcg32_array gen(seed);
+    xt::xtensor<int64_t, 1> distance = 1000 * xt::ones<int64_t>({n});
+    for (auto _ : state) {
+        gen.advance(distance);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(pcg32_array_advance)->RangeMultiplier(100)->Range(1, 1000000);
+
+// Combinations of (number of generators, chunk size, step per call) for the array of chunks,
+// limiting the total size of the chunks to 10^7.
+static void array_cumsum_args(benchmark::internal::Benchmark* b)
+{
+    for (int64_t ngen : {1, 1000, 100000}) {
+        for (int64_t n : {100, 10000}) {
+            if (ngen * n > 10000000) {
+                continue;
+            }
+            for (int64_t step : {1, 3, 100000}) {
+                b->Args({ngen, n, step});
+            }
+        }
+    }
+}
+
+// pcg32_cumsum: align with a target that moves by a fixed number of entries per call
+// ("near": within the chunk; "far": a multiple of the chunk size),
+// with the distribution selected at runtime ("custom") or at compile time
+
+template <prrng::distribution D>
+static void pcg32_cumsum_align(benchmark::State& state)
+{
+    size_t n = static_cast<size_t>(state.range(0));
+    double step = static_cast<double>(state.range(1));
+    prrng::alignment align(0, 10, 0, false);
+    std::array<size_t, 1> shape = {n};
+    prrng::pcg32_cumsum<Data1, D> chunk(shape, SEED, 0, prrng::exponential, {1.0}, align);
+    double target = 0.0;
+    for (auto _ : state) {
+        target += step;
+        chunk.align(target);
+        benchmark::DoNotOptimize(chunk.chunk_index_at_align());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(pcg32_cumsum_align, prrng::custom)
+    ->ArgsProduct({{100, 10000, 100000}, {1, 3, 100000}});
+BENCHMARK_TEMPLATE(pcg32_cumsum_align, prrng::exponential)
+    ->ArgsProduct({{100, 10000, 100000}, {1, 3, 100000}});
+
+// pcg32_cumsum: as above, with the next chunk prefetched on a background thread
+
+static void pcg32_cumsum_align_prefetch(benchmark::State& state)
+{
+    size_t n = static_cast<size_t>(state.range(0));
+    double step = static_cast<double>(state.range(1));
+    prrng::alignment align(0, 10, 0, false);
+    std::array<size_t, 1> shape = {n};
+    prrng::pcg32_cumsum<Data1> chunk(shape, SEED, 0, prrng::exponential, {1.0}, align);
+    chunk.set_prefetch(true);
+    double target = 0.0;
+    for (auto _ : state) {
+        target += step;
+        chunk.align(target);
+        benchmark::DoNotOptimize(chunk.chunk_index_at_align());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(pcg32_cumsum_align_prefetch)->ArgsProduct({{10000, 100000}, {3, 100000}});
+
+static void pcg32_array_cumsum_align(benchmark::State& state)
+{
+    size_t ngen = static_cast<size_t>(state.range(0));
+    size_t n = static_cast<size_t>(state.range(1));
+    double step = static_cast<double>(state.range(2));
+    xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(ngen);
+    xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>({ngen});
+    prrng::alignment align(0, 10, 0, false);
+    std::array<size_t, 1> shape = {n};
+    prrng::pcg32_array_cumsum<Data2, Index1> chunk(
+        shape, seed, seq, prrng::exponential, {1.0}, align
+    );
+    Data1 target = xt::zeros<double>({ngen});
+    for (auto _ : state) {
+        target += step;
+        chunk.align(target);
+        benchmark::DoNotOptimize(chunk.chunk_index_at_align().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(pcg32_array_cumsum_align)->Apply(array_cumsum_args);
+
+static void pcg32_array_cumsum_align_at(benchmark::State& state)
+{
+    size_t ngen = static_cast<size_t>(state.range(0));
+    size_t n = static_cast<size_t>(state.range(1));
+    ptrdiff_t step = static_cast<ptrdiff_t>(state.range(2));
+    xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(ngen);
+    xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>({ngen});
+    prrng::alignment align(0, 10, 0, false);
+    std::array<size_t, 1> shape = {n};
+    prrng::pcg32_array_cumsum<Data2, Index1> chunk(
+        shape, seed, seq, prrng::exponential, {1.0}, align
+    );
+    Index1 index = xt::zeros<ptrdiff_t>({ngen});
+    for (auto _ : state) {
+        index += step;
+        chunk.align_at(index);
+        benchmark::DoNotOptimize(chunk.start().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(pcg32_array_cumsum_align_at)->Apply(array_cumsum_args);
+
+// several quantities per generator: separate arrays versus one array with interleaved channels
+// (with a fixed number of iterations: the targets of the channels drift apart as they increase)
+
+static void pcg32_array_cumsum_align_channels(benchmark::State& state)
+{
+    size_t ngen = static_cast<size_t>(state.range(0));
+    size_t channels = static_cast<size_t>(state.range(1));
+    double step = static_cast<double>(state.range(2));
+    prrng::alignment align(0, 10, 0, false);
+    std::array<size_t, 1> shape = {10000};
+    std::vector<prrng::pcg32_array_cumsum<Data2, Index1>> chunks;
+    for (size_t c = 0; c < channels; ++c) {
+        xt::xtensor<uint64_t, 1> seed = SEED + c * ngen + xt::arange<uint64_t>(ngen);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>({ngen});
+        chunks.emplace_back(shape, seed, seq, prrng::exponential, std::vector<double>{1.0}, align);
+    }
+    Data1 target = xt::zeros<double>({ngen});
+    for (auto _ : state) {
+        target += step;
+        for (auto& chunk : chunks) {
+            chunk.align(target);
+            benchmark::DoNotOptimize(chunk.chunk_index_at_align().data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(pcg32_array_cumsum_align_channels)
+    ->ArgsProduct({{10, 100}, {4}, {1, 3}})
+    ->Iterations(10000);
+
+static void pcg32_array_multi_cumsum_align(benchmark::State& state)
+{
+    size_t ngen = static_cast<size_t>(state.range(0));
+    size_t channels = static_cast<size_t>(state.range(1));
+    double step = static_cast<double>(state.range(2));
+    xt::xtensor<uint64_t, 1> seed = SEED + xt::arange<uint64_t>(ngen);
+    xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>({ngen});
+    prrng::alignment align(0, 10, 0, false);
+    prrng::pcg32_array_multi_cumsum<Data3, Index2> chunk(
+        10000, channels, seed, seq, prrng::exponential, {1.0}, align
+    );
+    Data2 target = xt::zeros<double>({ngen, channels});
+    for (auto _ : state) {
+        target += step;
+        chunk.align(target);
+        benchmark::DoNotOptimize(chunk.chunk_index_at_align().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(pcg32_array_multi_cumsum_align)
+    ->ArgsProduct({{10, 100}, {4}, {1, 3}})
+    ->Iterations(10000);
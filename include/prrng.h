@@ -38,8 +38,62 @@
  */
 #define PRRNG_PCG32_MULT 6364136223846793005ULL
 
+#ifndef PRRNG_PCG32_LANES
+/**
+ * Number of pcg32() generators that are advanced in lock-step when an array of generators
+ * draws a list of random numbers per generator (e.g. prrng::pcg32_array::random()).
+ * The lock-step loop has no dependency between lanes, such that it can be auto-vectorised by
+ * the compiler (e.g. when linking to `xtensor::optimize`, as is done using `USE_SIMD`).
+ * The output is bit-identical to drawing from each generator in turn.
+ *
+ *     #define PRRNG_PCG32_LANES 16
+ *     #include <prrng.h>
+ */
+#define PRRNG_PCG32_LANES 8
+#endif
+
+#ifndef PRRNG_USE_OPENMP
+/**
+ * Split the loops over the (independent) generators of an array of generators over threads
+ * using OpenMP: prrng::pcg32_arrayBase (e.g. prrng::pcg32_array::random()),
+ * prrng::pcg32_soa_arrayBase, and the arrays of chunks (e.g. prrng::pcg32_array_cumsum::align()).
+ * This requires compiling with OpenMP support (e.g. by linking to `prrng::openmp`).
+ * Each generator is only ever used by one thread,
+ * such that the output is identical to the serial output (for any number of threads).
+ *
+ *     #define PRRNG_USE_OPENMP 1
+ *     #include <prrng.h>
+ *
+ * The loops have unsigned indices, which requires OpenMP 3.0 or newer:
+ * with older OpenMP (e.g. the default OpenMP 2.0 of MSVC) the loops are run serially.
+ *
+ * @warning Exceptions cannot leave a parallel region: a failing assertion (#PRRNG_ENABLE_ASSERT)
+ * in a parallel loop terminates the program.
+ * A custom distribution, see prrng::pcg32_cumsum::set_functions(), must be thread-safe.
+ */
+#define PRRNG_USE_OPENMP 0
+#endif
+
+#ifndef PRRNG_PARALLEL_THRESHOLD
+/**
+ * Minimal amount of work (roughly: the number of random numbers that are drawn or copied)
+ * for a loop to be split over threads if #PRRNG_USE_OPENMP is set.
+ * Smaller loops are run serially, as starting the threads would cost more than it saves.
+ * The output does not depend on this value.
+ *
+ *     #define PRRNG_PARALLEL_THRESHOLD 100000
+ *     #include <prrng.h>
+ */
+#define PRRNG_PARALLEL_THRESHOLD 4096
+#endif
+
 #include <array>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <memory>
 #include <xtensor/xarray.hpp>
+#include <xtensor/xgenerator.hpp>
 #include <xtensor/xnoalias.hpp>
 #include <xtensor/xtensor.hpp>
 
@@ -78,6 +132,19 @@
     std::cout << std::string(file) + ":" + std::to_string(line) + " (" + std::string(function) + \
                      ")" + ": " message ") \n\t";
 
+// unsigned loop indices require OpenMP 3.0 (_OPENMP >= 200805)
+#if PRRNG_USE_OPENMP && defined(_OPENMP) && _OPENMP >= 200805
+#if defined(_MSC_VER)
+#define PRRNG_PARALLEL_FOR(work) \
+    __pragma(omp parallel for schedule(static) if ((work) >= PRRNG_PARALLEL_THRESHOLD))
+#else
+#define PRRNG_PARALLEL_FOR(work) \
+    _Pragma(PRRNG_QUOTE(omp parallel for schedule(static) if ((work) >= PRRNG_PARALLEL_THRESHOLD)))
+#endif
+#else
+#define PRRNG_PARALLEL_FOR(work)
+#endif
+
 /**
  * \endcond
  */
@@ -152,6 +219,28 @@
 #define PRRNG_DEBUG(expr)
 #endif
 
+/**
+ * All statistics of the moves of chunks (see prrng::chunk_statistics) are collected as:
+ *
+ *     PRRNG_STATISTICS(stats, counter += value)
+ *
+ * (with `stats` a pointer to prrng::chunk_statistics, that is skipped if it is `nullptr`).
+ * They can be enabled by:
+ *
+ *     #define PRRNG_ENABLE_STATISTICS
+ *
+ * (before including prrng).
+ * Otherwise the statistics are not collected (and are always zero), at no cost.
+ */
+#ifdef PRRNG_ENABLE_STATISTICS
+#define PRRNG_STATISTICS(stats, expr) \
+    if ((stats) != nullptr) { \
+        (stats)->expr; \
+    }
+#else
+#define PRRNG_STATISTICS(stats, expr)
+#endif
+
 /**
  * Warnings are implemented as:
  *
@@ -199,6 +288,12 @@ enum distribution {
     pareto, ///< pareto
     weibull, ///< weibull
     normal, ///< normal
+    fast_normal, ///< normal (Ziggurat method)
+    fast_exponential, ///< exponential (Ziggurat method)
+    fast_gamma, ///< gamma (Marsaglia-Tsang method)
+    fast_power, ///< power (tabulated quantile)
+    fast_pareto, ///< pareto (tabulated quantile)
+    fast_weibull, ///< weibull (tabulated quantile)
     custom ///< unknown
 };
 
@@ -216,6 +311,12 @@ enum distribution {
  *      -   prrng::distribution::pareto: {k = 1, scale = 1, offset = 0}
  *      -   prrng::distribution::weibull: {k = 1, scale = 1, offset = 0}
  *      -   prrng::distribution::normal: {mu = 1, sigma = 0, offset = 0}
+ *      -   prrng::distribution::fast_normal: {mu = 1, sigma = 0, offset = 0}
+ *      -   prrng::distribution::fast_exponential: {scale = 1, offset = 0}
+ *      -   prrng::distribution::fast_gamma: {k = 1, scale = 1, offset = 0}
+ *      -   prrng::distribution::fast_power: {k = 1, offset = 0}
+ *      -   prrng::distribution::fast_pareto: {k = 1, scale = 1, offset = 0}
+ *      -   prrng::distribution::fast_weibull: {k = 1, scale = 1, offset = 0}
  *      -   prrng::distribution::custom: {}
  */
 
@@ -253,6 +354,24 @@ std::vector<double> default_parameters(
     case distribution::normal:
         ret = std::vector<double>{1, 0, 0};
         break;
+    case distribution::fast_normal:
+        ret = std::vector<double>{1, 0, 0};
+        break;
+    case distribution::fast_exponential:
+        ret = std::vector<double>{1, 0};
+        break;
+    case distribution::fast_gamma:
+        ret = std::vector<double>{1, 1, 0};
+        break;
+    case distribution::fast_power:
+        ret = std::vector<double>{1, 0};
+        break;
+    case distribution::fast_pareto:
+        ret = std::vector<double>{1, 1, 0};
+        break;
+    case distribution::fast_weibull:
+        ret = std::vector<double>{1, 1, 0};
+        break;
     case distribution::custom:
         std::vector<double>{};
         break;
@@ -290,6 +409,18 @@ bool has_correct_parameters(enum distribution distribution, const std::vector<do
         return parameters.size() == 3;
     case distribution::normal:
         return parameters.size() == 3;
+    case distribution::fast_normal:
+        return parameters.size() == 3;
+    case distribution::fast_exponential:
+        return parameters.size() == 2;
+    case distribution::fast_gamma:
+        return parameters.size() == 3;
+    case distribution::fast_power:
+        return parameters.size() == 2;
+    case distribution::fast_pareto:
+        return parameters.size() == 3;
+    case distribution::fast_weibull:
+        return parameters.size() == 3;
     case distribution::custom:
         return true;
     }
@@ -538,6 +669,27 @@ std::array<I, L> to_array(const I (&shape)[L])
     std::copy(&shape[0], &shape[0] + L, r.begin());
     return r;
 }
+
+/**
+ * Check that the data of an output array is contiguous and in row-major order,
+ * such that it can be written linearly (i.e. it is not a strided or transposed view).
+ * Throws otherwise.
+ *
+ * @param ret Output array.
+ */
+template <class R>
+inline void check_row_major(const R& ret)
+{
+    ptrdiff_t stride = 1;
+
+    for (size_t i = ret.dimension(); i-- > 0;) {
+        ptrdiff_t n = static_cast<ptrdiff_t>(ret.shape()[i]);
+        if (n > 1 && static_cast<ptrdiff_t>(ret.strides()[i]) != stride) {
+            throw std::runtime_error("[prrng] Output must be contiguous (row-major)");
+        }
+        stride *= n;
+    }
+}
 } // namespace detail
 
 /**
@@ -674,48 +826,131 @@ inline std::vector<std::string> version_compiler()
     return ret;
 }
 
+namespace detail {
+
+/**
+ * @brief Branchless binary search: first element in the range [first, first + n) such that
+ * `element < value` is `false`, or `first + n` if no such element is found.
+ * The number of iterations only depends on `n`, such that the loop is easily predicted and
+ * unrolled.
+ *
+ * @param first Iterator defining the beginning of the range to examine.
+ * @param n Size of the range to examine.
+ * @param value Value to find.
+ * @return Iterator.
+ */
+template <class It, class T>
+inline It branchless_lower_bound(It first, ptrdiff_t n, const T& value)
+{
+    if (n <= 0) {
+        return first;
+    }
+
+    while (n > 1) {
+        ptrdiff_t half = n / 2;
+        first += (*(first + half) < value) ? half : 0;
+        n -= half;
+    }
+
+    return first + static_cast<ptrdiff_t>(*first < value);
+}
+
+} // namespace detail
+
 namespace iterator {
 
 /**
  * Return index of the first element in the range [first, last) such that `element < value` is
  * `false` (i.e. greater or equal to), or last if no such element is found.
  *
- * Compared to the default function, this function allows for a guess of the index and a proximity
- * search around. This could be efficient for finding items in large arrays.
+ * Compared to `lower_bound`, the search starts from a guess of the index.
+ * The range around `guess` is doubled until it contains `value` (exponential or 'galloping'
+ * search), after which a branchless binary search is done in that range.
+ * The cost is therefore logarithmic in the distance between `guess` and the result,
+ * which is efficient if the value moves little between subsequent calls.
+ *
+ * @param first Iterator defining the beginning of the range to examine (e.g. `a.begin()`).
+ * @param last Iterator defining the end of the range to examine (e.g. `a.end()`)
+ * @param value Value to find.
+ * @param guess Guess of the index where to find the value.
+ * @return The index of `value` (i.e. `a[index] < value <= a[index + 1]`).
+ */
+template <class It, class T, class R = size_t>
+inline R gallop_lower_bound(const It first, const It last, const T& value, R guess = 0)
+{
+    ptrdiff_t n = static_cast<ptrdiff_t>(last - first);
+    ptrdiff_t g = std::min(std::max(static_cast<ptrdiff_t>(guess), ptrdiff_t(0)), n - 1);
+
+    if (n <= 1) {
+        return 0;
+    }
+
+    ptrdiff_t lo;
+    ptrdiff_t hi;
+    ptrdiff_t step = 1;
+
+    if (*(first + g) < value) {
+        // search right: result is in [lo, hi]
+        lo = g + 1;
+        hi = lo;
+        while (hi < n && *(first + hi) < value) {
+            lo = hi + 1;
+            hi = lo + step;
+            step *= 2;
+        }
+        hi = std::min(hi, n);
+    }
+    else {
+        // search left: result is in [lo, hi]
+        hi = g;
+        lo = g - 1;
+        while (lo >= 0 && !(*(first + lo) < value)) {
+            hi = lo;
+            lo = hi - step;
+            step *= 2;
+        }
+        lo = std::max(lo + 1, ptrdiff_t(0));
+    }
+
+    ptrdiff_t i = detail::branchless_lower_bound(first + lo, hi - lo, value) - first;
+    return static_cast<R>(std::max(i - 1, ptrdiff_t(0)));
+}
+
+/**
+ * Return index of the first element in the range [first, last) such that `element < value` is
+ * `false` (i.e. greater or equal to), or last if no such element is found.
+ *
+ * Compared to the default function, this function allows for a guess of the index and a search
+ * around it. This could be efficient for finding items in large arrays.
+ * The search around `guess` is a galloping search, see gallop_lower_bound(): it is not limited
+ * in width, its cost is logarithmic in the distance between `guess` and the result.
  *
  * @param first Iterator defining the beginning of the range to examine (e.g. `a.begin()`).
  * @param last Iterator defining the end of the range to examine (e.g. `a.end()`)
  * @param value Value to find.
  * @param guess Guess of the index where to find the value.
- * @param proximity Size of the proximity search around `guess` (use `0` to disable).
+ * @param proximity Flag: `0` disables the search around `guess`, any other value enables it.
  * @return The index of `value` (i.e. `a[index] < value <= a[index + 1]`).
  */
 template <class It, class T, class R = size_t>
 inline R lower_bound(const It first, const It last, const T& value, R guess = 0, R proximity = 10)
 {
+    ptrdiff_t n = static_cast<ptrdiff_t>(last - first);
+
     if (proximity == 0) {
         if (value <= *(first)) {
             return 0;
         }
-        return std::lower_bound(first, last, value) - first - 1;
+        return static_cast<R>(detail::branchless_lower_bound(first, n, value) - first - 1);
     }
 
-    if (*(first + guess) < value && value <= *(first + guess + 1)) {
+    ptrdiff_t g = static_cast<ptrdiff_t>(guess);
+
+    if (g >= 0 && g + 1 < n && *(first + g) < value && value <= *(first + g + 1)) {
         return guess;
     }
 
-    R l = guess > proximity ? guess - proximity : 0;
-    R r = std::min(guess + proximity, static_cast<R>(last - first - 1));
-
-    if (*(first + l) < value && *(first + r) >= value) {
-        return std::lower_bound(first + l, first + r, value) - first - 1;
-    }
-    else if (value <= *(first)) {
-        return 0;
-    }
-    else {
-        return std::lower_bound(first, last, value) - first - 1;
-    }
+    return gallop_lower_bound(first, last, value, guess);
 }
 
 } // namespace iterator
@@ -728,8 +963,7 @@ namespace inplace {
  * @param matrix The matrix defining a range per row.
  * @param value The value to find (per row).
  * @param index Initial guess on `index` (updated).
- * @param proximity Size of the proximity search around `guess` (use `0` to disable proximity
- * search).
+ * @param proximity Flag: `0` disables the search around `guess`, see iterator::lower_bound().
  */
 template <class T, class V, class R>
 inline void
@@ -749,6 +983,7 @@ lower_bound(const T& matrix, const V& value, R& index, typename R::value_type pr
     }
 #endif
 
+    PRRNG_PARALLEL_FOR(n)
     for (decltype(n) i = 0; i < n; ++i) {
         index.flat(i) = iterator::lower_bound(
             &matrix.flat(i * stride),
@@ -823,14 +1058,13 @@ inline void cumsum_chunk(V& cumsum, const V& delta, const I& shift)
  * Return index of the first element in the range [first, last) such that `element < value` is
  * `false` (i.e. greater or equal to), or last if no such element is found.
  *
- * This function allows for a guess of the index and a proximity search around.
+ * This function allows for a guess of the index and a (galloping) search around it.
  * This could be efficient for finding items in large arrays.
  *
  * @param matrix The matrix defining a range per row.
  * @param value The value to find (per row).
  * @param index Initial guess on `index`.
- * @param proximity Size of the proximity search around `guess` (use `0` to disable proximity
- * search).
+ * @param proximity Flag: `0` disables the search around `guess`, see iterator::lower_bound().
  * @return Same shape as `index`.
  */
 template <class T, class V, class R>
@@ -902,281 +1136,486 @@ inline V cumsum_chunk(const V& cumsum, const V& delta, const I& shift)
     return ret;
 }
 
+/**
+ * @brief Statistics of the moves of a chunk, to tune the size of the chunk and the
+ * alignment parameters (see prrng::alignment) from data.
+ * For example, many recursions or shifts signal that the chunk is too small compared to the
+ * moves of the target, while many summed numbers signal that the chunk is often moved far.
+ * The statistics are only collected if #PRRNG_ENABLE_STATISTICS is defined
+ * (otherwise they are always zero).
+ * See e.g. prrng::pcg32_cumsum::statistics().
+ */
+struct chunk_statistics {
+    uint64_t drawn = 0; ///< Random numbers drawn and stored in the chunk.
+    uint64_t summed = 0; ///< Random numbers drawn to be summed only (not stored).
+    uint64_t jumps = 0; ///< Number of times that the generator was moved (forward or backward).
+    uint64_t advanced = 0; ///< Total (absolute) distance over which the generator was moved.
+    uint64_t shifts = 0; ///< Number of times that the chunk was moved (e.g. by `prev` or `next`).
+    uint64_t aligns = 0; ///< Number of calls to `align` (not counting recursion).
+    uint64_t recursions = 0; ///< Total number of recursive calls in `align`.
+    uint64_t depth = 0; ///< Recursion depth of the last call to `align`.
+    uint64_t max_depth = 0; ///< Maximal recursion depth of a call to `align`.
+    uint64_t search_hits = 0; ///< Proximity searches in `align` for which the index did not change.
+    uint64_t search_misses = 0; ///< Searches in `align` that needed a galloping or full search.
+    uint64_t prefetched = 0; ///< Random numbers copied from a prefetched chunk (not drawn).
+
+    /**
+     * @brief Count a move of the generator.
+     * @param from Current index of the generator.
+     * @param to New index of the generator.
+     */
+    void jump(ptrdiff_t from, ptrdiff_t to)
+    {
+        if (from != to) {
+            jumps++;
+            advanced += static_cast<uint64_t>(from < to ? to - from : from - to);
+        }
+    }
+
+    /**
+     * @brief Add the statistics of another chunk (the recursion depth is the maximum of both).
+     * @param other Statistics.
+     * @return Reference to this object.
+     */
+    chunk_statistics& operator+=(const chunk_statistics& other)
+    {
+        drawn += other.drawn;
+        summed += other.summed;
+        jumps += other.jumps;
+        advanced += other.advanced;
+        shifts += other.shifts;
+        aligns += other.aligns;
+        recursions += other.recursions;
+        depth = std::max(depth, other.depth);
+        max_depth = std::max(max_depth, other.max_depth);
+        search_hits += other.search_hits;
+        search_misses += other.search_misses;
+        prefetched += other.prefetched;
+        return *this;
+    }
+};
+
+class pcg32_stride;
+
 namespace detail {
 
+/**
+ * @brief Check if a generator can reuse a precomputed jump,
+ * see prrng::pcg32_index::jump_to(ptrdiff_t, pcg32_stride&).
+ * @tparam G Generator.
+ */
+template <class G, class = void>
+struct has_stride : std::false_type {};
+
+template <class G>
+struct has_stride<
+    G,
+    std::void_t<decltype(std::declval<G&>().jump_to(ptrdiff_t(), std::declval<pcg32_stride&>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Chunk of `size` entries stored contiguously in a buffer of `capacity >= size` entries,
+ * starting at `*offset` in the buffer.
+ *
+ * Dropping entries at the front of the chunk (when moving it to the right) only advances
+ * `*offset`. The chunk is copied back to the beginning of the buffer only once the slack
+ * `capacity - size` is used up, such that the cost of moving is amortised.
+ * With `capacity == size` this is an ordinary chunk that is shifted in memory on each move.
+ *
+ * @tparam T Type of the entries (`double` or `float`).
+ */
+template <class T>
+struct chunk_buffer {
+    /**
+     * @param buffer Pointer to the buffer.
+     * @param capacity Size of the buffer.
+     * @param offset Start of the chunk in the buffer (modified).
+     * @param size Size of the chunk.
+     * @param stats Statistics of the moves of the chunk (`nullptr` to skip).
+     * @param jump Last jump of the generator, reused if the distance is the same (or `nullptr`).
+     */
+    chunk_buffer(
+        T* buffer,
+        ptrdiff_t capacity,
+        ptrdiff_t* offset,
+        ptrdiff_t size,
+        chunk_statistics* stats = nullptr,
+        pcg32_stride* jump = nullptr
+    )
+    {
+        this->buffer = buffer;
+        this->capacity = capacity;
+        this->offset = offset;
+        this->size = size;
+        this->stats = stats;
+        this->jump = jump;
+    }
+
+    /**
+     * @brief Pointer to the first entry of the chunk.
+     * @return Pointer.
+     */
+    T* data() const
+    {
+        return buffer + *offset;
+    }
+
+    /**
+     * @brief Drop the first `n` entries of the chunk, and make room for `n` new entries at the
+     * end of it (that are left uninitialised).
+     * @param n Number of entries.
+     * @return Pointer to the first entry of the chunk.
+     */
+    T* drop_front(ptrdiff_t n)
+    {
+        if (*offset + size + n <= capacity) {
+            *offset += n;
+            return this->data();
+        }
+
+        std::copy(buffer + *offset + n, buffer + *offset + size, buffer);
+        *offset = 0;
+        return buffer;
+    }
+
+    T* buffer; ///< Pointer to the buffer.
+    ptrdiff_t capacity; ///< Size of the buffer.
+    ptrdiff_t* offset; ///< Start of the chunk in the buffer.
+    ptrdiff_t size; ///< Size of the chunk.
+    chunk_statistics* stats; ///< Statistics of the moves of the chunk (or `nullptr`).
+    pcg32_stride* jump; ///< Last jump of the generator (or `nullptr`).
+};
+
+/**
+ * @brief Move the generator of a chunk to an index (counting the move in the statistics).
+ * If the chunk stores the last jump (`chunk.jump`), repeated jumps of the same distance
+ * (e.g. shifting the chunk by its size) reuse it.
+ *
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param index Index to jump to.
+ * @param chunk The chunk, see detail::chunk_buffer.
+ */
+template <class G, class T>
+inline void jump_to(G& generator, ptrdiff_t index, const chunk_buffer<T>& chunk)
+{
+    PRRNG_STATISTICS(chunk.stats, jump(static_cast<ptrdiff_t>(generator.index()), index));
+
+    if constexpr (has_stride<G>::value) {
+        if (chunk.jump) {
+            generator.jump_to(index, *chunk.jump);
+            return;
+        }
+    }
+
+    generator.jump_to(index);
+}
+
 /**
  * Align the chunk with the requested index.
  *
- * @param generator Generator, see prrng::pcg32_index() (modified).
- * @param get_chunk ///< @copybrief pcg32_arrayBase_cumsum::m_draw
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param get_chunk
+ *      Function to draw the next `n` random numbers straight into the chunk,
+ *      called as `get_chunk(T* data, size_t n)`.
+ *
  * @param param Alignment parameters, see prrng::alignment().
- * @param data Pointer to the chunk (modified).
- * @param size Size of the chunk.
+ * @param chunk The chunk, see detail::chunk_buffer (modified).
  * @param start Start index of the chunk (modified).
  * @param index Index (global) to align with.
  */
-template <class G, class D, class P>
+template <class G, class D, class P, class T>
 void chunk_align_at(
-    G& generator,
+    G&& generator,
     const D& get_chunk,
     const P& param,
-    double* data,
-    ptrdiff_t size,
+    chunk_buffer<T> chunk,
     ptrdiff_t* start,
     ptrdiff_t index
 )
 {
+    ptrdiff_t size = chunk.size;
     ptrdiff_t ichunk = index - *start;
 
     if (ichunk > param.buffer && ichunk < size - param.buffer) {
         return;
     }
 
-    using R = decltype(get_chunk(size_t{}));
+    T* data = chunk.data();
     ptrdiff_t n = size;
     ptrdiff_t offset = 0;
     ichunk -= param.margin;
+    PRRNG_STATISTICS(chunk.stats, shifts++);
 
     if (ichunk < 0 && ichunk > -size) {
         n = -ichunk;
-        std::copy(data, data + size + ichunk, data + n);
+        std::copy_backward(data, data + size + ichunk, data + size);
     }
     else if (ichunk > 0 && ichunk < size) {
         n = ichunk;
         offset = size - ichunk;
-        std::copy(data + n, data + size, data);
+        data = chunk.drop_front(n);
     }
 
     *start = index - param.margin;
-    generator.jump_to(*start + offset);
-    R extra = get_chunk(static_cast<size_t>(n));
+    detail::jump_to(generator, *start + offset, chunk);
+    get_chunk(data + offset, static_cast<size_t>(n));
     generator.drawn(n);
-    std::copy(extra.begin(), extra.end(), data + offset);
 }
 
 /**
  * @copydoc chunk_align_at
- * @param get_sum ///< @copybrief pcg32_arrayBase_cumsum::m_sum
+ * @param get_sum Function to get the cumsum of `n` random numbers, called as `get_sum(n)`.
  */
-template <class G, class D, class S, class P>
+template <class G, class D, class S, class P, class T>
 void cumsum_align_at(
-    G& generator,
+    G&& generator,
     const D& get_chunk,
     const S& get_sum,
     const P& param,
-    double* data,
-    ptrdiff_t size,
+    chunk_buffer<T> chunk,
     ptrdiff_t* start,
     ptrdiff_t index
 )
 {
+    ptrdiff_t size = chunk.size;
     ptrdiff_t ichunk = index - *start;
 
     if (ichunk > param.buffer && ichunk < size - param.buffer) {
         return;
     }
 
-    using R = decltype(get_chunk(size_t{}));
+    T* data = chunk.data();
     ichunk -= param.margin;
 
+    if (ichunk == 0) {
+        return;
+    }
+
+    PRRNG_STATISTICS(chunk.stats, shifts++);
+
     if (ichunk > 0 && ichunk < size) {
         ptrdiff_t n = ichunk;
         ptrdiff_t offset = size - ichunk;
         double back = data[size - 1];
-        std::copy(data + n, data + size, data);
+        data = chunk.drop_front(n);
 
         *start = index - param.margin;
-        generator.jump_to(*start + offset);
-        R extra = get_chunk(static_cast<size_t>(n));
+        detail::jump_to(generator, *start + offset, chunk);
+        get_chunk(data + offset, static_cast<size_t>(n));
         generator.drawn(n);
 
-        extra.front() += back;
-        std::partial_sum(extra.begin(), extra.end(), extra.begin());
-        std::copy(extra.begin(), extra.end(), data + offset);
+        data[offset] += back;
+        std::partial_sum(data + offset, data + size, data + offset);
         return;
     }
 
     if (ichunk < 0 && ichunk > -size) {
         ptrdiff_t n = -ichunk;
         double front = data[0];
-        std::copy(data, data + size + ichunk, data + n);
+        std::copy_backward(data, data + size + ichunk, data + size);
 
         *start = index - param.margin;
-        generator.jump_to(*start);
-        R extra = get_chunk(static_cast<size_t>(n + 1));
+        detail::jump_to(generator, *start, chunk);
+        get_chunk(data, static_cast<size_t>(n + 1));
         generator.drawn(n + 1);
 
-        std::partial_sum(extra.begin(), extra.end(), extra.begin());
-        extra -= extra.back() - front;
-        std::copy(extra.begin(), extra.end(), data);
+        std::partial_sum(data, data + n + 1, data);
+        double shift = data[n] - front;
+        std::for_each(data, data + n + 1, [shift](T& value) { value -= shift; });
         return;
     }
 
     if (ichunk < 0) {
         ptrdiff_t n = *start - (index - param.margin + size) + 1;
+        double front = data[0];
         *start = index - param.margin;
-        generator.jump_to(*start);
-        R extra = get_chunk(static_cast<size_t>(size));
+        detail::jump_to(generator, *start, chunk);
+        get_chunk(data, static_cast<size_t>(size));
         generator.drawn(size);
 
-        double front = data[0] - get_sum(n);
+        front -= get_sum(n);
         generator.drawn(n);
 
-        std::partial_sum(extra.begin(), extra.end(), extra.begin());
-        extra -= extra.back() - front;
-        std::copy(extra.begin(), extra.end(), data);
+        std::partial_sum(data, data + size, data);
+        double shift = data[size - 1] - front;
+        std::for_each(data, data + size, [shift](T& value) { value -= shift; });
         return;
     }
 
-    generator.jump_to(*start + size);
+    detail::jump_to(generator, *start + size, chunk);
     ptrdiff_t n = index - param.margin - (*start + size);
     *start = index - param.margin;
     double back = get_sum(n) + data[size - 1];
     generator.drawn(n);
 
-    R extra = get_chunk(static_cast<size_t>(size));
+    get_chunk(data, static_cast<size_t>(size));
     generator.drawn(size);
-    extra.front() += back;
-    std::partial_sum(extra.begin(), extra.end(), extra.begin());
-    std::copy(extra.begin(), extra.end(), data);
+    data[0] += back;
+    std::partial_sum(data, data + size, data);
 }
 
 /**
  * Shift chunk left.
  *
- * @param generator Generator, see prrng::pcg32_index() (modified).
- * @param get_chunk Function to draw the random numbers, called as `get_chunk(n)`.
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param get_chunk Function to draw the random numbers, called as `get_chunk(data, n)`.
  * @param margin Overlap to keep with the current chunk.
- * @param data Pointer to the chunk (modified).
- * @param size Size of the chunk.
+ * @param chunk The chunk, see detail::chunk_buffer (modified).
  * @param start Start index of the chunk (modified).
  */
-template <class G, class D>
+template <class G, class D, class T>
 void prev(
-    G& generator,
+    G&& generator,
     const D& get_chunk,
     ptrdiff_t margin,
-    double* data,
-    ptrdiff_t size,
+    chunk_buffer<T> chunk,
     ptrdiff_t* start
 )
 {
-    using R = decltype(get_chunk(size_t{}));
+    ptrdiff_t size = chunk.size;
+    T* data = chunk.data();
+    PRRNG_ASSERT(margin < size);
+    PRRNG_STATISTICS(chunk.stats, shifts++);
 
-    generator.jump_to(*start - size + margin);
+    detail::jump_to(generator, *start - size + margin, chunk);
 
     double front = data[0];
-    ptrdiff_t m = size - margin + 1;
-    R extra = get_chunk(static_cast<size_t>(m));
-    generator.drawn(m);
-    std::partial_sum(extra.begin(), extra.end(), extra.begin());
-    extra -= extra.back() - front;
+    ptrdiff_t m = size - margin;
+    std::copy_backward(data, data + margin, data + size);
 
-    std::copy(data, data + margin, data + size - margin);
-    std::copy(extra.begin(), extra.end() - 1, data);
+    // the last number only fixes the offset with the current chunk: it is not stored
+    // (the index is updated in between, as `get_chunk` may depend on it)
+    T last;
+    get_chunk(data, static_cast<size_t>(m));
+    generator.drawn(m);
+    get_chunk(&last, 1);
+    generator.drawn(1);
+    std::partial_sum(data, data + m, data);
+    double shift = data[m - 1] + last - front;
+    std::for_each(data, data + m, [shift](T& value) { value -= shift; });
 
-    *start -= size - margin;
+    *start -= m;
 }
 
 /**
  * Shift chunk right.
  *
- * @param generator Generator, see prrng::pcg32_index() (modified).
- * @param get_chunk Function to draw the random numbers, called as `get_chunk(n)`.
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param get_chunk Function to draw the random numbers, called as `get_chunk(data, n)`.
  * @param margin Overlap to keep with the current chunk.
- * @param data Pointer to the chunk (modified).
- * @param size Size of the chunk.
+ * @param chunk The chunk, see detail::chunk_buffer (modified).
  * @param start Start index of the chunk (modified).
  */
-template <class G, class D>
+template <class G, class D, class T>
 void next(
-    G& generator,
+    G&& generator,
     const D& get_chunk,
     ptrdiff_t margin,
-    double* data,
-    ptrdiff_t size,
+    chunk_buffer<T> chunk,
     ptrdiff_t* start
 )
 {
-    using R = decltype(get_chunk(size_t{}));
+    ptrdiff_t size = chunk.size;
     PRRNG_ASSERT(margin < size);
+    PRRNG_STATISTICS(chunk.stats, shifts++);
 
-    generator.jump_to(*start + size);
+    detail::jump_to(generator, *start + size, chunk);
 
-    double back = data[size - 1];
+    double back = chunk.data()[size - 1];
     ptrdiff_t n = size - margin;
-    R extra = get_chunk(static_cast<size_t>(n));
+    T* data = chunk.drop_front(n);
+    get_chunk(data + margin, static_cast<size_t>(n));
     generator.drawn(n);
-    extra.front() += back;
-    std::partial_sum(extra.begin(), extra.end(), extra.begin());
-    std::copy(data + size - margin, data + size, data);
-    std::copy(extra.begin(), extra.end(), data + margin);
+    data[margin] += back;
+    std::partial_sum(data + margin, data + size, data + margin);
     *start += n;
 }
 
 /**
  * Align the chunk to encompass a target value.
  *
- * @param generator Generator, see prrng::pcg32_index() (modified).
- * @param get_chunk ///< @copybrief pcg32_arrayBase_cumsum::m_draw
- * @param get_sum ///< @copybrief pcg32_arrayBase_cumsum::m_sum
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param get_chunk
+ *      Function to draw the next `n` random numbers straight into the chunk,
+ *      called as `get_chunk(T* data, size_t n)`.
+ *
+ * @param get_sum Function to get the cumsum of `n` random numbers, called as `get_sum(n)`.
  * @param param Alignment parameters, see prrng::alignment().
- * @param data Pointer to the chunk (modified).
- * @param size Size of the chunk.
+ * @param chunk The chunk, see detail::chunk_buffer (modified).
  * @param start Start index of the chunk (modified).
  * @param i Last index of `target` relative to the start of the chunk (modified).
  * @param target Target value.
  * @param recursive Used internally to distinguish between external and internal calls.
  */
-template <class G, class D, class S, class P>
+template <class G, class D, class S, class P, class T>
 void align(
-    G& generator,
+    G&& generator,
     const D& get_chunk,
     const S& get_sum,
     const P& param,
-    double* data,
-    ptrdiff_t size,
+    chunk_buffer<T> chunk,
     ptrdiff_t* start,
     ptrdiff_t* i,
     double target,
     bool recursive = false
 )
 {
-    using R = decltype(get_chunk(size_t{}));
+    ptrdiff_t size = chunk.size;
+    T* data = chunk.data();
+
+#ifdef PRRNG_ENABLE_STATISTICS
+    if (chunk.stats != nullptr) {
+        chunk_statistics& stats = *chunk.stats;
+        if (recursive) {
+            stats.recursions++;
+            stats.depth++;
+            stats.max_depth = std::max(stats.max_depth, stats.depth);
+        }
+        else {
+            stats.aligns++;
+            stats.depth = 0;
+        }
+    }
+#endif
 
     if (target > data[size - 1]) {
         double delta = data[size - 1] - data[0];
         ptrdiff_t n = size;
-        generator.jump_to(*start + size);
+        detail::jump_to(generator, *start + size, chunk);
         double back = data[size - 1];
         double j = (target - data[size - 1]) / delta - (double)(param.margin) / (double)(n);
 
         if (j > 1) {
             ptrdiff_t m = static_cast<ptrdiff_t>((j - 1) * static_cast<double>(n));
+            PRRNG_STATISTICS(chunk.stats, shifts++);
             back += get_sum(static_cast<size_t>(m));
             generator.drawn(m);
             *start += m + size;
-            R extra = get_chunk(static_cast<size_t>(n));
+            get_chunk(data, static_cast<size_t>(n));
             generator.drawn(n);
-            extra.front() += back;
-            std::partial_sum(extra.begin(), extra.end(), data);
-            return align(generator, get_chunk, get_sum, param, data, size, start, i, target, true);
+            data[0] += back;
+            std::partial_sum(data, data + n, data);
+            return align(generator, get_chunk, get_sum, param, chunk, start, i, target, true);
         }
 
-        next(generator, get_chunk, 1 + param.margin, data, size, start);
-        return align(generator, get_chunk, get_sum, param, data, size, start, i, target, true);
+        next(generator, get_chunk, 1 + param.margin, chunk, start);
+        return align(generator, get_chunk, get_sum, param, chunk, start, i, target, true);
     }
 
     if (target < data[0]) {
-        prev(generator, get_chunk, 0, data, size, start);
-        return align(generator, get_chunk, get_sum, param, data, size, start, i, target, true);
+        prev(generator, get_chunk, 0, chunk, start);
+        return align(generator, get_chunk, get_sum, param, chunk, start, i, target, true);
     }
 
     if (recursive || *i >= size) {
-        *i = std::lower_bound(data, data + size, target) - data - 1;
+        *i = detail::branchless_lower_bound(data, size, target) - data - 1;
+        PRRNG_STATISTICS(chunk.stats, search_misses++);
     }
     else {
+        [[maybe_unused]] ptrdiff_t guess = *i;
         *i = iterator::lower_bound(data, data + size, target, *i);
+        PRRNG_STATISTICS(chunk.stats, search_hits += *i == guess);
+        PRRNG_STATISTICS(chunk.stats, search_misses += *i != guess);
     }
 
     if (*i == param.margin) {
@@ -1189,20 +1628,21 @@ void align(
         if (!param.strict && *i >= param.min_margin) {
             return;
         }
-        prev(generator, get_chunk, 0, data, size, start);
-        return align(generator, get_chunk, get_sum, param, data, size, start, i, target, true);
+        prev(generator, get_chunk, 0, chunk, start);
+        return align(generator, get_chunk, get_sum, param, chunk, start, i, target, true);
     }
 
-    generator.jump_to(*start + size);
+    detail::jump_to(generator, *start + size, chunk);
     ptrdiff_t n = *i - param.margin;
-    R extra = get_chunk(static_cast<size_t>(n));
+    double back = data[size - 1];
+    PRRNG_STATISTICS(chunk.stats, shifts++);
+    data = chunk.drop_front(n);
+    get_chunk(data + size - n, static_cast<size_t>(n));
     generator.drawn(n);
     *start += n;
     *i -= n;
-    extra.front() += data[size - 1];
-    std::partial_sum(extra.begin(), extra.end(), extra.begin());
-    std::copy(data + n, data + size, data);
-    std::copy(extra.begin(), extra.end(), data + size - n);
+    data[size - n] += back;
+    std::partial_sum(data + size - n, data + size, data + size - n);
 }
 
 } // namespace detail
@@ -1260,6 +1700,19 @@ public:
      */
     template <class T>
     T quantile(const T& p)
+    {
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p`.
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
     {
         return -xt::log(1.0 - p) * m_scale;
     }
@@ -1323,6 +1776,19 @@ public:
      */
     template <class T>
     T quantile(const T& p)
+    {
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p`.
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
     {
         return xt::pow(1.0 - p, 1.0 / m_k);
     }
@@ -1412,15 +1878,26 @@ public:
     template <class T>
     T quantile(const T& p)
     {
-        using value_type = typename T::value_type;
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p` (`NaN` without PRRNG_USE_BOOST).
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
+    {
+        using value_type = typename E::value_type;
 
 #if PRRNG_USE_BOOST
         auto f = xt::vectorize(boost::math::gamma_p_inv<value_type, value_type>);
         return m_scale * f(m_shape, p);
 #else
-        auto ret = p;
-        ret.fill(std::numeric_limits<value_type>::quiet_NaN());
-        return ret;
+        return p * std::numeric_limits<value_type>::quiet_NaN();
 #endif
     }
 
@@ -1489,6 +1966,19 @@ public:
      */
     template <class T>
     T quantile(const T& p)
+    {
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p`.
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
     {
         return m_scale * xt::pow(1.0 - p, -1.0 / m_k);
     }
@@ -1572,6 +2062,19 @@ public:
      */
     template <class T>
     T quantile(const T& p)
+    {
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p`.
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
     {
         return m_scale * xt::pow(-xt::log1p(-p), 1.0 / m_shape);
     }
@@ -1648,16 +2151,27 @@ public:
     template <class T>
     T quantile(const T& p)
     {
-        using value_type = typename detail::get_value_type<T>::type;
+        return this->quantile_expression(p);
+    }
+
+    /**
+     * Quantile as an unevaluated expression, see quantile().
+     * It can be evaluated in place, e.g. `xt::noalias(p) = quantile_expression(p)`.
+     *
+     * @param p Probability [0, 1].
+     * @return Expression of the quantile for each `p` (`NaN` without PRRNG_USE_BOOST).
+     */
+    template <class E>
+    auto quantile_expression(const E& p) const
+    {
+        using value_type = typename detail::get_value_type<E>::type;
 
 #if PRRNG_USE_BOOST
         auto f = xt::vectorize(boost::math::erf_inv<value_type>);
         return m_mu + m_sigma_sqrt2 * f(2.0 * p - 1.0);
 #else
-        static_assert(xt::is_xexpression<T>::value, "T must be an xexpression");
-        auto ret = p;
-        ret.fill(std::numeric_limits<value_type>::quiet_NaN());
-        return ret;
+        static_assert(xt::is_xexpression<E>::value, "E must be an xexpression");
+        return p * std::numeric_limits<value_type>::quiet_NaN();
 #endif
     }
 
@@ -1667,4532 +2181,13577 @@ private:
     double m_sigma_sqrt2;
 };
 
+namespace detail {
+
 /**
- * Base class of the pseudorandom number generators providing common methods.
- * If you want to implement a new generator, you should inherit from this class.
- * The following minimal signature is required:
- *
- *      class MyGenerator : public GeneratorBase<MyGenerator> {
- *      public:
- *          // Return next random number [0, 1).
- *          double next_double();
+ * @brief Advance a splitmix64 stream and return its next output.
+ * Used to derive the (variable number of) uniform numbers needed by the rejection samplers
+ * from a single random number of the generator, see detail::uint32_to_fast_normal().
  *
- *          // Return next random number (0, 1).
- *          double next_positive_double();
+ * @param state State of the stream (modified).
+ * @return Random number.
  *
- *          // Return next random number [0, 2^32).
- *          uint32_t next_uint32();
- *      };
+ * @author Sebastiano Vigna, https://prng.di.unimi.it/splitmix64.c.
+ */
+inline uint64_t splitmix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Random number on the interval (0, 1) from a splitmix64 stream.
+ * @param state State of the stream (modified).
+ * @return Random number.
+ */
+inline double splitmix64_positive_double(uint64_t& state)
+{
+    return (static_cast<double>(splitmix64(state) >> 11) + 0.5) *
+           1.1102230246251565404236316680908203125e-16;
+}
+
+/**
+ * @brief Ziggurat of `C` blocks of equal area `V` under the density `f`,
+ * with the base strip starting at `R` (Doornik, "An Improved Ziggurat Method to Generate Normal
+ * Random Samples", 2005).
  *
- * @tparam Derived Derived class.
+ * -    `x[i]` is the right edge of block `i` (`x[0] = V / f(R)`, `x[1] = R`, `x[C] = 0`).
+ * -    `r[i] = x[i + 1] / x[i]` is the fraction of block `i` that is accepted without a test.
  */
-template <class Derived>
-class GeneratorBase {
+template <size_t C>
+struct ziggurat_table {
+    double x[C + 1]; ///< Right edge of each block.
+    double r[C]; ///< Fraction of each block that is accepted without a test.
+};
+
+/**
+ * @brief Ziggurat of the (standard) normal distribution: 128 blocks.
+ * The tables are computed once (on first use).
+ * @return Tables.
+ */
+inline const ziggurat_table<128>& ziggurat_normal()
+{
+    static const ziggurat_table<128> table = []() {
+        ziggurat_table<128> ret;
+        const double R = 3.442619855899;
+        const double V = 9.91256303526217e-3;
+        double f = std::exp(-0.5 * R * R);
+        ret.x[0] = V / f;
+        ret.x[1] = R;
+        ret.x[128] = 0.0;
+        for (size_t i = 2; i < 128; ++i) {
+            ret.x[i] = std::sqrt(-2.0 * std::log(V / ret.x[i - 1] + f));
+            f = std::exp(-0.5 * ret.x[i] * ret.x[i]);
+        }
+        for (size_t i = 0; i < 128; ++i) {
+            ret.r[i] = ret.x[i + 1] / ret.x[i];
+        }
+        return ret;
+    }();
+
+    return table;
+}
+
+/**
+ * @brief Ziggurat of the (standard) exponential distribution: 256 blocks.
+ * The tables are computed once (on first use).
+ * @return Tables.
+ */
+inline const ziggurat_table<256>& ziggurat_exponential()
+{
+    static const ziggurat_table<256> table = []() {
+        ziggurat_table<256> ret;
+        const double R = 7.69711747013104972;
+        const double V = 3.949659822581572e-3;
+        double f = std::exp(-R);
+        ret.x[0] = V / f;
+        ret.x[1] = R;
+        ret.x[256] = 0.0;
+        for (size_t i = 2; i < 256; ++i) {
+            ret.x[i] = -std::log(V / ret.x[i - 1] + f);
+            f = std::exp(-ret.x[i]);
+        }
+        for (size_t i = 0; i < 256; ++i) {
+            ret.r[i] = ret.x[i + 1] / ret.x[i];
+        }
+        return ret;
+    }();
+
+    return table;
+}
+
+/**
+ * @brief Sample of the standard normal distribution using the Ziggurat method.
+ *
+ * @param state State of the splitmix64 stream (modified).
+ * @param table See detail::ziggurat_normal().
+ * @return Random number.
+ */
+inline double ziggurat_normal_sample(uint64_t& state, const ziggurat_table<128>& table)
+{
+    for (;;) {
+        uint64_t z = splitmix64(state);
+        size_t i = static_cast<size_t>(z & 0x7F);
+        double u = static_cast<double>(z >> 11) * 2.220446049250313080847263336181640625e-16 - 1.0;
+
+        if (std::abs(u) < table.r[i]) {
+            return u * table.x[i];
+        }
+
+        if (i == 0) {
+            double R = table.x[1];
+            double x;
+            double y;
+            do {
+                x = std::log(splitmix64_positive_double(state)) / R;
+                y = std::log(splitmix64_positive_double(state));
+            } while (-2.0 * y < x * x);
+            return u < 0 ? x - R : R - x;
+        }
+
+        double x = u * table.x[i];
+        double f0 = std::exp(-0.5 * (table.x[i] * table.x[i] - x * x));
+        double f1 = std::exp(-0.5 * (table.x[i + 1] * table.x[i + 1] - x * x));
+
+        if (f1 + splitmix64_positive_double(state) * (f0 - f1) < 1.0) {
+            return x;
+        }
+    }
+}
+
+/**
+ * @brief Sample of the standard exponential distribution using the Ziggurat method.
+ *
+ * @param state State of the splitmix64 stream (modified).
+ * @param table See detail::ziggurat_exponential().
+ * @return Random number.
+ */
+inline double ziggurat_exponential_sample(uint64_t& state, const ziggurat_table<256>& table)
+{
+    for (;;) {
+        uint64_t z = splitmix64(state);
+        size_t i = static_cast<size_t>(z & 0xFF);
+        double u = static_cast<double>(z >> 11) * 1.1102230246251565404236316680908203125e-16;
+
+        if (u < table.r[i]) {
+            return u * table.x[i];
+        }
+
+        if (i == 0) {
+            return table.x[1] - std::log(splitmix64_positive_double(state));
+        }
+
+        double x = u * table.x[i];
+        double f0 = std::exp(-(table.x[i] - x));
+        double f1 = std::exp(-(table.x[i + 1] - x));
+
+        if (f1 + splitmix64_positive_double(state) * (f0 - f1) < 1.0) {
+            return x;
+        }
+    }
+}
+
+/**
+ * @brief Sample of the gamma distribution (with unit scale) using the method of Marsaglia and
+ * Tsang, "A Simple Method for Generating Gamma Variables", ACM TOMS 26 (2000).
+ * For `k < 1` the sample for `k + 1` is multiplied by `U^(1 / k)`.
+ *
+ * @param state State of the splitmix64 stream (modified).
+ * @param k Shape parameter.
+ * @param table See detail::ziggurat_normal().
+ * @return Random number.
+ */
+inline double
+marsaglia_tsang_gamma_sample(uint64_t& state, double k, const ziggurat_table<128>& table)
+{
+    if (k < 1.0) {
+        double g = marsaglia_tsang_gamma_sample(state, k + 1.0, table);
+        return g * std::pow(splitmix64_positive_double(state), 1.0 / k);
+    }
+
+    double d = k - 1.0 / 3.0;
+    double c = 1.0 / std::sqrt(9.0 * d);
+
+    for (;;) {
+        double x;
+        double v;
+        do {
+            x = ziggurat_normal_sample(state, table);
+            v = 1.0 + c * x;
+        } while (v <= 0.0);
+        v = v * v * v;
+        double u = splitmix64_positive_double(state);
+        double x2 = x * x;
+        if (u < 1.0 - 0.0331 * x2 * x2) {
+            return d * v;
+        }
+        if (std::log(u) < 0.5 * x2 + d * (1.0 - v + std::log(v))) {
+            return d * v;
+        }
+    }
+}
+
+/**
+ * @brief Convert a random `uint32_t` to a normally distributed number using the Ziggurat method,
+ * see prrng::GeneratorBase::fast_normal().
+ */
+class uint32_to_fast_normal {
 public:
     /**
-     * @brief Result of the cumulative sum of `n` random numbers.
-     * @param n Number of steps.
-     * @return Cumulative sum.
+     * @param mu Mean.
+     * @param sigma Standard deviation.
      */
-    double cumsum_random(size_t n)
+    uint32_to_fast_normal(double mu, double sigma)
     {
-        double ret = 0.0;
-        for (size_t i = 0; i < n; ++i) {
-            ret += static_cast<Derived*>(this)->next_double();
-        }
-        return ret;
+        m_mu = mu;
+        m_sigma = sigma;
+        m_table = &ziggurat_normal();
     }
 
     /**
-     * @brief Result of the cumulative sum of `n` 'random' numbers, distributed according to a
-     * delta distribution,
-     * @param n Number of steps.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @param r Random number.
+     * @return Sample.
      */
-    double cumsum_delta(size_t n, double scale = 1)
+    double operator()(uint32_t r) const
     {
-        return static_cast<double>(n) * scale;
+        uint64_t state = r;
+        return m_mu + m_sigma * ziggurat_normal_sample(state, *m_table);
     }
 
+private:
+    double m_mu;
+    double m_sigma;
+    const ziggurat_table<128>* m_table;
+};
+
+/**
+ * @brief Convert a random `uint32_t` to an exponentially distributed number using the Ziggurat
+ * method, see prrng::GeneratorBase::fast_exponential().
+ */
+class uint32_to_fast_exponential {
+public:
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to an
-     * exponential distribution, see exponential_distribution(),
-     * @param n Number of steps.
      * @param scale Scale.
-     * @return Cumulative sum.
      */
-    double cumsum_exponential(size_t n, double scale = 1)
+    uint32_to_fast_exponential(double scale)
     {
-        double ret = 0.0;
-        for (size_t i = 0; i < n; ++i) {
-            ret -= std::log(1.0 - static_cast<Derived*>(this)->next_double());
-        }
-        return scale * ret;
+        m_scale = scale;
+        m_table = &ziggurat_exponential();
     }
 
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
-     * power distribution, see power_distribution(),
-     * @param n Number of steps.
-     * @param k Scale.
-     * @return Cumulative sum.
+     * @param r Random number.
+     * @return Sample.
      */
-    double cumsum_power(size_t n, double k = 1)
+    double operator()(uint32_t r) const
     {
-        double ret = 0.0;
-        double exponent = 1.0 / k;
-        for (size_t i = 0; i < n; ++i) {
-            ret += std::pow(1.0 - static_cast<Derived*>(this)->next_double(), exponent);
-        }
-        return ret;
+        uint64_t state = r;
+        return m_scale * ziggurat_exponential_sample(state, *m_table);
     }
 
+private:
+    double m_scale;
+    const ziggurat_table<256>* m_table;
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a gamma distributed number using the method of
+ * Marsaglia and Tsang, see prrng::GeneratorBase::fast_gamma().
+ */
+class uint32_to_fast_gamma {
+public:
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
-     * gamma distribution, see gamma_distribution(),
-     * @param n Number of steps.
-     * @param k Shape.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
      */
-    double cumsum_gamma(size_t n, double k = 1, double scale = 1)
+    uint32_to_fast_gamma(double k, double scale)
     {
-#if PRRNG_USE_BOOST
-        double ret = 0.0;
-        for (size_t i = 0; i < n; ++i) {
-            ret += boost::math::gamma_p_inv<double, double>(
-                k, static_cast<Derived*>(this)->next_double()
-            );
-        }
-        return scale * ret;
-#else
-        return std::numeric_limits<double>::quiet_NaN();
-#endif
+        m_k = k;
+        m_scale = scale;
+        m_table = &ziggurat_normal();
     }
 
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
-     * Pareto distribution, see pareto_distribution(),
-     * @param n Number of steps.
-     * @param k Shape.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @param r Random number.
+     * @return Sample.
      */
-    double cumsum_pareto(size_t n, double k = 1, double scale = 1)
+    double operator()(uint32_t r) const
     {
-        double ret = 0.0;
-        double exponent = -1.0 / k;
-        for (size_t i = 0; i < n; ++i) {
-            ret += std::pow(1.0 - static_cast<Derived*>(this)->next_double(), exponent);
-        }
-        return scale * ret;
+        uint64_t state = r;
+        return m_scale * marsaglia_tsang_gamma_sample(state, m_k, *m_table);
     }
 
+private:
+    double m_k;
+    double m_scale;
+    const ziggurat_table<128>* m_table;
+};
+
+/**
+ * @brief Tabulated `x^a` for a fixed exponent `a`, see prrng::GeneratorBase::fast_power().
+ *
+ * Writing `x = 2^e m` with `1 <= m < 2`, the mantissa is split in 1024 intervals of centre `c`
+ * such that `x^a = 2^(a e) c^a (1 + t)^a` with `t = (m - c) / c` and `|t| < 2^-11`.
+ * The factors `2^(a e)` and `c^a` are tabulated (for `-64 <= e < 64`),
+ * the last factor uses its Taylor expansion up to `t^5`.
+ * Thereby the relative error is below `4e-15` for `|a| <= 20`.
+ * Larger exponents (and arguments outside the tabulated range) use `std::pow`.
+ */
+class pow_table {
+public:
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
-     * weibull distribution, see weibull_distribution(),
-     * @param n Number of steps.
-     * @param k Shape.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @param a Exponent.
      */
-    double cumsum_weibull(size_t n, double k = 1, double scale = 1)
+    pow_table(double a)
     {
-        double ret = 0.0;
-        double k_inv = 1.0 / k;
-        for (size_t i = 0; i < n; ++i) {
-            ret += std::pow(-std::log(1.0 - static_cast<Derived*>(this)->next_double()), k_inv);
+        m_a = a;
+        m_exact = !(std::abs(a) <= 20.0);
+
+        if (m_exact) {
+            return;
+        }
+
+        m_coeff[0] = a;
+        m_coeff[1] = m_coeff[0] * (a - 1.0) / 2.0;
+        m_coeff[2] = m_coeff[1] * (a - 2.0) / 3.0;
+        m_coeff[3] = m_coeff[2] * (a - 3.0) / 4.0;
+        m_coeff[4] = m_coeff[3] * (a - 4.0) / 5.0;
+
+        for (size_t i = 0; i < 128; ++i) {
+            m_binade[i] = std::exp2(a * (static_cast<double>(i) - 64.0));
+        }
+
+        for (size_t i = 0; i < 1024; ++i) {
+            double c = 1.0 + (static_cast<double>(i) + 0.5) / 1024.0;
+            m_mantissa[i] = std::pow(c, a);
+            m_inv[i] = 1.0 / c;
         }
-        return scale * ret;
     }
 
     /**
-     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
-     * normal distribution, see normal_distribution(),
-     * @param n Number of steps.
-     * @param mu Mean.
-     * @param sigma Standard deviation.
-     * @return Cumulative sum.
+     * @return Exponent.
      */
-    double cumsum_normal(size_t n, double mu = 0, double sigma = 1)
+    double exponent() const
     {
-#if PRRNG_USE_BOOST
-        double ret = 0.0;
-        for (size_t i = 0; i < n; ++i) {
-            ret += boost::math::erf_inv<double>(
-                2.0 * static_cast<Derived*>(this)->next_double() - 1.0
-            );
-        }
-        return static_cast<double>(n) * mu + sigma * std::sqrt(2.0) * ret;
-#else
-        return std::numeric_limits<double>::quiet_NaN();
-#endif
+        return m_a;
     }
 
     /**
-     * Draw uniformly distributed permutation and permute the given STL container.
-     *
-     * @param begin Iterator to the beginning of the container.
-     * @param end Iterator to the end of the container.
-     *
-     * @note From: Knuth, TAoCP Vol. 2 (3rd 3d), Section 3.4.2
-     *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param x Argument.
+     * @return `x^a`.
      */
-    template <typename Iterator>
-    void shuffle(Iterator begin, Iterator end)
+    double operator()(double x) const
     {
-        for (Iterator it = end - 1; it > begin; --it) {
-            std::iter_swap(
-                it, begin + static_cast<Derived*>(this)->next_uint32((uint32_t)(it - begin + 1))
-            );
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(double));
+        uint64_t e = (bits >> 52) - 959; // biased exponent - 1023 + 64 (wraps if negative)
+
+        if (m_exact || e >= 128) {
+            return std::pow(x, m_a);
+        }
+
+        size_t i = static_cast<size_t>((bits >> 42) & 1023);
+        bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+        double m;
+        std::memcpy(&m, &bits, sizeof(double));
+        double c = 1.0 + (static_cast<double>(i) + 0.5) * 0.0009765625;
+        double t = (m - c) * m_inv[i];
+        double t2 = t * t;
+        double p = t * (m_coeff[0] + t * m_coeff[1]) +
+                   t2 * t * (m_coeff[2] + t * m_coeff[3] + t2 * m_coeff[4]);
+        return m_binade[e] * (m_mantissa[i] + m_mantissa[i] * p);
+    }
+
+private:
+    double m_a; ///< Exponent.
+    bool m_exact; ///< Use `std::pow`.
+    double m_coeff[5]; ///< Taylor coefficients of `(1 + t)^a`.
+    double m_binade[128]; ///< `2^(a e)` for `e = -64, ..., 63`.
+    double m_mantissa[1024]; ///< `c^a` for the centre of each interval.
+    double m_inv[1024]; ///< `1 / c` for the centre of each interval.
+};
+
+/**
+ * @brief Table of `x^a` for a given exponent, see detail::pow_table.
+ * The tables of the most recently used exponents are kept (per thread),
+ * such that they are built only once per distribution parameters.
+ *
+ * @param a Exponent.
+ * @return Table.
+ */
+inline std::shared_ptr<const pow_table> cached_pow_table(double a)
+{
+    static thread_local std::array<std::shared_ptr<const pow_table>, 8> cache;
+    static thread_local size_t next = 0;
+
+    for (auto& entry : cache) {
+        if (entry && entry->exponent() == a) {
+            return entry;
         }
     }
 
+    auto ret = std::make_shared<const pow_table>(a);
+    cache[next] = ret;
+    next = (next + 1) % cache.size();
+    return ret;
+}
+
+/**
+ * @brief Convert a random `uint32_t` to a power distributed number using a tabulated quantile,
+ * see prrng::GeneratorBase::fast_power().
+ */
+class uint32_to_fast_power {
+public:
     /**
-     * @brief Decide based on probability per value.
-     * This is fully equivalent to `generator.random(p.shape) < p`,
-     * but avoids the memory allocation of `random`.
-     *
-     * @param p Probability per value [0, 1].
-     * @return Decision for each `p`.
+     * @param k Scale.
      */
-    template <class P>
-    auto decide(const P& p) -> typename detail::return_type<bool, P>::type
+    uint32_to_fast_power(double k)
     {
-        using R = typename detail::return_type<bool, P>::type;
-        R ret = xt::empty<bool>(p.shape());
-        this->decide(p, ret);
-        return ret;
+        m_pow = cached_pow_table(1.0 / k);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::decide(const P&)
+     * @param r Random number.
+     * @return Sample.
      */
-    template <class P, class R>
-    R decide(const P& p)
+    double operator()(uint32_t r) const
     {
-        using value_type = typename detail::get_value_type<R>::type;
-        R ret = xt::empty<value_type>(p.shape());
-        this->decide(p, ret);
-        return ret;
+        return (*m_pow)(1.0 - static_cast<double>(r) * 2.3283064365386962890625e-10);
     }
 
+private:
+    std::shared_ptr<const pow_table> m_pow;
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a Pareto distributed number using a tabulated quantile,
+ * see prrng::GeneratorBase::fast_pareto().
+ */
+class uint32_to_fast_pareto {
+public:
     /**
-     * @brief Decide based on probability per value.
-     * This is fully equivalent to `generator.random(p.shape) < p`,
-     * but avoids the memory allocation of `random`.
-     *
-     * @param p Probability per value [0, 1].
-     * @param ret Decision for each ``p``.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
      */
-    template <class P, class R>
-    void decide(const P& p, R& ret)
+    uint32_to_fast_pareto(double k, double scale)
     {
-        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
-        using value_type = typename detail::get_value_type<R>::type;
-
-        for (size_t i = 0; i < p.size(); ++i) {
-            if (static_cast<Derived*>(this)->next_double() < p.flat(i)) {
-                ret.flat(i) = static_cast<value_type>(true);
-            }
-            else {
-                ret.flat(i) = static_cast<value_type>(false);
-            }
-        }
+        m_scale = scale;
+        m_pow = cached_pow_table(-1.0 / k);
     }
 
     /**
-     * @brief Decide based on probability per value.
-     * This is fully equivalent to `generator.random(p.shape) < p`,
-     * but avoids the memory allocation of `random`.
-     *
-     * @param p Probability per value [0, 1].
-     * @param mask Where `true` the decision is `false` (no random number is drawn there).
-     * @return Decision for each `p`.
+     * @param r Random number.
+     * @return Sample.
      */
-    template <class P, class T>
-    auto decide_masked(const P& p, const T& mask) -> typename detail::return_type<bool, P>::type
+    double operator()(uint32_t r) const
     {
-        using R = typename detail::return_type<bool, P>::type;
-        R ret = xt::empty<bool>(p.shape());
-        this->decide_masked(p, mask, ret);
-        return ret;
+        return m_scale * (*m_pow)(1.0 - static_cast<double>(r) * 2.3283064365386962890625e-10);
     }
 
+private:
+    double m_scale;
+    std::shared_ptr<const pow_table> m_pow;
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a Weibull distributed number using a tabulated quantile,
+ * see prrng::GeneratorBase::fast_weibull().
+ */
+class uint32_to_fast_weibull {
+public:
     /**
-     * @copydoc prrng::GeneratorBase::decide_masked(const P&, const T&)
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
      */
-    template <class P, class T, class R>
-    R decide_masked(const P& p, const T& mask)
+    uint32_to_fast_weibull(double k, double scale)
     {
-        using value_type = typename detail::get_value_type<R>::type;
-        R ret = xt::empty<value_type>(p.shape());
-        this->decide_masked(p, mask, ret);
-        return ret;
+        m_scale = scale;
+        m_pow = cached_pow_table(1.0 / k);
     }
 
     /**
-     * @brief Decide based on probability per value.
-     * This is fully equivalent to `generator.random(p.shape) < p`,
-     * but avoids the memory allocation of `random`.
-     *
-     * @param p Probability per value [0, 1].
-     * @param mask Where `true` the decision is `false` (no random number is drawn there).
-     * @param ret Decision for each ``p``.
+     * @param r Random number.
+     * @return Sample.
      */
-    template <class P, class T, class R>
-    void decide_masked(const P& p, const T& mask, R& ret)
+    double operator()(uint32_t r) const
     {
-        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
-        using value_type = typename detail::get_value_type<R>::type;
-
-        for (size_t i = 0; i < p.size(); ++i) {
-            if (mask.flat(i)) {
-                ret.flat(i) = static_cast<value_type>(false);
-            }
-            else if (static_cast<Derived*>(this)->next_double() < p.flat(i)) {
-                ret.flat(i) = static_cast<value_type>(true);
-            }
-            else {
-                ret.flat(i) = static_cast<value_type>(false);
-            }
-        }
+        double p = static_cast<double>(r) * 2.3283064365386962890625e-10;
+        return m_scale * (*m_pow)(-std::log(1.0 - p));
     }
 
+private:
+    double m_scale;
+    std::shared_ptr<const pow_table> m_pow;
+};
+
+/**
+ * @brief Sample the sum of `n` normally distributed numbers from its law
+ * `normal(n * mu, sqrt(n) * sigma)` using a random `uint32_t`,
+ * see prrng::GeneratorBase::cumsum_normal().
+ */
+class cumsum_skip_normal {
+public:
     /**
-     * Generate a random number \f$ 0 \leq r \leq 1 \f$.
-     *
-     * @return Random number.
+     * @param mu Mean of one number.
+     * @param sigma Standard deviation of one number.
      */
-    double random()
+    cumsum_skip_normal(double mu, double sigma)
     {
-        return static_cast<Derived*>(this)->next_double();
+        m_mu = mu;
+        m_sigma = sigma;
+        m_table = &ziggurat_normal();
     }
 
     /**
-     * Generate an nd-array of random numbers \f$ 0 \leq r \leq 1 \f$.
-     *
-     * @param shape The shape of the nd-array.
-     * @return The sample of shape `shape`.
+     * @param r Random number.
+     * @param n Number of summed numbers.
+     * @return Sample of the sum.
      */
-    template <class S>
-    auto random(const S& shape) -> typename detail::return_type<double, S>::type
+    double operator()(uint32_t r, size_t n) const
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->random_impl<R>(shape);
+        uint64_t state = r;
+        double m = static_cast<double>(n);
+        return m * m_mu + std::sqrt(m) * m_sigma * ziggurat_normal_sample(state, *m_table);
     }
 
+private:
+    double m_mu;
+    double m_sigma;
+    const ziggurat_table<128>* m_table;
+};
+
+/**
+ * @brief Sample the sum of `n` gamma distributed numbers from its law `gamma(n * k, scale)`
+ * using a random `uint32_t`, see prrng::GeneratorBase::cumsum_gamma().
+ * The exponential distribution corresponds to `k = 1`.
+ */
+class cumsum_skip_gamma {
+public:
     /**
-     * @copydoc prrng::GeneratorBase::random(const S&)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @param k Shape parameter of one number.
+     * @param scale Scale parameter.
      */
-    template <class R, class S>
-    R random(const S& shape)
+    cumsum_skip_gamma(double k, double scale)
     {
-        return this->random_impl<R>(shape);
+        m_k = k;
+        m_scale = scale;
+        m_table = &ziggurat_normal();
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::random(const S&)
+     * @param r Random number.
+     * @param n Number of summed numbers.
+     * @return Sample of the sum.
      */
-    template <class I, std::size_t L>
-    auto random(const I (&shape)[L]) -> typename detail::return_type_fixed<double, L>::type
+    double operator()(uint32_t r, size_t n) const
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->random_impl<R>(shape);
+        uint64_t state = r;
+        double k = static_cast<double>(n) * m_k;
+        return m_scale * marsaglia_tsang_gamma_sample(state, k, *m_table);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase::random(const S&)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R random(const I (&shape)[L])
+private:
+    double m_k;
+    double m_scale;
+    const ziggurat_table<128>* m_table;
+};
+
+/**
+ * @brief Identity "conversion" of a random `uint32_t` (to draw raw numbers with the same
+ * machinery as the converted draws).
+ */
+struct uint32_to_uint32 {
+    uint32_t operator()(uint32_t r) const
     {
-        return this->random_impl<R>(shape);
+        return r;
     }
+};
 
-    /**
-     * Generate a random integer \f$ 0 \leq r < bound \f$.
-     *
-     * @param high The upper bound of the random integers.
-     * @return Random number.
-     */
-    template <typename T>
-    T randint(T high)
-    {
-        PRRNG_ASSERT(high >= 0);
-        PRRNG_ASSERT(static_cast<uint32_t>(high) < std::numeric_limits<uint32_t>::max());
+/**
+ * @brief High and low 64 bits of the 128-bit product of two `uint64_t`.
+ *
+ * @param a First factor.
+ * @param b Second factor.
+ * @param lo Low 64 bits of the product (modified).
+ * @return High 64 bits of the product.
+ */
+inline uint64_t mul128(uint64_t a, uint64_t b, uint64_t* lo)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 m = static_cast<unsigned __int128>(a) * b;
+    *lo = static_cast<uint64_t>(m);
+    return static_cast<uint64_t>(m >> 64);
+#else
+    uint64_t a_lo = a & 0xffffffffu;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = b & 0xffffffffu;
+    uint64_t b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo;
+    uint64_t lh = a_lo * b_hi;
+    uint64_t hl = a_hi * b_lo;
+    uint64_t hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32) + (lh & 0xffffffffu) + (hl & 0xffffffffu);
+    *lo = (mid << 32) | (ll & 0xffffffffu);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
 
-        uint32_t ret;
-        this->draw_list_uint32(&ret, static_cast<uint32_t>(high), 1);
-        return static_cast<T>(ret);
-    }
+/**
+ * @brief Unbiased random integer \f$ 0 \leq r < bound \f$ from a random `uint32_t`,
+ * using the multiply-shift method with rejection of Lemire (2019),
+ * "Fast random integer generation in an interval", https://doi.org/10.1145/3230636.
+ * Contrary to the modulo-threshold method, a division is only needed with probability
+ * `bound / 2^32`, and so is a new random number (drawn using `next`).
+ *
+ * @param r Random number.
+ * @param bound Upper bound (`bound > 0`).
+ * @param next Function returning the next random `uint32_t`.
+ * @return Random integer.
+ */
+template <class F>
+inline uint32_t lemire_uint32(uint32_t r, uint32_t bound, F&& next)
+{
+    uint64_t m = static_cast<uint64_t>(r) * bound;
+    uint32_t l = static_cast<uint32_t>(m);
 
-    /**
-     * Generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
-     *
-     * @param shape The shape of the nd-array.
-     * @param high The upper bound of the random integers.
-     * @return The sample of shape `shape`.
-     */
-    template <class S, typename T>
-    auto randint(const S& shape, T high) -> typename detail::return_type<T, S>::type
-    {
-        using R = typename detail::return_type<T, S>::type;
-        return this->randint_impl<R>(shape, high);
+    if (l < bound) {
+        uint32_t threshold = (~bound + 1u) % bound;
+        while (l < threshold) {
+            m = static_cast<uint64_t>(next()) * bound;
+            l = static_cast<uint32_t>(m);
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class S, typename T>
-    R randint(const S& shape, T high)
-    {
-        return this->randint_impl<R>(shape, high);
+    return static_cast<uint32_t>(m >> 32);
+}
+
+/**
+ * @brief Unbiased random integer \f$ 0 \leq r < bound \f$ from a random `uint64_t`,
+ * see lemire_uint32().
+ *
+ * @param r Random number.
+ * @param bound Upper bound (`bound > 0`).
+ * @param next Function returning the next random `uint64_t`.
+ * @return Random integer.
+ */
+template <class F>
+inline uint64_t lemire_uint64(uint64_t r, uint64_t bound, F&& next)
+{
+    uint64_t l;
+    uint64_t h = mul128(r, bound, &l);
+
+    if (l < bound) {
+        uint64_t threshold = (~bound + 1u) % bound;
+        while (l < threshold) {
+            h = mul128(next(), bound, &l);
+        }
     }
 
+    return h;
+}
+
+/**
+ * @brief Functor of the lazily evaluated draws, e.g. prrng::GeneratorBase::lazy_random(),
+ * to be used in an `xt::xgenerator`.
+ *
+ * The expression has `n` random numbers per generator, stored row-major with the generators
+ * first. Evaluating the random number with flat index `i * n + j` draws number `j` from the
+ * copy of generator `i` (that is advanced or rewound if the entries are not evaluated in order).
+ * The evaluation of an entry is therefore of constant cost if the entries are evaluated in
+ * order, and the result does not depend on the order of evaluation.
+ *
+ * @warning Evaluation changes the (mutable) copies of the generators: it is not thread-safe.
+ *
+ * @tparam G Generator, e.g. prrng::pcg32 (requires `advance(int64_t)`).
+ * @tparam F Function drawing one number, called as `draw(generator)`.
+ */
+template <class G, class F>
+class lazy_draw {
+public:
+    using value_type = double; ///< Type of the entries.
+
     /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T)
+     * @param generators Copy of the generators (at the first number of the expression).
+     * @param shape Shape of the expression.
+     * @param n Number of random numbers per generator.
+     * @param draw Function drawing one number, called as `draw(generator)`.
      */
-    template <class I, std::size_t L, typename T>
-    auto randint(const I (&shape)[L], T high) -> typename detail::return_type_fixed<T, L>::type
+    template <class S>
+    lazy_draw(std::vector<G>&& generators, const S& shape, size_t n, F draw)
+        : m_gen(std::move(generators)), m_pos(m_gen.size(), 0), m_n(n), m_draw(draw)
     {
-        using R = typename detail::return_type_fixed<T, L>::type;
-        return this->randint_impl<R>(shape, high);
+        m_strides.resize(shape.size());
+        size_t stride = 1;
+
+        for (size_t d = shape.size(); d-- > 0;) {
+            m_strides[d] = stride;
+            stride *= static_cast<size_t>(shape[d]);
+        }
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T)
-     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     * @brief Entry at an array index.
+     * @param args Array index.
+     * @return Value.
      */
-    template <class R, class I, std::size_t L, typename T>
-    R randint(const I (&shape)[L], T high)
+    template <class... Args>
+    value_type operator()(Args... args) const
     {
-        return this->randint_impl<R>(shape, high);
+        std::array<size_t, sizeof...(Args)> index = {static_cast<size_t>(args)...};
+        return this->element(index.cbegin(), index.cend());
     }
 
     /**
-     * Generate an nd-array of random integers \f$ low \leq r < high \f$.
+     * @brief Entry at an array index.
+     * If there are more indices than dimensions, only the last indices are used (as broadcasting
+     * in xtensor), if there are fewer the first indices are taken zero.
      *
-     * @param shape The shape of the nd-array.
-     * @param low The lower bound of the random integers.
-     * @param high The upper bound of the random integers.
-     * @return The sample of shape `shape`.
+     * @param first Begin of the array index.
+     * @param last End of the array index.
+     * @return Value.
      */
-    template <class S, typename T, typename U>
-    auto randint(const S& shape, T low, U high) -> typename detail::return_type<T, S>::type
+    template <class It>
+    value_type element(It first, It last) const
     {
-        using R = typename detail::return_type<T, S>::type;
-        return this->randint_impl<R>(shape, low, high);
-    }
+        size_t n = static_cast<size_t>(std::distance(first, last));
+        size_t ndim = m_strides.size();
 
-    /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class S, typename T, typename U>
-    R randint(const S& shape, T low, U high)
-    {
-        return this->randint_impl<R>(shape, low, high);
-    }
+        if (n > ndim) {
+            std::advance(first, n - ndim);
+            n = ndim;
+        }
 
-    /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
-     */
-    template <class I, std::size_t L, typename T, typename U>
-    auto randint(const I (&shape)[L], T low, U high) ->
-        typename detail::return_type_fixed<T, L>::type
-    {
-        using R = typename detail::return_type_fixed<T, L>::type;
-        return this->randint_impl<R>(shape, low, high);
+        size_t index = 0;
+
+        for (size_t d = ndim - n; d < ndim; ++d, ++first) {
+            index += static_cast<size_t>(*first) * m_strides[d];
+        }
+
+        return this->at(index);
     }
 
+private:
     /**
-     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
-     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     * @brief Entry at a flat index.
+     * @param index Flat index.
+     * @return Value.
      */
-    template <class R, class I, std::size_t L, typename T, typename U>
-    R randint(const I (&shape)[L], T low, U high)
+    value_type at(size_t index) const
     {
-        return this->randint_impl<R>(shape, low, high);
+        size_t i = index / m_n;
+        size_t j = index % m_n;
+
+        if (j != m_pos[i]) {
+            m_gen[i].advance(static_cast<int64_t>(j) - static_cast<int64_t>(m_pos[i]));
+        }
+
+        m_pos[i] = j + 1;
+        return m_draw(m_gen[i]);
     }
 
-    /**
-     * Return a number distributed according to a delta distribution.
-     *
-     * @param scale The value of the 'peak' of the delta distribution.
-     * @return Random number.
+    mutable std::vector<G> m_gen; ///< Copy of the generators.
+    mutable std::vector<size_t> m_pos; ///< Index of the next number of each generator.
+    std::vector<size_t> m_strides; ///< Strides of the expression (row-major).
+    size_t m_n; ///< Number of random numbers per generator.
+    F m_draw; ///< Function drawing one number.
+};
+
+/**
+ * @brief Lazily evaluated draws, see prrng::detail::lazy_draw.
+ *
+ * @param generators Copy of the generators (at the first number of the expression).
+ * @param shape Shape of the expression (the shape of the generators followed by the shape of the
+ *      draws per generator).
+ * @param n Number of random numbers per generator.
+ * @param draw Function drawing one number, called as `draw(generator)`.
+ * @return `xt::xgenerator`.
+ */
+template <class G, class S, class F>
+inline auto make_lazy_draw(std::vector<G>&& generators, const S& shape, size_t n, F draw)
+{
+    lazy_draw<G, F> functor(std::move(generators), shape, n, draw);
+    return xt::detail::make_xgenerator(std::move(functor), shape);
+}
+
+} // namespace detail
+
+class pcg32_reference;
+
+/**
+ * Base class of the pseudorandom number generators providing common methods.
+ * If you want to implement a new generator, you should inherit from this class.
+ * The following minimal signature is required:
+ *
+ *      class MyGenerator : public GeneratorBase<MyGenerator> {
+ *      public:
+ *          // Return next random number [0, 1).
+ *          double next_double();
+ *
+ *          // Return next random number (0, 1).
+ *          double next_positive_double();
+ *
+ *          // Return next random number [0, 1) and (0, 1) in single precision.
+ *          float next_float();
+ *          float next_positive_float();
+ *
+ *          // Return next random number [0, 2^32).
+ *          uint32_t next_uint32();
+ *      };
+ *
+ * Output with value_type `float` is drawn using `next_float()` (or `next_positive_float()`):
+ * each random `uint32_t` is converted to one float. The distributions are then evaluated in
+ * double precision and rounded to float.
+ *
+ * The non-exact cumulative sums (e.g. `cumsum_normal(n, mu, sigma, false)`) in addition require
+ * `void advance(int64_t distance)`.
+ *
+ * @tparam Derived Derived class.
+ */
+template <class Derived>
+class GeneratorBase {
+public:
+    /**
+     * @brief Result of the cumulative sum of `n` random numbers.
+     * @param n Number of steps.
+     * @return Cumulative sum.
      */
-    double delta(double scale = 1)
+    double cumsum_random(size_t n)
     {
-        return scale;
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += static_cast<Derived*>(this)->next_double();
+        }
+        return ret;
     }
 
     /**
-     * Generate an nd-array of numbers that are delta distribution.
-     * These numbers are not random; calling this function does not change the state of the
-     * generators.
-     *
-     * @param shape The shape of the nd-array.
-     * @param scale The value of the 'peak' of the delta distribution.
-     * @return The sample of shape `shape`.
+     * @brief Result of the cumulative sum of `n` 'random' numbers, distributed according to a
+     * delta distribution,
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @return Cumulative sum.
      */
-    template <class S>
-    auto delta(const S& shape, double scale = 1) -> typename detail::return_type<double, S>::type
+    double cumsum_delta(size_t n, double scale = 1)
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->delta_impl<R>(shape, scale);
+        return static_cast<double>(n) * scale;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::delta(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to an
+     * exponential distribution, see exponential_distribution(),
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact
+     *      If `false`, draw only one random number and advance the generator such that in total
+     *      `n` numbers are drawn (the same state as for `exact = true`). The returned value is
+     *      then a sample of the distribution of the sum, not the sum of the skipped numbers.
+     * @return Cumulative sum.
      */
-    template <class R, class S>
-    R delta(const S& shape, double scale = 1)
+    double cumsum_exponential(size_t n, double scale = 1, bool exact = true)
     {
-        return this->delta_impl<R>(shape, scale);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_gamma(1.0, scale));
+        }
+
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret -= std::log(1.0 - static_cast<Derived*>(this)->next_double());
+        }
+        return scale * ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::delta(const S&, double)
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
+     * power distribution, see power_distribution(),
+     * @param n Number of steps.
+     * @param k Scale.
+     * @return Cumulative sum.
      */
-    template <class I, std::size_t L>
-    auto delta(const I (&shape)[L], double scale = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    double cumsum_power(size_t n, double k = 1)
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->delta_impl<R>(shape, scale);
+        double ret = 0.0;
+        double exponent = 1.0 / k;
+        for (size_t i = 0; i < n; ++i) {
+            ret += std::pow(1.0 - static_cast<Derived*>(this)->next_double(), exponent);
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::delta(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
+     * gamma distribution, see gamma_distribution(),
+     * @param n Number of steps.
+     * @param k Shape.
+     * @param scale Scale.
+     * @param exact
+     *      If `false`, draw only one random number and advance the generator such that in total
+     *      `n` numbers are drawn (the same state as for `exact = true`). The returned value is
+     *      then a sample of the distribution of the sum, not the sum of the skipped numbers.
+     * @return Cumulative sum.
      */
-    template <class R, class I, std::size_t L>
-    R delta(const I (&shape)[L], double scale = 1)
+    double cumsum_gamma(size_t n, double k = 1, double scale = 1, bool exact = true)
     {
-        return this->delta_impl<R>(shape, scale);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_gamma(k, scale));
+        }
+
+#if PRRNG_USE_BOOST
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += boost::math::gamma_p_inv<double, double>(
+                k, static_cast<Derived*>(this)->next_double()
+            );
+        }
+        return scale * ret;
+#else
+        return std::numeric_limits<double>::quiet_NaN();
+#endif
     }
 
     /**
-     * Return a random number distributed according to an exponential distribution.
-     *
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
+     * Pareto distribution, see pareto_distribution(),
+     * @param n Number of steps.
+     * @param k Shape.
      * @param scale Scale.
-     * @return Random number.
+     * @return Cumulative sum.
      */
-    double exponential(double scale = 1)
+    double cumsum_pareto(size_t n, double k = 1, double scale = 1)
     {
-        return -std::log(1.0 - static_cast<Derived*>(this)->next_double()) * scale;
+        double ret = 0.0;
+        double exponent = -1.0 / k;
+        for (size_t i = 0; i < n; ++i) {
+            ret += std::pow(1.0 - static_cast<Derived*>(this)->next_double(), exponent);
+        }
+        return scale * ret;
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to an exponential distribution.
-     *
-     * @param shape The shape of the nd-array.
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
+     * weibull distribution, see weibull_distribution(),
+     * @param n Number of steps.
+     * @param k Shape.
      * @param scale Scale.
-     * @return The sample of shape `shape`.
+     * @return Cumulative sum.
      */
-    template <class S>
-    auto exponential(const S& shape, double scale = 1) ->
-        typename detail::return_type<double, S>::type
+    double cumsum_weibull(size_t n, double k = 1, double scale = 1)
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->exponential_impl<R>(shape, scale);
+        double ret = 0.0;
+        double k_inv = 1.0 / k;
+        for (size_t i = 0; i < n; ++i) {
+            ret += std::pow(-std::log(1.0 - static_cast<Derived*>(this)->next_double()), k_inv);
+        }
+        return scale * ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to a
+     * normal distribution, see normal_distribution(),
+     * @param n Number of steps.
+     * @param mu Mean.
+     * @param sigma Standard deviation.
+     * @param exact
+     *      If `false`, draw only one random number and advance the generator such that in total
+     *      `n` numbers are drawn (the same state as for `exact = true`). The returned value is
+     *      then a sample of the distribution of the sum, not the sum of the skipped numbers.
+     * @return Cumulative sum.
      */
-    template <class R, class S>
-    R exponential(const S& shape, double scale = 1)
+    double cumsum_normal(size_t n, double mu = 0, double sigma = 1, bool exact = true)
     {
-        return this->exponential_impl<R>(shape, scale);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_normal(mu, sigma));
+        }
+
+#if PRRNG_USE_BOOST
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += boost::math::erf_inv<double>(
+                2.0 * static_cast<Derived*>(this)->next_double() - 1.0
+            );
+        }
+        return static_cast<double>(n) * mu + sigma * std::sqrt(2.0) * ret;
+#else
+        return std::numeric_limits<double>::quiet_NaN();
+#endif
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * a normal distribution, see fast_normal(double, double).
+     * @param n Number of steps.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param exact See cumsum_normal().
+     * @return Cumulative sum.
      */
-    template <class I, std::size_t L>
-    auto exponential(const I (&shape)[L], double scale = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    double cumsum_fast_normal(size_t n, double mu = 0, double sigma = 1, bool exact = true)
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->exponential_impl<R>(shape, scale);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_normal(mu, sigma));
+        }
+
+        auto convert = detail::uint32_to_fast_normal(mu, sigma);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * an exponential distribution, see fast_exponential(double).
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See cumsum_exponential().
+     * @return Cumulative sum.
      */
-    template <class R, class I, std::size_t L>
-    R exponential(const I (&shape)[L], double scale = 1)
+    double cumsum_fast_exponential(size_t n, double scale = 1, bool exact = true)
     {
-        return this->exponential_impl<R>(shape, scale);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_gamma(1.0, scale));
+        }
+
+        auto convert = detail::uint32_to_fast_exponential(scale);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * Return a random number distributed according to an power distribution.
-     *
-     * @param k Scale.
-     * @return Random number.
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * a gamma distribution, see fast_gamma(double, double).
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See cumsum_gamma().
+     * @return Cumulative sum.
      */
-    double power(double k = 1)
+    double cumsum_fast_gamma(size_t n, double k = 1, double scale = 1, bool exact = true)
     {
-        return std::pow(1.0 - static_cast<Derived*>(this)->next_double(), 1.0 / k);
+        if (!exact) {
+            return this->cumsum_skip(n, detail::cumsum_skip_gamma(k, scale));
+        }
+
+        auto convert = detail::uint32_to_fast_gamma(k, scale);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to an power distribution.
-     *
-     * @param shape The shape of the nd-array.
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * a power distribution, see fast_power(double).
+     * @param n Number of steps.
      * @param k Scale.
-     * @return The sample of shape `shape`.
+     * @return Cumulative sum.
      */
-    template <class S>
-    auto power(const S& shape, double k = 1) -> typename detail::return_type<double, S>::type
+    double cumsum_fast_power(size_t n, double k = 1)
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->power_impl<R>(shape, k);
+        auto convert = detail::uint32_to_fast_power(k);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::power(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * a Pareto distribution, see fast_pareto(double, double).
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
      */
-    template <class R, class S>
-    R power(const S& shape, double k = 1)
+    double cumsum_fast_pareto(size_t n, double k = 1, double scale = 1)
     {
-        return this->power_impl<R>(shape, k);
+        auto convert = detail::uint32_to_fast_pareto(k, scale);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::power(const S&, double)
+     * @brief Result of the cumulative sum of `n` random numbers, distributed according to
+     * a Weibull distribution, see fast_weibull(double, double).
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
      */
-    template <class I, std::size_t L>
-    auto power(const I (&shape)[L], double k = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    double cumsum_fast_weibull(size_t n, double k = 1, double scale = 1)
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->power_impl<R>(shape, k);
+        auto convert = detail::uint32_to_fast_weibull(k, scale);
+        double ret = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            ret += convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::power(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * Draw uniformly distributed permutation and permute the given STL container.
+     *
+     * @param begin Iterator to the beginning of the container.
+     * @param end Iterator to the end of the container.
+     *
+     * @note From: Knuth, TAoCP Vol. 2 (3rd 3d), Section 3.4.2
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
      */
-    template <class R, class I, std::size_t L>
-    R power(const I (&shape)[L], double k = 1)
+    template <typename Iterator>
+    void shuffle(Iterator begin, Iterator end)
     {
-        return this->power_impl<R>(shape, k);
+        for (Iterator it = end - 1; it > begin; --it) {
+            std::iter_swap(
+                it, begin + static_cast<Derived*>(this)->next_uint32((uint32_t)(it - begin + 1))
+            );
+        }
     }
 
     /**
-     * Return a random number distributed according to a Gamma distribution.
+     * @brief Decide based on probability per value.
+     * This is fully equivalent to `generator.random(p.shape) < p`,
+     * but avoids the memory allocation of `random`.
      *
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return Random number.
+     * @param p Probability per value [0, 1].
+     * @return Decision for each `p`.
      */
-    double gamma(double k = 1, double scale = 1)
+    template <class P>
+    auto decide(const P& p) -> typename detail::return_type<bool, P>::type
     {
-#if PRRNG_USE_BOOST
-        return scale * boost::math::gamma_p_inv<double, double>(
-                           k, static_cast<Derived*>(this)->next_double()
-                       );
-#else
-        return std::numeric_limits<double>::quiet_NaN();
-#endif
+        using R = typename detail::return_type<bool, P>::type;
+        R ret = xt::empty<bool>(p.shape());
+        this->decide(p, ret);
+        return ret;
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to a Gamma distribution.
-     * Only available when compiled with PRRNG_USE_BOOST.
+     * @copydoc prrng::GeneratorBase::decide(const P&)
+     */
+    template <class P, class R>
+    R decide(const P& p)
+    {
+        using value_type = typename detail::get_value_type<R>::type;
+        R ret = xt::empty<value_type>(p.shape());
+        this->decide(p, ret);
+        return ret;
+    }
+
+    /**
+     * @brief Decide based on probability per value.
+     * This is fully equivalent to `generator.random(p.shape) < p`,
+     * but avoids the memory allocation of `random`.
      *
-     * @param shape The shape of the nd-array.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return The sample of shape `shape`.
+     * @param p Probability per value [0, 1].
+     * @param ret Decision for each ``p``.
      */
-    template <class S>
-    auto gamma(const S& shape, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, S>::type
+    template <class P, class R>
+    void decide(const P& p, R& ret)
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->gamma_impl<R>(shape, k, scale);
+        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
+        using value_type = typename detail::get_value_type<R>::type;
+
+        for (size_t i = 0; i < p.size(); ++i) {
+            if (static_cast<Derived*>(this)->next_double() < p.flat(i)) {
+                ret.flat(i) = static_cast<value_type>(true);
+            }
+            else {
+                ret.flat(i) = static_cast<value_type>(false);
+            }
+        }
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Decide based on probability per value.
+     * This is fully equivalent to `generator.random(p.shape) < p`,
+     * but avoids the memory allocation of `random`.
+     *
+     * @param p Probability per value [0, 1].
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @return Decision for each `p`.
      */
-    template <class R, class S>
-    R gamma(const S& shape, double k = 1, double scale = 1)
+    template <class P, class T>
+    auto decide_masked(const P& p, const T& mask) -> typename detail::return_type<bool, P>::type
     {
-        return this->gamma_impl<R>(shape, k, scale);
+        using R = typename detail::return_type<bool, P>::type;
+        R ret = xt::empty<bool>(p.shape());
+        this->decide_masked(p, mask, ret);
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::decide_masked(const P&, const T&)
      */
-    template <class I, std::size_t L>
-    auto gamma(const I (&shape)[L], double k = 1, double scale = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    template <class P, class T, class R>
+    R decide_masked(const P& p, const T& mask)
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->gamma_impl<R>(shape, k, scale);
+        using value_type = typename detail::get_value_type<R>::type;
+        R ret = xt::empty<value_type>(p.shape());
+        this->decide_masked(p, mask, ret);
+        return ret;
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Decide based on probability per value.
+     * This is fully equivalent to `generator.random(p.shape) < p`,
+     * but avoids the memory allocation of `random`.
+     *
+     * @param p Probability per value [0, 1].
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @param ret Decision for each ``p``.
      */
-    template <class R, class I, std::size_t L>
-    R gamma(const I (&shape)[L], double k = 1, double scale = 1)
+    template <class P, class T, class R>
+    void decide_masked(const P& p, const T& mask, R& ret)
     {
-        return this->gamma_impl<R>(shape, k, scale);
+        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
+        using value_type = typename detail::get_value_type<R>::type;
+
+        for (size_t i = 0; i < p.size(); ++i) {
+            if (mask.flat(i)) {
+                ret.flat(i) = static_cast<value_type>(false);
+            }
+            else if (static_cast<Derived*>(this)->next_double() < p.flat(i)) {
+                ret.flat(i) = static_cast<value_type>(true);
+            }
+            else {
+                ret.flat(i) = static_cast<value_type>(false);
+            }
+        }
     }
 
     /**
-     * Return a random number distributed according to a Pareto distribution.
+     * Generate a random number \f$ 0 \leq r \leq 1 \f$.
      *
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
      * @return Random number.
      */
-    double pareto(double k = 1, double scale = 1)
+    double random()
     {
-        return scale * std::pow(1.0 - static_cast<Derived*>(this)->next_double(), -1.0 / k);
+        return static_cast<Derived*>(this)->next_double();
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to a Pareto distribution.
+     * Generate an nd-array of random numbers \f$ 0 \leq r \leq 1 \f$.
      *
      * @param shape The shape of the nd-array.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
      * @return The sample of shape `shape`.
      */
     template <class S>
-    auto pareto(const S& shape, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, S>::type
+    auto random(const S& shape) -> typename detail::return_type<double, S>::type
     {
         using R = typename detail::return_type<double, S>::type;
-        return this->pareto_impl<R>(shape, k, scale);
+        return this->random_impl<R>(shape);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::random(const S&)
      * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
     template <class R, class S>
-    R pareto(const S& shape, double k = 1, double scale = 1)
+    R random(const S& shape)
     {
-        return this->pareto_impl<R>(shape, k, scale);
+        return this->random_impl<R>(shape);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::random(const S&)
      */
     template <class I, std::size_t L>
-    auto pareto(const I (&shape)[L], double k = 1, double scale = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    auto random(const I (&shape)[L]) -> typename detail::return_type_fixed<double, L>::type
     {
         using R = typename detail::return_type_fixed<double, L>::type;
-        return this->pareto_impl<R>(shape, k, scale);
+        return this->random_impl<R>(shape);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::random(const S&)
      * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
     template <class R, class I, std::size_t L>
-    R pareto(const I (&shape)[L], double k = 1, double scale = 1)
+    R random(const I (&shape)[L])
     {
-        return this->pareto_impl<R>(shape, k, scale);
+        return this->random_impl<R>(shape);
     }
 
     /**
-     * Return a random number distributed according to a Weibull distribution.
+     * Generate a random integer \f$ 0 \leq r < bound \f$.
      *
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
+     * @param high The upper bound of the random integers.
      * @return Random number.
      */
-    double weibull(double k = 1, double scale = 1)
+    template <typename T>
+    T randint(T high)
     {
-        return scale *
-               std::pow(-std::log(1.0 - static_cast<Derived*>(this)->next_double()), 1.0 / k);
+        PRRNG_ASSERT(high >= 0);
+        PRRNG_ASSERT(static_cast<uint32_t>(high) < std::numeric_limits<uint32_t>::max());
+
+        uint32_t ret;
+        this->draw_list_uint32(&ret, static_cast<uint32_t>(high), 1);
+        return static_cast<T>(ret);
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to a Weibull distribution.
+     * Generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
      *
      * @param shape The shape of the nd-array.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
+     * @param high The upper bound of the random integers.
      * @return The sample of shape `shape`.
      */
-    template <class S>
-    auto weibull(const S& shape, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, S>::type
+    template <class S, typename T>
+    auto randint(const S& shape, T high) -> typename detail::return_type<T, S>::type
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->weibull_impl<R>(shape, k, scale);
+        using R = typename detail::return_type<T, S>::type;
+        return this->randint_impl<R>(shape, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::randint(const S&, T)
      * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <class R, class S>
-    R weibull(const S& shape, double k = 1, double scale = 1)
+    template <class R, class S, typename T>
+    R randint(const S& shape, T high)
     {
-        return this->weibull_impl<R>(shape, k, scale);
+        return this->randint_impl<R>(shape, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::randint(const S&, T)
      */
-    template <class I, std::size_t L>
-    auto weibull(const I (&shape)[L], double k = 1, double scale = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    template <class I, std::size_t L, typename T>
+    auto randint(const I (&shape)[L], T high) -> typename detail::return_type_fixed<T, L>::type
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->weibull_impl<R>(shape, k, scale);
+        using R = typename detail::return_type_fixed<T, L>::type;
+        return this->randint_impl<R>(shape, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::GeneratorBase::randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
      */
-    template <class R, class I, std::size_t L>
-    R weibull(const I (&shape)[L], double k = 1, double scale = 1)
-    {
-        return this->weibull_impl<R>(shape, k, scale);
-    }
-
-    /**
-     * Return a random number distributed according to a normal distribution.
-     *
-     * @param mu The average.
-     * @param sigma The standard deviation.
-     * @return Random number.
-     */
-    double normal(double mu = 0, double sigma = 1)
+    template <class R, class I, std::size_t L, typename T>
+    R randint(const I (&shape)[L], T high)
     {
-#if PRRNG_USE_BOOST
-        return mu + sigma * std::sqrt(2.0) *
-                        boost::math::erf_inv<double>(
-                            2.0 * static_cast<Derived*>(this)->next_positive_double() - 1.0
-                        );
-#else
-        return std::numeric_limits<double>::quiet_NaN();
-#endif
+        return this->randint_impl<R>(shape, high);
     }
 
     /**
-     * Generate an nd-array of random numbers distributed according to a normal distribution.
+     * Generate an nd-array of random integers \f$ low \leq r < high \f$.
      *
      * @param shape The shape of the nd-array.
-     * @param mu The average.
-     * @param sigma The standard deviation.
+     * @param low The lower bound of the random integers.
+     * @param high The upper bound of the random integers.
      * @return The sample of shape `shape`.
      */
-    template <class S>
-    auto normal(const S& shape, double mu = 0, double sigma = 1) ->
-        typename detail::return_type<double, S>::type
+    template <class S, typename T, typename U>
+    auto randint(const S& shape, T low, U high) -> typename detail::return_type<T, S>::type
     {
-        using R = typename detail::return_type<double, S>::type;
-        return this->normal_impl<R>(shape, mu, sigma);
+        using R = typename detail::return_type<T, S>::type;
+        return this->randint_impl<R>(shape, low, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
      * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <class R, class S>
-    R normal(const S& shape, double mu = 0, double sigma = 1)
+    template <class R, class S, typename T, typename U>
+    R randint(const S& shape, T low, U high)
     {
-        return this->normal_impl<R>(shape, mu, sigma);
+        return this->randint_impl<R>(shape, low, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
+     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
      */
-    template <class I, std::size_t L>
-    auto normal(const I (&shape)[L], double mu = 0, double sigma = 1) ->
-        typename detail::return_type_fixed<double, L>::type
+    template <class I, std::size_t L, typename T, typename U>
+    auto randint(const I (&shape)[L], T low, U high) ->
+        typename detail::return_type_fixed<T, L>::type
     {
-        using R = typename detail::return_type_fixed<double, L>::type;
-        return this->normal_impl<R>(shape, mu, sigma);
+        using R = typename detail::return_type_fixed<T, L>::type;
+        return this->randint_impl<R>(shape, low, high);
     }
 
     /**
-     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::GeneratorBase::randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
      */
-    template <class R, class I, std::size_t L>
-    R normal(const I (&shape)[L], double mu = 0, double sigma = 1)
+    template <class R, class I, std::size_t L, typename T, typename U>
+    R randint(const I (&shape)[L], T low, U high)
     {
-        return this->normal_impl<R>(shape, mu, sigma);
+        return this->randint_impl<R>(shape, low, high);
     }
 
     /**
-     * @brief Get a random number according to some distribution.
+     * Generate a random `uint64_t` by combining two consecutive random numbers `(r0 << 32) | r1`.
      *
-     * @param distribution Type of distribution, see prrg::distribution.
-     * @param parameters Parameters for the distribution, see prrng::default_parameters.
-     * @param append_default Append default parameters to `parameters`.
+     * @return Random number.
      */
-    double draw(
-        enum prrng::distribution distribution,
-        std::vector<double> parameters = std::vector<double>{},
-        bool append_default = true
-    )
+    uint64_t next_uint64()
     {
-        if (append_default) {
-            parameters = default_parameters(distribution, parameters);
-        }
-        else {
-            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
-        }
-
-        switch (distribution) {
-        case prrng::distribution::random:
-            return this->random() * parameters[0] + parameters[1];
-        case prrng::distribution::delta:
-            return this->delta(parameters[0]) + parameters[1];
-        case prrng::distribution::exponential:
-            return this->exponential(parameters[0]) + parameters[1];
-        case prrng::distribution::power:
-            return this->power(parameters[0]) + parameters[1];
-        case prrng::distribution::pareto:
-            return this->pareto(parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::weibull:
-            return this->weibull(parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::gamma:
-            return this->gamma(parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::normal:
-            return this->normal(parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::custom:
-            throw std::runtime_error("Unknown distribution");
-        }
-
-        throw std::runtime_error("Unknown distribution");
+        uint64_t hi = static_cast<Derived*>(this)->next_uint32();
+        uint64_t lo = static_cast<Derived*>(this)->next_uint32();
+        return (hi << 32) | lo;
     }
 
     /**
-     * @brief Get an nd-array of random numbers according to some distribution.
+     * Generate a random integer \f$ 0 \leq r < bound \f$ from next_uint64(),
+     * see detail::lemire_uint64().
      *
-     * @param shape The shape of the nd-array.
-     * @param distribution Type of distribution, see prrg::distribution.
-     * @param parameters Parameters for the distribution, see prrng::default_parameters.
-     * @param append_default Append default parameters to `parameters`.s
+     * @param bound The upper bound of the random integers.
+     * @return Random number.
      */
-    template <class R, class S>
-    R draw(
-        const S& shape,
-        enum prrng::distribution distribution,
-        std::vector<double> parameters = std::vector<double>{},
-        bool append_default = true
-    )
+    uint64_t next_uint64(uint64_t bound)
     {
-        if (append_default) {
-            parameters = default_parameters(distribution, parameters);
-        }
-        else {
-            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
-        }
-
-        switch (distribution) {
-        case prrng::distribution::random:
-            return this->random<R>(shape) * parameters[0] + parameters[1];
-        case prrng::distribution::delta:
-            return this->delta<R>(shape, parameters[0]) + parameters[1];
-        case prrng::distribution::exponential:
-            return this->exponential<R>(shape, parameters[0]) + parameters[1];
-        case prrng::distribution::power:
-            return this->power<R>(shape, parameters[0]) + parameters[1];
-        case prrng::distribution::pareto:
-            return this->pareto<R>(shape, parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::weibull:
-            return this->weibull<R>(shape, parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::gamma:
-            return this->gamma<R>(shape, parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::normal:
-            return this->normal<R>(shape, parameters[0], parameters[1]) + parameters[2];
-        case prrng::distribution::custom:
-            throw std::runtime_error("Unknown distribution");
-        }
-
-        throw std::runtime_error("Unknown distribution");
+        PRRNG_ASSERT(bound > 0);
+        return detail::lemire_uint64(this->next_uint64(), bound, [this]() {
+            return this->next_uint64();
+        });
     }
 
     /**
-     * @brief Get the cumulative sum of `n` random numbers according to some distribution.
+     * Generate a random integer \f$ 0 \leq r < high \f$ using the multiply-shift method,
+     * see detail::lemire_uint32(), which avoids divisions in almost all cases.
+     * The result is equally unbiased as randint(), but the sequence is different.
+     * If `high` does not fit in `uint32_t`, each random integer uses two random numbers,
+     * see next_uint64(uint64_t).
      *
-     * @param n Number of random numbers to sum.
-     * @param distribution Type of distribution, see prrg::distribution.
-     * @param parameters Parameters for the distribution, see prrng::default_parameters.
-     * @param append_default Append default parameters to `parameters`.
+     * @param high The upper bound of the random integers.
+     * @return Random number.
      */
-    double cumsum(
-        size_t n,
-        enum prrng::distribution distribution,
-        std::vector<double> parameters = std::vector<double>{},
-        bool append_default = true
-    )
+    template <typename T>
+    T fast_randint(T high)
     {
-        if (append_default) {
-            parameters = default_parameters(distribution, parameters);
-        }
-        else {
-            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
-        }
-
-        double m = static_cast<double>(n);
-
-        switch (distribution) {
-        case prrng::distribution::random:
-            return this->cumsum_random(n) * parameters[0] + m * parameters[1];
-        case prrng::distribution::delta:
-            return this->cumsum_delta(n, parameters[0]) + m * parameters[1];
-        case prrng::distribution::exponential:
-            return this->cumsum_exponential(n, parameters[0]) + m * parameters[1];
-        case prrng::distribution::power:
-            return this->cumsum_power(n, parameters[0]) + m * parameters[1];
-        case prrng::distribution::pareto:
-            return this->cumsum_pareto(n, parameters[0], parameters[1]) + m * parameters[2];
-        case prrng::distribution::weibull:
-            return this->cumsum_weibull(n, parameters[0], parameters[1]) + m * parameters[2];
-        case prrng::distribution::gamma:
-            return this->cumsum_gamma(n, parameters[0], parameters[1]) + m * parameters[2];
-        case prrng::distribution::normal:
-            return this->cumsum_normal(n, parameters[0], parameters[1]) + m * parameters[2];
-        case prrng::distribution::custom:
-            throw std::runtime_error("Unknown distribution");
-        }
-
-        throw std::runtime_error("Unknown distribution");
+        PRRNG_ASSERT(high > 0);
+        return static_cast<T>(this->next_bounded(static_cast<uint64_t>(high)));
     }
 
-private:
-    void draw_list_double(double* data, size_t n)
+    /**
+     * Generate an nd-array of random integers \f$ 0 \leq r < high \f$,
+     * see fast_randint(T).
+     *
+     * @param shape The shape of the nd-array.
+     * @param high The upper bound of the random integers.
+     * @return The sample of shape `shape`.
+     */
+    template <class S, typename T>
+    auto fast_randint(const S& shape, T high) -> typename detail::return_type<T, S>::type
     {
-        for (size_t i = 0; i < n; ++i) {
-            data[i] = static_cast<Derived*>(this)->next_double();
-        }
+        using R = typename detail::return_type<T, S>::type;
+        return this->fast_randint_impl<R>(shape, T(0), high);
     }
 
-    void draw_list_positive_double(double* data, size_t n)
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     */
+    template <class R, class S, typename T>
+    R fast_randint(const S& shape, T high)
     {
-        for (size_t i = 0; i < n; ++i) {
-            data[i] = static_cast<Derived*>(this)->next_positive_double();
-        }
+        return this->fast_randint_impl<R>(shape, T(0), high);
     }
 
-    void draw_list_uint32(uint32_t* data, uint32_t bound, size_t n)
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T)
+     */
+    template <class I, std::size_t L, typename T>
+    auto fast_randint(const I (&shape)[L], T high) ->
+        typename detail::return_type_fixed<T, L>::type
     {
-        for (size_t i = 0; i < n; ++i) {
-            data[i] = static_cast<Derived*>(this)->next_uint32(bound);
-        }
+        using R = typename detail::return_type_fixed<T, L>::type;
+        return this->fast_randint_impl<R>(shape, T(0), high);
     }
 
-    template <class R, class S>
-    R positive_random_impl(const S& shape)
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T>
+    R fast_randint(const I (&shape)[L], T high)
     {
-        static_assert(
-            std::is_same<typename detail::allocate_return<R>::value_type, double>::value,
-            "Return value_type must be double"
-        );
-
-        detail::allocate_return<R> ret(shape);
-        this->draw_list_positive_double(ret.data(), ret.size());
-        return std::move(ret.value);
+        return this->fast_randint_impl<R>(shape, T(0), high);
     }
 
-    template <class R, class S>
-    R random_impl(const S& shape)
+    /**
+     * Generate an nd-array of random integers \f$ low \leq r < high \f$,
+     * see fast_randint(T).
+     *
+     * @param shape The shape of the nd-array.
+     * @param low The lower bound of the random integers.
+     * @param high The upper bound of the random integers.
+     * @return The sample of shape `shape`.
+     */
+    template <class S, typename T, typename U>
+    auto fast_randint(const S& shape, T low, U high) -> typename detail::return_type<T, S>::type
     {
-        static_assert(
-            std::is_same<typename detail::allocate_return<R>::value_type, double>::value,
-            "Return value_type must be double"
-        );
-
-        detail::allocate_return<R> ret(shape);
-        this->draw_list_double(ret.data(), ret.size());
-        return std::move(ret.value);
+        using R = typename detail::return_type<T, S>::type;
+        return this->fast_randint_impl<R>(shape, low, high);
     }
 
-    template <class R, class S, typename T>
-    R randint_impl(const S& shape, T high)
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<int64_t, 1>`
+     */
+    template <class R, class S, typename T, typename U>
+    R fast_randint(const S& shape, T low, U high)
     {
-        static_assert(
-            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
-                std::numeric_limits<T>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
-
-        PRRNG_ASSERT(high >= 0);
-        PRRNG_ASSERT(static_cast<uint32_t>(high) < std::numeric_limits<uint32_t>::max());
-
-        detail::allocate_return<R> ret(shape);
-        std::vector<uint32_t> tmp(ret.size());
-        this->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high), ret.size());
-        std::copy(tmp.begin(), tmp.end(), ret.data());
-        return std::move(ret.value);
+        return this->fast_randint_impl<R>(shape, low, high);
     }
 
-    template <class R, class S, typename T, typename U>
-    R randint_impl(const S& shape, T low, U high)
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T, U)
+     */
+    template <class I, std::size_t L, typename T, typename U>
+    auto fast_randint(const I (&shape)[L], T low, U high) ->
+        typename detail::return_type_fixed<T, L>::type
     {
-        static_assert(
-            std::numeric_limits<typename detail::allocate_return<R>::value_type>::min() >=
-                std::numeric_limits<T>::min(),
-            "Return value_type must must be able to accommodate the bound"
-        );
-
-        static_assert(
-            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
-                std::numeric_limits<T>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
-
-        static_assert(
-            std::numeric_limits<typename detail::allocate_return<R>::value_type>::min() >=
-                std::numeric_limits<U>::min(),
-            "Return value_type must must be able to accommodate the bound"
-        );
-
-        static_assert(
-            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
-                std::numeric_limits<U>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        using R = typename detail::return_type_fixed<T, L>::type;
+        return this->fast_randint_impl<R>(shape, low, high);
+    }
 
-        PRRNG_ASSERT(high - low >= 0);
-        PRRNG_ASSERT(static_cast<uint32_t>(high - low) < std::numeric_limits<uint32_t>::max());
+    /**
+     * @copydoc prrng::GeneratorBase::fast_randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<int64_t, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T, typename U>
+    R fast_randint(const I (&shape)[L], T low, U high)
+    {
+        return this->fast_randint_impl<R>(shape, low, high);
+    }
 
-        detail::allocate_return<R> ret(shape);
-        std::vector<uint32_t> tmp(ret.size());
-        this->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high - low), ret.size());
-        std::copy(tmp.begin(), tmp.end(), ret.data());
-        return ret.value + low;
+    /**
+     * Return a number distributed according to a delta distribution.
+     *
+     * @param scale The value of the 'peak' of the delta distribution.
+     * @return Random number.
+     */
+    double delta(double scale = 1)
+    {
+        return scale;
     }
 
-    template <class R, class S>
-    R delta_impl(const S& shape, double scale)
+    /**
+     * Generate an nd-array of numbers that are delta distribution.
+     * These numbers are not random; calling this function does not change the state of the
+     * generators.
+     *
+     * @param shape The shape of the nd-array.
+     * @param scale The value of the 'peak' of the delta distribution.
+     * @return The sample of shape `shape`.
+     */
+    template <class S>
+    auto delta(const S& shape, double scale = 1) -> typename detail::return_type<double, S>::type
     {
-        detail::allocate_return<R> ret(shape);
-        ret.value.fill(scale);
-        return std::move(ret.value);
+        using R = typename detail::return_type<double, S>::type;
+        return this->delta_impl<R>(shape, scale);
     }
 
+    /**
+     * @copydoc prrng::GeneratorBase::delta(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
     template <class R, class S>
-    R exponential_impl(const S& shape, double scale)
+    R delta(const S& shape, double scale = 1)
     {
-        R r = this->random_impl<R>(shape);
-        return exponential_distribution(scale).quantile(r);
+        return this->delta_impl<R>(shape, scale);
     }
 
-    template <class R, class S>
-    R power_impl(const S& shape, double k)
+    /**
+     * @copydoc prrng::GeneratorBase::delta(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto delta(const I (&shape)[L], double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        R r = this->random_impl<R>(shape);
-        return power_distribution(k).quantile(r);
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->delta_impl<R>(shape, scale);
     }
 
-    template <class R, class S>
-    R gamma_impl(const S& shape, double k, double scale)
+    /**
+     * @copydoc prrng::GeneratorBase::delta(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R delta(const I (&shape)[L], double scale = 1)
     {
-        R r = this->random_impl<R>(shape);
-        return gamma_distribution(k, scale).quantile(r);
+        return this->delta_impl<R>(shape, scale);
     }
 
-    template <class R, class S>
-    R pareto_impl(const S& shape, double k, double scale)
+    /**
+     * Return a random number distributed according to an exponential distribution.
+     *
+     * @param scale Scale.
+     * @return Random number.
+     */
+    double exponential(double scale = 1)
     {
-        R r = this->random_impl<R>(shape);
-        return pareto_distribution(k, scale).quantile(r);
+        return -std::log(1.0 - static_cast<Derived*>(this)->next_double()) * scale;
     }
 
-    template <class R, class S>
-    R weibull_impl(const S& shape, double k, double scale)
+    /**
+     * Generate an nd-array of random numbers distributed according to an exponential distribution.
+     *
+     * @param shape The shape of the nd-array.
+     * @param scale Scale.
+     * @return The sample of shape `shape`.
+     */
+    template <class S>
+    auto exponential(const S& shape, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        R r = this->random_impl<R>(shape);
-        return weibull_distribution(k, scale).quantile(r);
+        using R = typename detail::return_type<double, S>::type;
+        return this->exponential_impl<R>(shape, scale);
     }
 
+    /**
+     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
     template <class R, class S>
-    R normal_impl(const S& shape, double mu, double sigma)
+    R exponential(const S& shape, double scale = 1)
     {
-        R r = this->positive_random_impl<R>(shape);
-        return normal_distribution(mu, sigma).quantile(r);
+        return this->exponential_impl<R>(shape, scale);
     }
-};
 
-/**
- * Random number generate using the pcg32 algorithm.
- * The class generate random 32-bit random numbers (of type `uint32_t`).
- * In addition, they can be converted to nd-arrays of random floating-point numbers (according)
- * using derived methods from Generate().
- *
- * The algorithm is full based on:
- *
- *     The PCG random number generator was developed by Melissa O'Neill
- *     <oneill@pcg-random.org>
- *
- *     Licensed under the Apache License, Version 2.0 (the "License");
- *     you may not use this file except in compliance with the License.
- *     You may obtain a copy of the License at
- *
- *         http://www.apache.org/licenses/LICENSE-2.0
- *
- *     Unless required by applicable law or agreed to in writing, software
- *     distributed under the License is distributed on an "AS IS" BASIS,
- *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- *     See the License for the specific language governing permissions and
- *     limitations under the License.
- *
- *     For additional information about the PCG random number generation scheme,
- *     including its license and other licensing options, visit
- *
- *         http://www.pcg-random.org
- *
- * Whereby most code is taken from the follow wrapper:
- *
- *     Wenzel Jakob, February 2015
- *     https://github.com/wjakob/pcg32
- */
-class pcg32 : public GeneratorBase<pcg32> {
-public:
     /**
-     * Constructor.
-     *
-     * @param initstate State initiator.
-     * @param initseq Sequence initiator.
+     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
      */
-    template <typename T = uint64_t, typename S = uint64_t>
-    pcg32(T initstate = PRRNG_PCG32_INITSTATE, S initseq = PRRNG_PCG32_INITSEQ)
+    template <class I, std::size_t L>
+    auto exponential(const I (&shape)[L], double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
-        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
-        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->exponential_impl<R>(shape, scale);
     }
 
     /**
-     * @brief Seed the generator (constructor alias).
-     *
-     * @param initstate Initial state.
-     * @param initseq Initial sequence.
+     * @copydoc prrng::GeneratorBase::exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void seed(uint64_t initstate = PRRNG_PCG32_INITSTATE, uint64_t initseq = PRRNG_PCG32_INITSEQ)
+    template <class R, class I, std::size_t L>
+    R exponential(const I (&shape)[L], double scale = 1)
     {
-        m_initstate = initstate;
-        m_initseq = initseq;
-
-        m_state = 0U;
-        m_inc = (initseq << 1u) | 1u;
-        (*this)();
-        m_state += initstate;
-        (*this)();
+        return this->exponential_impl<R>(shape, scale);
     }
 
     /**
-     * Draw new random number (uniformly distributed, `0 <= r <= max(uint32_t)`).
-     * This advances the state of the generator by one increment.
-     *
-     * @return Next random number in sequence.
+     * Return a random number distributed according to an power distribution.
      *
-     * @author Melissa O'Neill, http://www.pcg-random.org.
+     * @param k Scale.
+     * @return Random number.
      */
-    uint32_t operator()()
+    double power(double k = 1)
     {
-        uint64_t oldstate = m_state;
-        m_state = oldstate * PRRNG_PCG32_MULT + m_inc;
-        uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-        uint32_t rot = oldstate >> 59u;
-        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+        return std::pow(1.0 - static_cast<Derived*>(this)->next_double(), 1.0 / k);
     }
 
     /**
-     * Draw new random number (uniformly distributed, `0 <= r <= max(uint32_t)`).
-     * This advances the state of the generator by one increment.
-     *
-     * @return Next random number in sequence.
+     * Generate an nd-array of random numbers distributed according to an power distribution.
      *
-     * @note Wrapper around operator().
+     * @param shape The shape of the nd-array.
+     * @param k Scale.
+     * @return The sample of shape `shape`.
      */
-    uint32_t next_uint32()
+    template <class S>
+    auto power(const S& shape, double k = 1) -> typename detail::return_type<double, S>::type
     {
-        return (*this)();
+        using R = typename detail::return_type<double, S>::type;
+        return this->power_impl<R>(shape, k);
     }
 
     /**
-     * Draw new random number (uniformly distributed, `0 <= r <= bound`).
-     *
-     * @param bound Bound on the return.
-     * @return Next random number in sequence.
-     *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @copydoc prrng::GeneratorBase::power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    uint32_t next_uint32(uint32_t bound)
+    template <class R, class S>
+    R power(const S& shape, double k = 1)
     {
-        // To avoid bias, we need to make the range of the RNG a multiple of
-        // bound, which we do by dropping output less than a threshold.
-        // A naive scheme to calculate the threshold would be to do
-        //
-        //     uint32_t threshold = 0x100000000ull % bound;
-        //
-        // but 64-bit div/mod is slower than 32-bit div/mod (especially on
-        // 32-bit platforms).  In essence, we do
-        //
-        //     uint32_t threshold = (0x100000000ull-bound) % bound;
-        //
-        // because this version will calculate the same modulus, but the LHS
-        // value is less than 2^32.
+        return this->power_impl<R>(shape, k);
+    }
 
-        uint32_t threshold = (~bound + 1u) % bound;
+    /**
+     * @copydoc prrng::GeneratorBase::power(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto power(const I (&shape)[L], double k = 1) ->
+        typename detail::return_type_fixed<double, L>::type
+    {
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->power_impl<R>(shape, k);
+    }
 
-        // Uniformity guarantees that this loop will terminate.  In practice, it
-        // should usually terminate quickly; on average (assuming all bounds are
-        // equally likely), 82.25% of the time, we can expect it to require just
-        // one iteration.  In the worst case, someone passes a bound of 2^31 + 1
-        // (i.e., 2147483649), which invalidates almost 50% of the range.  In
-        // practice, bounds are typically small and only a tiny amount of the range
-        // is eliminated.
-        for (;;) {
-            uint32_t r = next_uint32();
-            if (r >= threshold) {
-                return r % bound;
-            }
-        }
+    /**
+     * @copydoc prrng::GeneratorBase::power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R power(const I (&shape)[L], double k = 1)
+    {
+        return this->power_impl<R>(shape, k);
     }
 
     /**
-     * Generate a single precision floating point value on the interval [0, 1).
-     *
-     * @return Next random number in sequence.
+     * Return a random number distributed according to a Gamma distribution.
      *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    float next_float()
+    double gamma(double k = 1, double scale = 1)
     {
-        // Trick from MTGP: generate an uniformly distributed
-        // single precision number in [1,2) and subtract 1.
-        union {
-            uint32_t u;
-            float f;
-        } x;
-        x.u = (next_uint32() >> 9) | 0x3f800000u;
-        return x.f - 1.0f;
+#if PRRNG_USE_BOOST
+        return scale * boost::math::gamma_p_inv<double, double>(
+                           k, static_cast<Derived*>(this)->next_double()
+                       );
+#else
+        return std::numeric_limits<double>::quiet_NaN();
+#endif
     }
 
     /**
-     * Generate a double precision floating point value on the interval [0, 1).
-     *
-     * @return Next random number in sequence.
-     *
-     * @remark Since the underlying random number generator produces 32 bit output,
-     * only the first 32 mantissa bits will be filled (however, the resolution is still
-     * finer than in next_float(), which only uses 23 mantissa bits).
+     * Generate an nd-array of random numbers distributed according to a Gamma distribution.
+     * Only available when compiled with PRRNG_USE_BOOST.
      *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
      */
-    double next_double()
+    template <class S>
+    auto gamma(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        union {
-            uint64_t u;
-            double d;
-        } x;
-
-        x.u = ((uint64_t)next_uint32() << 20) | 0x3ff0000000000000ULL;
-
-        return x.d - 1.0;
+        using R = typename detail::return_type<double, S>::type;
+        return this->gamma_impl<R>(shape, k, scale);
     }
 
     /**
-     * @brief Generate a double precision floating point value on the interval (0, 1).
-     * @return Next random number in sequence.
+     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    double next_positive_double()
+    template <class R, class S>
+    R gamma(const S& shape, double k = 1, double scale = 1)
     {
-        union {
-            uint64_t u;
-            double d;
-        } x;
-
-        x.u = ((uint64_t)next_uint32() << 20) | 0x3ff0000000000000ULL;
-
-        if (x.u == 0x3ff0000000000000ULL) {
-            x.u += 1;
-        }
-
-        return x.d - 1.0;
+        return this->gamma_impl<R>(shape, k, scale);
     }
 
     /**
-     * The current "state" of the generator. If the same initseq() is used, this exact point
-     * in the sequence can be restored with restore().
-     *
-     * @return State of the generator.
+     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
      */
-    uint64_t state() const
+    template <class I, std::size_t L>
+    auto gamma(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        return m_state;
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->gamma_impl<R>(shape, k, scale);
     }
 
     /**
-     * @copydoc prrng::pcg32::state() const
-     *
-     * @tparam R use a different return-type. There are some internal checks if the type is able to
-     * store the internal state of type `uint64_t`.
+     * @copydoc prrng::GeneratorBase::gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <typename R>
-    R state()
+    template <class R, class I, std::size_t L>
+    R gamma(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        static_assert(
-            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_state)>::max(),
-            "Down-casting not allowed."
-        );
-
-        static_assert(
-            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_state)>::min(),
-            "Down-casting not allowed."
-        );
-
-        return static_cast<R>(m_state);
+        return this->gamma_impl<R>(shape, k, scale);
     }
 
     /**
-     * The state initiator that was used upon construction.
+     * Return a random number distributed according to a Pareto distribution.
      *
-     * @return initiator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    uint64_t initstate() const
+    double pareto(double k = 1, double scale = 1)
     {
-        return m_initstate;
+        return scale * std::pow(1.0 - static_cast<Derived*>(this)->next_double(), -1.0 / k);
     }
 
     /**
-     * @copydoc initstate()
+     * Generate an nd-array of random numbers distributed according to a Pareto distribution.
      *
-     * @tparam R use a different return-type. There are some internal checks if the type is able to
-     * store the internal state of type `uint64_t`.
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
      */
-    template <typename R>
-    R initstate() const
+    template <class S>
+    auto pareto(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        static_assert(
-            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initstate)>::max(),
-            "Down-casting not allowed."
-        );
-
-        static_assert(
-            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initstate)>::min(),
-            "Down-casting not allowed."
-        );
-
-        return static_cast<R>(m_initstate);
+        using R = typename detail::return_type<double, S>::type;
+        return this->pareto_impl<R>(shape, k, scale);
     }
 
     /**
-     * The sequence initiator that was used upon construction.
-     *
-     * @return initiator.
+     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    uint64_t initseq() const
+    template <class R, class S>
+    R pareto(const S& shape, double k = 1, double scale = 1)
     {
-        return m_initseq;
+        return this->pareto_impl<R>(shape, k, scale);
     }
 
     /**
-     * @copydoc initseq()
-     *
-     * @tparam R use a different return-type. There are some internal checks if the type is able to
-     * store the internal state of type `uint64_t`.
+     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
      */
-    template <typename R>
-    R initseq() const
+    template <class I, std::size_t L>
+    auto pareto(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        static_assert(
-            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initseq)>::max(),
-            "Down-casting not allowed."
-        );
-
-        static_assert(
-            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initseq)>::min(),
-            "Down-casting not allowed."
-        );
-
-        return static_cast<R>(m_initseq);
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->pareto_impl<R>(shape, k, scale);
     }
 
     /**
-     * Restore a given state in the sequence. See state().
-     *
-     * @tparam R use a different return-type. There are some internal checks if the type is able to
-     * store the internal state of type `uint64_t`.
+     * @copydoc prrng::GeneratorBase::pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <typename T>
-    void restore(T state)
+    template <class R, class I, std::size_t L>
+    R pareto(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
-        m_state = static_cast<uint64_t>(state);
+        return this->pareto_impl<R>(shape, k, scale);
     }
 
     /**
-     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     * Return a random number distributed according to a Weibull distribution.
+     *
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    int64_t operator-(const pcg32& other) const
+    double weibull(double k = 1, double scale = 1)
     {
-        PRRNG_DEBUG(m_inc == other.m_inc);
-
-        uint64_t cur_mult = PRRNG_PCG32_MULT;
-        uint64_t cur_plus = m_inc;
-        uint64_t cur_state = other.m_state;
-        uint64_t the_bit = 1u;
-        uint64_t distance = 0u;
-
-        while (m_state != cur_state) {
-            if ((m_state & the_bit) != (cur_state & the_bit)) {
-                cur_state = cur_state * cur_mult + cur_plus;
-                distance |= the_bit;
-            }
-            PRRNG_DEBUG((m_state & the_bit) == (cur_state & the_bit));
-            the_bit <<= 1;
-            cur_plus = (cur_mult + 1ULL) * cur_plus;
-            cur_mult *= cur_mult;
-        }
-
-        return (int64_t)distance;
+        return scale *
+               std::pow(-std::log(1.0 - static_cast<Derived*>(this)->next_double()), 1.0 / k);
     }
 
     /**
-     * The distance between two PCG32 pseudorandom number generators.
+     * Generate an nd-array of random numbers distributed according to a Weibull distribution.
      *
-     * @tparam R
-     *     Return-type.
-     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
-     *
-     * @return Distance.
-     *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
      */
-    template <typename R = int64_t>
-    R distance(const pcg32& other) const
+    template <class S>
+    auto weibull(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
-        int64_t r = this->operator-(other);
-
-#ifdef PRRNG_ENABLE_DEBUG
-        bool u = std::is_unsigned<R>::value;
-        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
-#endif
-
-        return static_cast<R>(r);
+        using R = typename detail::return_type<double, S>::type;
+        return this->weibull_impl<R>(shape, k, scale);
     }
 
     /**
-     * The distance between two states.
-     *
-     * @tparam R
-     *     Return-type.
-     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
-     *
-     * @return Distance.
-     *
-     * @warning The increment of used to generate must be the same. There is no way of checking
-     * here!
-     *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <
-        typename R = int64_t,
-        typename T,
-        std::enable_if_t<std::is_integral<T>::value, bool> = true>
-    R distance(T other_state) const
+    template <class R, class S>
+    R weibull(const S& shape, double k = 1, double scale = 1)
     {
-        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
-
-        uint64_t cur_mult = PRRNG_PCG32_MULT;
-        uint64_t cur_plus = m_inc;
-        uint64_t cur_state = other_state;
-        uint64_t the_bit = 1u;
-        uint64_t distance = 0u;
-
-        while (m_state != cur_state) {
-            if ((m_state & the_bit) != (cur_state & the_bit)) {
-                cur_state = cur_state * cur_mult + cur_plus;
-                distance |= the_bit;
-            }
-            PRRNG_DEBUG((m_state & the_bit) == (cur_state & the_bit));
-            the_bit <<= 1;
-            cur_plus = (cur_mult + 1ULL) * cur_plus;
-            cur_mult *= cur_mult;
-        }
-
-        int64_t r = (int64_t)distance;
-
-#ifdef PRRNG_ENABLE_DEBUG
-        bool u = std::is_unsigned<R>::value;
-        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
-#endif
-
-        return static_cast<R>(r);
+        return this->weibull_impl<R>(shape, k, scale);
     }
 
     /**
-     * Multi-step advance function (jump-ahead, jump-back).
-     *
-     * @param distance Distance to jump ahead or jump back (depending on the sign).
-     * This changes that state of the generator by the appropriate number of increments.
-     *
-     * @note The method used here is based on Brown, "Random Number Generation
-     * with Arbitrary Stride", Transactions of the American Nuclear Society (Nov. 1994).
-     * The algorithm is very similar to fast exponentiation.
-     *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
      */
-    template <typename T>
-    void advance(T distance)
+    template <class I, std::size_t L>
+    auto weibull(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        static_assert(sizeof(int64_t) >= sizeof(T), "Down-casting not allowed.");
-
-        int64_t delta_ = static_cast<int64_t>(distance);
-
-        uint64_t cur_mult = PRRNG_PCG32_MULT;
-        uint64_t cur_plus = m_inc;
-        uint64_t acc_mult = 1u;
-        uint64_t acc_plus = 0u;
-
-        // Even though delta is an unsigned integer, we can pass a signed
-        // integer to go backwards, it just goes "the long way round".
-        uint64_t delta = (uint64_t)delta_;
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->weibull_impl<R>(shape, k, scale);
+    }
 
-        while (delta > 0) {
-            if (delta & 1) {
-                acc_mult *= cur_mult;
-                acc_plus = acc_plus * cur_mult + cur_plus;
-            }
-            cur_plus = (cur_mult + 1) * cur_plus;
-            cur_mult *= cur_mult;
-            delta /= 2;
-        }
-        m_state = acc_mult * m_state + acc_plus;
+    /**
+     * @copydoc prrng::GeneratorBase::weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R weibull(const I (&shape)[L], double k = 1, double scale = 1)
+    {
+        return this->weibull_impl<R>(shape, k, scale);
     }
 
     /**
-     * Equality operator.
-     *
-     * @param other The generator to which to compare.
+     * Return a random number distributed according to a normal distribution.
      *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return Random number.
      */
-    bool operator==(const pcg32& other) const
+    double normal(double mu = 0, double sigma = 1)
     {
-        return m_state == other.m_state && m_inc == other.m_inc;
+#if PRRNG_USE_BOOST
+        return mu + sigma * std::sqrt(2.0) *
+                        boost::math::erf_inv<double>(
+                            2.0 * static_cast<Derived*>(this)->next_positive_double() - 1.0
+                        );
+#else
+        return std::numeric_limits<double>::quiet_NaN();
+#endif
     }
 
     /**
-     * Inequality operator.
-     *
-     * @param other The generator to which to compare.
+     * Generate an nd-array of random numbers distributed according to a normal distribution.
      *
-     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     * @param shape The shape of the nd-array.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return The sample of shape `shape`.
      */
-    bool operator!=(const pcg32& other) const
+    template <class S>
+    auto normal(const S& shape, double mu = 0, double sigma = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        return m_state != other.m_state || m_inc != other.m_inc;
+        using R = typename detail::return_type<double, S>::type;
+        return this->normal_impl<R>(shape, mu, sigma);
     }
 
-protected:
-    uint64_t m_initstate; ///< State initiator
-    uint64_t m_initseq; ///< Sequence initiator
-    uint64_t m_state; ///< RNG state. All values are possible.
-    uint64_t m_inc; ///< Controls which RNG sequence (stream) is selected. Must *always* be odd.
-};
-
-/**
- * @brief Overload of prrng::pcg32() that keeps track of the current index of the generator
- * in the sequence.
- *
- * @warning The user is responsible for updating the index.
- * The purpose of this class is therefore mostly internal, to support prrng::pcg32_cumsum().
- */
-class pcg32_index : public pcg32 {
-private:
-    ptrdiff_t m_index; ///< Index of the generator
-    bool m_delta; ///< Signal if uniquely a delta distribution will be drawn
+    /**
+     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R normal(const S& shape, double mu = 0, double sigma = 1)
+    {
+        return this->normal_impl<R>(shape, mu, sigma);
+    }
 
-public:
     /**
-     * @param initstate State initiator.
-     * @param initseq Sequence initiator.
-     * @param delta `true` if uniquely a delta distribution will be drawn.
+     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
      */
-    template <typename T = uint64_t, typename S = uint64_t>
-    pcg32_index(
-        T initstate = PRRNG_PCG32_INITSTATE,
-        S initseq = PRRNG_PCG32_INITSEQ,
-        bool delta = false
-    )
+    template <class I, std::size_t L>
+    auto normal(const I (&shape)[L], double mu = 0, double sigma = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
-        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
-        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
-        m_index = 0;
-        m_delta = delta;
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->normal_impl<R>(shape, mu, sigma);
     }
 
     /**
-     * @brief State at a specific index of the sequence.
-     * Internally the generator is moved to the index, the state is stored,
-     * and the generator is restored to its original state.
-     * This call can therefore be expensive.
-     *
-     * @param index Index at which to get the state.
-     * @return uint64_t
+     * @copydoc prrng::GeneratorBase::normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    uint64_t state_at(ptrdiff_t index)
+    template <class R, class I, std::size_t L>
+    R normal(const I (&shape)[L], double mu = 0, double sigma = 1)
     {
-        if (m_delta) {
-            return m_state;
-        }
-        uint64_t state = m_state;
-        this->advance(index - m_index);
-        uint64_t ret = m_state;
-        this->restore(state);
-        return ret;
+        return this->normal_impl<R>(shape, mu, sigma);
     }
 
     /**
-     * @brief Move to a certain index.
-     * @param index Index of the generator.
+     * Return a random number distributed according to a normal distribution,
+     * sampled using the Ziggurat method.
+     * This is much faster than normal() (which uses the inverse of the cumulative density),
+     * and does not require Boost.
+     * As for normal(), each number is a function of exactly one random number of the generator,
+     * but the sequence is different from that of normal().
+     *
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return Random number.
      */
-    void jump_to(ptrdiff_t index)
+    double fast_normal(double mu = 0, double sigma = 1)
     {
-        if (m_delta) {
-            return;
-        }
-        this->advance(index - m_index);
-        m_index = index;
+        detail::uint32_to_fast_normal convert(mu, sigma);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
     /**
-     * @brief Update the generator index with the number of items you have drawn.
-     * @param n Number of drawn numbers.
+     * Generate an nd-array of random numbers distributed according to a normal distribution,
+     * see fast_normal(double, double).
+     *
+     * @param shape The shape of the nd-array.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return The sample of shape `shape`.
      */
-    void drawn(ptrdiff_t n)
+    template <class S>
+    auto fast_normal(const S& shape, double mu = 0, double sigma = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        if (m_delta) {
-            return;
-        }
-        m_index += n;
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_normal(mu, sigma));
     }
 
     /**
-     * @brief Signal if the generator is uniquely used to draw a delta distribution.
-     * @param delta `true` if uniquely a delta distribution will be drawn.
+     * @copydoc prrng::GeneratorBase::fast_normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void set_delta(bool delta)
+    template <class R, class S>
+    R fast_normal(const S& shape, double mu = 0, double sigma = 1)
     {
-        m_delta = delta;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_normal(mu, sigma));
     }
 
     /**
-     * @brief Get the generator index.
-     * @return Index of the generator.
+     * @copydoc prrng::GeneratorBase::fast_normal(const S&, double, double)
      */
-    ptrdiff_t index() const
+    template <class I, std::size_t L>
+    auto fast_normal(const I (&shape)[L], double mu = 0, double sigma = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        return m_index;
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_normal(mu, sigma));
     }
 
     /**
-     * @brief Overwrite the generator index.
-     * @param index Index of the generator.
+     * @copydoc prrng::GeneratorBase::fast_normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void set_index(ptrdiff_t index)
+    template <class R, class I, std::size_t L>
+    R fast_normal(const I (&shape)[L], double mu = 0, double sigma = 1)
     {
-        m_index = index;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_normal(mu, sigma));
     }
-};
 
-/**
- * @brief Structure to assemble the alignment parameters.
- * These parameters are used when the chunk is aligned with a position,
- * see prrng::pcg32_cumsum::align(), prrng::pcg32_arrayBase_cumsum::align().
- */
-struct alignment {
     /**
-     * @param buffer
-     *      If positive, only change the chunk if target is in `chunk[:buffer]` or `chunk[-buffer:]`
+     * Return a random number distributed according to an exponential distribution,
+     * sampled using the Ziggurat method.
+     * This avoids the logarithm of exponential() (which uses the inverse of the cumulative
+     * density) for most samples.
+     * As for exponential(), each number is a function of exactly one random number of the
+     * generator, but the sequence is different from that of exponential().
      *
-     * @param margin
-     *      Index of the chunk to place the target.
-     *
-     * @param min_margin
-     *      Minimal index to accept if `strict = false`.
-     *
-     * @param strict
-     *      If `true`, `margin` is respected strictly: `argmin(target > chunk) == margin`.
-     *      If `false` `min_margin <= argmin(target > chunk) <= margin`, whereby
-     *      `argmin(target > chunk) < margin` if moving backwards is required to respect `margin`.
+     * @param scale Scale.
+     * @return Random number.
      */
-    alignment(
-        ptrdiff_t buffer = 0,
-        ptrdiff_t margin = 0,
-        ptrdiff_t min_margin = 0,
-        bool strict = false
-    )
+    double fast_exponential(double scale = 1)
     {
-        this->buffer = buffer;
-        this->margin = margin;
-        this->min_margin = min_margin;
-        this->strict = strict;
+        detail::uint32_to_fast_exponential convert(scale);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
     /**
-     * If positive, only change the chunk if target is in `chunk[:buffer]` or `chunk[-buffer:]`.
-     */
-    ptrdiff_t buffer = 0;
-
-    /**
-     * Index of the chunk to place the target.
+     * Generate an nd-array of random numbers distributed according to an exponential distribution,
+     * see fast_exponential(double).
+     *
+     * @param shape The shape of the nd-array.
+     * @param scale Scale.
+     * @return The sample of shape `shape`.
      */
-    ptrdiff_t margin = 0;
+    template <class S>
+    auto fast_exponential(const S& shape, double scale = 1) ->
+        typename detail::return_type<double, S>::type
+    {
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_exponential(scale));
+    }
 
     /**
-     * Minimal index to accept if `strict = false`.
+     * @copydoc prrng::GeneratorBase::fast_exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    ptrdiff_t min_margin = 0;
+    template <class R, class S>
+    R fast_exponential(const S& shape, double scale = 1)
+    {
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_exponential(scale));
+    }
 
     /**
-     * If `true`, `margin` is respected strictly: `argmin(target > chunk) == margin`.
-     * If `false`, `min_margin <= argmin(target > chunk) <= margin`, whereby
-     * `argmin(target > chunk) < margin` if moving backwards is required to respect `margin`.
+     * @copydoc prrng::GeneratorBase::fast_exponential(const S&, double)
      */
-    bool strict = false;
-};
-
-/**
- * @brief Generator of a random cumulative sum of which a chunk is kept in memory.
- * The random number generated by the pcg32 algorithm.
- *
- * Suppose that `cumsum` is the unlimited cumulative of random numbers starting from a seed, then a
- * chunk `gen.data() == cumsum[gen.start() : gen.start() + gen.size()]` is kept in memory by this
- * class. The chunk that is kept in memory can be changed by calling:
- *
- *  -   prrng::pcg32_cumsum::prev() to get the previous chunk.
- *  -   prrng::pcg32_cumsum::next() to get the next chunk.
- *  -   prrng::pcg32_cumsum::align() to align the chunk with a target value.
- *
- * Note that if the current chunk is far away from the seed a quick way to restore it without
- * drawing all random numbers from the seed is to call prrng::pcg32_cumsum::restore().
- * Note that you need to know one value and its index.
- *
- * @tparam Storage of the data.
- */
-template <class Data>
-class pcg32_cumsum {
-private:
-    Data m_data; ///< The chunk.
-    pcg32_index m_gen; ///< The generator.
-    std::function<Data(size_t)> m_draw; ///< Function to draw the random numbers.
-    std::function<double(size_t)> m_sum; ///< Function to get the cumsum of random numbers.
-    bool m_extendible; ///< Signal if the drawing functions are specified.
-    alignment m_align; ///< alignment settings, see prrng::alignment().
-    distribution m_distro; ///< Distribution name, see prrng::distribution().
-    std::array<double, 3> m_param; ///< Distribution parameters.
-    ptrdiff_t m_start; ///< Start index of the chunk.
-    ptrdiff_t m_i; ///< Last know index of `target` in align.
+    template <class I, std::size_t L>
+    auto fast_exponential(const I (&shape)[L], double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
+    {
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_exponential(scale));
+    }
 
     /**
-     * @brief Set draw function.
+     * @copydoc prrng::GeneratorBase::fast_exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void auto_functions()
+    template <class R, class I, std::size_t L>
+    R fast_exponential(const I (&shape)[L], double scale = 1)
     {
-        m_extendible = true;
-
-        switch (m_distro) {
-        case random:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.random<Data>(std::array<size_t, 1>{n}) * m_param[0] + m_param[1];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_random(n) * m_param[0] + static_cast<double>(n) * m_param[1];
-            };
-            return;
-        case delta:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.delta<Data>(std::array<size_t, 1>{n}, m_param[0]) + m_param[1];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_delta(n, m_param[0]) + static_cast<double>(n) * m_param[1];
-            };
-            return;
-        case exponential:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.exponential<Data>(std::array<size_t, 1>{n}, m_param[0]) + m_param[1];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_exponential(n, m_param[0]) +
-                       static_cast<double>(n) * m_param[1];
-            };
-            return;
-        case power:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.power<Data>(std::array<size_t, 1>{n}, m_param[0]) + m_param[1];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_power(n, m_param[0]) + static_cast<double>(n) * m_param[1];
-            };
-            return;
-        case gamma:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.gamma<Data>(std::array<size_t, 1>{n}, m_param[0], m_param[1]) +
-                       m_param[2];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_gamma(n, m_param[0], m_param[1]) +
-                       static_cast<double>(n) * m_param[2];
-            };
-            return;
-        case pareto:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.pareto<Data>(std::array<size_t, 1>{n}, m_param[0], m_param[1]) +
-                       m_param[2];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_pareto(n, m_param[0], m_param[1]) +
-                       static_cast<double>(n) * m_param[2];
-            };
-            return;
-        case weibull:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.weibull<Data>(std::array<size_t, 1>{n}, m_param[0], m_param[1]) +
-                       m_param[2];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_weibull(n, m_param[0], m_param[1]) +
-                       static_cast<double>(n) * m_param[2];
-            };
-            return;
-        case normal:
-            m_draw = [this](size_t n) -> Data {
-                return m_gen.normal<Data>(std::array<size_t, 1>{n}, m_param[0], m_param[1]) +
-                       m_param[2];
-            };
-            m_sum = [this](size_t n) -> double {
-                return m_gen.cumsum_normal(n, m_param[0], m_param[1]) +
-                       static_cast<double>(n) * m_param[2];
-            };
-            return;
-        case custom:
-            m_extendible = false;
-            return;
-        }
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_exponential(scale));
     }
 
     /**
-     * @brief Copy constructor.
-     * This function resets all internal pointers.
+     * Return a random number distributed according to a gamma distribution,
+     * sampled using the method of Marsaglia and Tsang.
+     * This is much faster than gamma() (which uses the inverse of the cumulative density),
+     * and does not require Boost.
+     * As for gamma(), each number is a function of exactly one random number of the generator,
+     * but the sequence is different from that of gamma().
      *
-     * @param other Object to copy.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    void copy_from(const pcg32_cumsum& other)
+    double fast_gamma(double k = 1, double scale = 1)
     {
-        m_data = other.m_data;
-        m_gen = other.m_gen;
-        m_align = other.m_align;
-        m_distro = other.m_distro;
-        m_param = other.m_param;
-        m_start = other.m_start;
-        m_i = other.m_i;
-        this->auto_functions();
+        detail::uint32_to_fast_gamma convert(k, scale);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
-public:
     /**
-     * @param shape Shape of the chunk.
-     * @param initstate State initiator.
-     * @param initseq Sequence initiator.
-     * @param distribution Distribution type, see prrng::distribution().
-     *
-     * @param parameters
-     *      Parameters for the distribution. The following is default (and the expected order):
-     *
-     *      -   prrng::distribution::random: {scale = 1, offset = 0}
-     *      -   prrng::distribution::delta: {scale = 1, offset = 0}
-     *      -   prrng::distribution::exponential: {scale = 1, offset = 0}
-     *      -   prrng::distribution::power: {k = 1, offset = 0}
-     *      -   prrng::distribution::gamma: {k = 1, scale = 1, offset = 0}
-     *      -   prrng::distribution::pareto: {k = 1, scale = 1, offset = 0}
-     *      -   prrng::distribution::weibull: {k = 1, scale = 1, offset = 0}
-     *      -   prrng::distribution::normal: {mu = 1, sigma = , offset = 0}
-     *      -   prrng::distribution::custom: {}
+     * Generate an nd-array of random numbers distributed according to a gamma distribution,
+     * see fast_gamma(double, double).
      *
-     *      Warning: if you want to use a custom distribution, you have to call
-     *      prrng::pcg32_cumsum::set_functions().
-     *
-     * @param align Alignment parameters, see prrng::alignment().
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
      */
-    template <class R, typename T = uint64_t, typename S = uint64_t>
-    pcg32_cumsum(
-        const R& shape,
-        T initstate = PRRNG_PCG32_INITSTATE,
-        S initseq = PRRNG_PCG32_INITSEQ,
-        enum distribution distribution = distribution::custom,
-        const std::vector<double>& parameters = std::vector<double>{},
-        const alignment& align = alignment()
-    )
+    template <class S>
+    auto fast_gamma(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        m_data = xt::empty<typename Data::value_type>(shape);
-        m_gen = pcg32_index(initstate, initseq, distribution == distribution::delta);
-        m_start = m_gen.index();
-        m_i = static_cast<ptrdiff_t>(m_data.size());
-        m_align = align;
-        m_distro = distribution;
-        std::copy(parameters.begin(), parameters.end(), m_param.begin());
-        this->auto_functions();
-
-        if (!m_extendible) {
-            return;
-        }
-
-        using E = decltype(m_draw(size_t{}));
-        E extra = m_draw(m_data.size());
-        m_gen.drawn(m_data.size());
-        std::partial_sum(extra.begin(), extra.end(), m_data.begin());
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_gamma(k, scale));
     }
 
     /**
-     * @brief Use external functions to draw the random numbers.
-     * @param get_chunk Function to draw the random numbers, called as `get_chunk(n)`.
-     * @param get_cumsum Function to get the cumsum of random numbers, called: `get_cumsum(n)`.
-     * @param uses_generator Set `true` is the random generator is used by the functions.
+     * @copydoc prrng::GeneratorBase::fast_gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void set_functions(
-        std::function<Data(size_t)> get_chunk,
-        std::function<double(size_t)> get_cumsum,
-        bool uses_generator = true
-    )
+    template <class R, class S>
+    R fast_gamma(const S& shape, double k = 1, double scale = 1)
     {
-        m_extendible = true;
-        m_draw = get_chunk;
-        m_sum = get_cumsum;
-        m_gen.set_delta(!uses_generator);
-
-        using E = decltype(m_draw(size_t{}));
-        E extra = m_draw(m_data.size());
-        m_gen.drawn(m_data.size());
-        std::partial_sum(extra.begin(), extra.end(), m_data.begin());
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_gamma(k, scale));
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::copy_from(const prrng::pcg32_cumsum&)
+     * @copydoc prrng::GeneratorBase::fast_gamma(const S&, double, double)
      */
-    pcg32_cumsum(const pcg32_cumsum& other)
+    template <class I, std::size_t L>
+    auto fast_gamma(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        this->copy_from(other);
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_gamma(k, scale));
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::copy_from(const prrng::pcg32_cumsum&)
+     * @copydoc prrng::GeneratorBase::fast_gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void operator=(const pcg32_cumsum& other)
+    template <class R, class I, std::size_t L>
+    R fast_gamma(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        this->copy_from(other);
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_gamma(k, scale));
     }
 
     /**
-     * @brief `true` if the chunk is extendible.
-     * @return bool
+     * Return a random number distributed according to a power distribution,
+     * using a tabulated quantile, see detail::pow_table.
+     * This is faster than power(), which evaluates `std::pow` for every number.
+     * Each number is a function of the same random number of the generator as in power(),
+     * such that the sequence is that of power() up to a relative error below `4e-15`
+     * for `k >= 0.05`.
+     * For `k < 0.05` the result is that of power().
+     *
+     * @param k Scale.
+     * @return Random number.
      */
-    bool is_extendible() const
+    double fast_power(double k = 1)
     {
-        return m_extendible;
+        detail::uint32_to_fast_power convert(k);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
     /**
-     * @brief Pointer to the generator.
-     * @return const pcg32&
+     * Generate an nd-array of random numbers distributed according to a power distribution,
+     * see fast_power(double).
+     *
+     * @param shape The shape of the nd-array.
+     * @param k Scale.
+     * @return The sample of shape `shape`.
      */
-    const pcg32_index& generator() const
+    template <class S>
+    auto fast_power(const S& shape, double k = 1) -> typename detail::return_type<double, S>::type
     {
-        return m_gen;
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_power(k));
     }
 
     /**
-     * @brief Shape of the chunk.
-     * @return const auto&
+     * @copydoc prrng::GeneratorBase::fast_power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    const auto& shape() const
+    template <class R, class S>
+    R fast_power(const S& shape, double k = 1)
     {
-        return m_data.shape();
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_power(k));
     }
 
     /**
-     * @brief Size of the chunk.
-     * @return auto
+     * @copydoc prrng::GeneratorBase::fast_power(const S&, double)
      */
-    auto size() const
+    template <class I, std::size_t L>
+    auto fast_power(const I (&shape)[L], double k = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        return m_data.size();
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_power(k));
     }
 
     /**
-     * @brief Add value(s) to the chunk.
-     * @param value Value(s) to add.
+     * @copydoc prrng::GeneratorBase::fast_power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    template <class T>
-    pcg32_cumsum& operator+=(const T& value)
+    template <class R, class I, std::size_t L>
+    R fast_power(const I (&shape)[L], double k = 1)
     {
-        xt::noalias(m_data) += value;
-        return *this;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_power(k));
     }
 
     /**
-     * @brief Subtract value(s) from the chunk.
-     * @param value Value(s) to subtract.
+     * Return a random number distributed according to a Pareto distribution,
+     * using a tabulated quantile, see detail::pow_table.
+     * This is faster than pareto(), which evaluates `std::pow` for every number.
+     * Each number is a function of the same random number of the generator as in pareto(),
+     * such that the sequence is that of pareto() up to a relative error below `4e-15`
+     * for `k >= 0.05`.
+     * For `k < 0.05` the result is that of pareto().
+     *
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    template <class T>
-    pcg32_cumsum& operator-=(const T& value)
+    double fast_pareto(double k = 1, double scale = 1)
     {
-        xt::noalias(m_data) -= value;
-        return *this;
+        detail::uint32_to_fast_pareto convert(k, scale);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
     /**
-     * @brief The current chunk of the cumsum of random numbers.
-     * @return Reference to the chunk.
-     */
-    const Data& data() const
+     * Generate an nd-array of random numbers distributed according to a Pareto distribution,
+     * see fast_pareto(double, double).
+     *
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
+     */
+    template <class S>
+    auto fast_pareto(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        return m_data;
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_pareto(k, scale));
     }
 
     /**
-     * @brief Overwrite the current chunk of the cumsum of random numbers.
-     * Please check if set_state() or set_start() should be called too.
-     *
-     * @param data The chunk.
+     * @copydoc prrng::GeneratorBase::fast_pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void set_data(const Data& data)
+    template <class R, class S>
+    R fast_pareto(const S& shape, double k = 1, double scale = 1)
     {
-        PRRNG_ASSERT(xt::has_shape(data, m_data.shape()));
-        xt::noalias(m_data) = data;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_pareto(k, scale));
     }
 
     /**
-     * @brief Global index of the first element in the chunk.
-     * @return Global index.
+     * @copydoc prrng::GeneratorBase::fast_pareto(const S&, double, double)
      */
-    ptrdiff_t start() const
+    template <class I, std::size_t L>
+    auto fast_pareto(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        return m_start;
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_pareto(k, scale));
     }
 
     /**
-     * @brief Set global index of the first element in the chunk.
-     * @param index Global index.
+     * @copydoc prrng::GeneratorBase::fast_pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    void set_start(ptrdiff_t index)
+    template <class R, class I, std::size_t L>
+    R fast_pareto(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        m_start = index;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_pareto(k, scale));
     }
 
     /**
-     * @brief Global index of `target`
-     * (the last time prrng::pcg32_cumsum::align() was called).
-     *
-     * Suppose that `cumsum` is the unlimited cumsum of random numbers starting from a seed, then:
-     *
-     *  -   `gen.left_of_align() == cumsum[gen.index_at_align()] <= target`.
-     *  -   `gen.right_of_align() == cumsum[gen.index_at_align() + 1] > target`.
+     * Return a random number distributed according to a Weibull distribution,
+     * using a tabulated quantile, see detail::pow_table.
+     * This is faster than weibull(), which evaluates `std::pow` for every number.
+     * Each number is a function of the same random number of the generator as in weibull(),
+     * such that the sequence is that of weibull() up to a relative error below `4e-15`
+     * for `k >= 0.05`.
+     * For `k < 0.05` the result is that of weibull().
      *
-     * Note thought that `cumsum` is not constructed by this class, that instead only holds a chunk
-     * `gen.data() == cumsum[gen.start():gen.start() + gen.size()]`.
-     *
-     * @return Global index.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Random number.
      */
-    ptrdiff_t index_at_align() const
+    double fast_weibull(double k = 1, double scale = 1)
     {
-        return m_start + m_i;
+        detail::uint32_to_fast_weibull convert(k, scale);
+        return convert(static_cast<Derived*>(this)->next_uint32());
     }
 
     /**
-     * @brief Index of `target` relative to the beginning of the chunk
-     * (the last time prrng::pcg32_cumsum::align() was called).
-     *
-     * The currently held chunk of the cumsum of random numbers is is `gen.data()`. As such,
-     *
-     *  -  `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
-     *  -  `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
+     * Generate an nd-array of random numbers distributed according to a Weibull distribution,
+     * see fast_weibull(double, double).
      *
-     * @return Local index.
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The sample of shape `shape`.
      */
-    ptrdiff_t chunk_index_at_align() const
+    template <class S>
+    auto fast_weibull(const S& shape, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, S>::type
     {
-        return m_i;
+        using R = typename detail::return_type<double, S>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_weibull(k, scale));
     }
 
     /**
-     * @brief Return the value of the cumsum left of the `target`
-     * (the last time prrng::pcg32_cumsum::align() was called).
-     * `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
-     *
-     * @return double
+     * @copydoc prrng::GeneratorBase::fast_weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    double left_of_align() const
+    template <class R, class S>
+    R fast_weibull(const S& shape, double k = 1, double scale = 1)
     {
-        return m_data[m_i];
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_weibull(k, scale));
     }
 
     /**
-     * @brief Return the value of the cumsum right of the `target`
-     * (the last time prrng::pcg32_cumsum::align() was called).
-     * `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
-     *
-     * @return double
+     * @copydoc prrng::GeneratorBase::fast_weibull(const S&, double, double)
      */
-    double right_of_align() const
+    template <class I, std::size_t L>
+    auto fast_weibull(const I (&shape)[L], double k = 1, double scale = 1) ->
+        typename detail::return_type_fixed<double, L>::type
     {
-        return m_data[m_i + 1];
+        using R = typename detail::return_type_fixed<double, L>::type;
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_weibull(k, scale));
     }
 
     /**
-     * @copydoc prrng::pcg32_index::state()
+     * @copydoc prrng::GeneratorBase::fast_weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
      */
-    uint64_t state_at(ptrdiff_t index)
+    template <class R, class I, std::size_t L>
+    R fast_weibull(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        return m_gen.state_at(index);
+        return this->convert_impl<R>(shape, detail::uint32_to_fast_weibull(k, scale));
     }
 
     /**
-     * @brief Restore a specific state in the cumulative sum.
+     * @brief Get a random number according to some distribution.
      *
-     * @param state The state at the beginning of the new chunk.
-     * @param value The value of the first entry of the new chunk.
-     * @param index The index of the first entry of the new chunk.
+     * @param distribution Type of distribution, see prrg::distribution.
+     * @param parameters Parameters for the distribution, see prrng::default_parameters.
+     * @param append_default Append default parameters to `parameters`.
      */
-    void restore(uint64_t state, double value, ptrdiff_t index)
+    double draw(
+        enum prrng::distribution distribution,
+        std::vector<double> parameters = std::vector<double>{},
+        bool append_default = true
+    )
     {
-        m_gen.set_index(index);
-        m_gen.restore(state);
-        m_start = index;
+        if (append_default) {
+            parameters = default_parameters(distribution, parameters);
+        }
+        else {
+            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
+        }
 
-        using E = decltype(m_draw(size_t{}));
-        E extra = m_draw(m_data.size());
-        m_gen.drawn(m_data.size());
-        extra.front() += value - extra.front();
-        std::partial_sum(extra.begin(), extra.end(), m_data.begin());
+        switch (distribution) {
+        case prrng::distribution::random:
+            return this->random() * parameters[0] + parameters[1];
+        case prrng::distribution::delta:
+            return this->delta(parameters[0]) + parameters[1];
+        case prrng::distribution::exponential:
+            return this->exponential(parameters[0]) + parameters[1];
+        case prrng::distribution::power:
+            return this->power(parameters[0]) + parameters[1];
+        case prrng::distribution::pareto:
+            return this->pareto(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::weibull:
+            return this->weibull(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::gamma:
+            return this->gamma(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::normal:
+            return this->normal(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_normal:
+            return this->fast_normal(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_exponential:
+            return this->fast_exponential(parameters[0]) + parameters[1];
+        case prrng::distribution::fast_gamma:
+            return this->fast_gamma(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_power:
+            return this->fast_power(parameters[0]) + parameters[1];
+        case prrng::distribution::fast_pareto:
+            return this->fast_pareto(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_weibull:
+            return this->fast_weibull(parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::custom:
+            throw std::runtime_error("Unknown distribution");
+        }
+
+        throw std::runtime_error("Unknown distribution");
     }
 
     /**
-     * @brief Check if the chunk contains a target.
-     * @param target The target.
-     * @return `true` if the chunk contains the target.
+     * @brief Get an nd-array of random numbers according to some distribution.
+     *
+     * @param shape The shape of the nd-array.
+     * @param distribution Type of distribution, see prrg::distribution.
+     * @param parameters Parameters for the distribution, see prrng::default_parameters.
+     * @param append_default Append default parameters to `parameters`.s
      */
-    bool contains(double target) const
+    template <class R, class S>
+    R draw(
+        const S& shape,
+        enum prrng::distribution distribution,
+        std::vector<double> parameters = std::vector<double>{},
+        bool append_default = true
+    )
     {
-        return target >= m_data.front() && target <= m_data.back();
+        if (append_default) {
+            parameters = default_parameters(distribution, parameters);
+        }
+        else {
+            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
+        }
+
+        switch (distribution) {
+        case prrng::distribution::random:
+            return this->random<R>(shape) * parameters[0] + parameters[1];
+        case prrng::distribution::delta:
+            return this->delta<R>(shape, parameters[0]) + parameters[1];
+        case prrng::distribution::exponential:
+            return this->exponential<R>(shape, parameters[0]) + parameters[1];
+        case prrng::distribution::power:
+            return this->power<R>(shape, parameters[0]) + parameters[1];
+        case prrng::distribution::pareto:
+            return this->pareto<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::weibull:
+            return this->weibull<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::gamma:
+            return this->gamma<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::normal:
+            return this->normal<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_normal:
+            return this->fast_normal<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_exponential:
+            return this->fast_exponential<R>(shape, parameters[0]) + parameters[1];
+        case prrng::distribution::fast_gamma:
+            return this->fast_gamma<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_power:
+            return this->fast_power<R>(shape, parameters[0]) + parameters[1];
+        case prrng::distribution::fast_pareto:
+            return this->fast_pareto<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::fast_weibull:
+            return this->fast_weibull<R>(shape, parameters[0], parameters[1]) + parameters[2];
+        case prrng::distribution::custom:
+            throw std::runtime_error("Unknown distribution");
+        }
+
+        throw std::runtime_error("Unknown distribution");
     }
 
     /**
-     * @brief Shift chunk left.
-     * @param margin Overlap to keep with the current chunk.
+     * @brief Get the cumulative sum of `n` random numbers according to some distribution.
+     *
+     * @param n Number of random numbers to sum.
+     * @param distribution Type of distribution, see prrg::distribution.
+     * @param parameters Parameters for the distribution, see prrng::default_parameters.
+     * @param append_default Append default parameters to `parameters`.
      */
-    void prev(size_t margin = 0)
+    double cumsum(
+        size_t n,
+        enum prrng::distribution distribution,
+        std::vector<double> parameters = std::vector<double>{},
+        bool append_default = true
+    )
     {
-        PRRNG_ASSERT(m_extendible);
-        m_i = static_cast<ptrdiff_t>(m_data.size());
-        detail::prev(m_gen, m_draw, margin, m_data.data(), m_data.size(), &m_start);
+        if (append_default) {
+            parameters = default_parameters(distribution, parameters);
+        }
+        else {
+            PRRNG_ASSERT(detail::has_correct_parameters(distribution, parameters));
+        }
+
+        double m = static_cast<double>(n);
+
+        switch (distribution) {
+        case prrng::distribution::random:
+            return this->cumsum_random(n) * parameters[0] + m * parameters[1];
+        case prrng::distribution::delta:
+            return this->cumsum_delta(n, parameters[0]) + m * parameters[1];
+        case prrng::distribution::exponential:
+            return this->cumsum_exponential(n, parameters[0]) + m * parameters[1];
+        case prrng::distribution::power:
+            return this->cumsum_power(n, parameters[0]) + m * parameters[1];
+        case prrng::distribution::pareto:
+            return this->cumsum_pareto(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::weibull:
+            return this->cumsum_weibull(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::gamma:
+            return this->cumsum_gamma(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::normal:
+            return this->cumsum_normal(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::fast_normal:
+            return this->cumsum_fast_normal(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::fast_exponential:
+            return this->cumsum_fast_exponential(n, parameters[0]) + m * parameters[1];
+        case prrng::distribution::fast_gamma:
+            return this->cumsum_fast_gamma(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::fast_power:
+            return this->cumsum_fast_power(n, parameters[0]) + m * parameters[1];
+        case prrng::distribution::fast_pareto:
+            return this->cumsum_fast_pareto(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::fast_weibull:
+            return this->cumsum_fast_weibull(n, parameters[0], parameters[1]) + m * parameters[2];
+        case prrng::distribution::custom:
+            throw std::runtime_error("Unknown distribution");
+        }
+
+        throw std::runtime_error("Unknown distribution");
     }
 
     /**
-     * @brief Shift chunk right.
-     * @param margin Overlap to keep with the current chunk.
+     * @brief Lazily evaluated nd-array of random numbers \f$ 0 \leq r < 1 \f$.
+     * Nothing is drawn (or allocated) until the expression is evaluated, e.g. on assignment
+     * `xt::noalias(out) = gen.lazy_random(shape) * a + b`, which draws each number directly
+     * into `out` (without temporaries). The values are equal to those of random(shape).
+     *
+     * The generator is advanced immediately as if all numbers were drawn: the expression keeps
+     * a copy of the generator, see detail::lazy_draw.
+     * Evaluate the expression once, and in one thread (e.g. do not use it in a parallel
+     * assignment).
+     *
+     * @param shape The shape of the nd-array.
+     * @return Expression of shape `shape`.
      */
-    void next(size_t margin = 0)
+    template <class S>
+    auto lazy_random(const S& shape)
     {
-        PRRNG_ASSERT(m_extendible);
-        m_i = static_cast<ptrdiff_t>(m_data.size());
-        detail::next(m_gen, m_draw, margin, m_data.data(), m_data.size(), &m_start);
+        return this->lazy_impl(shape, [](auto& g) { return g.next_double(); });
     }
 
     /**
-     * @brief Align the chunk to encompass a target value.
-     * After this call:
-     *
-     *  -   prrng::pcg32_cumsum::index_at_align(): global index of `target` in the cumulative sum.
-     *
-     *  -   prrng::pcg32_cumsum::chunk_index_at_align(): local index of `target` in the currently
-     *      held chunk, whereby:
-     *
-     *      -  `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
-     *      -  `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
-     *
-     * @param target Target value.
+     * @copydoc prrng::GeneratorBase::lazy_random(const S&)
      */
-    void align(double target)
+    template <class I, std::size_t L>
+    auto lazy_random(const I (&shape)[L])
     {
-        if (!m_extendible) {
-            PRRNG_ASSERT(this->contains(target));
-            m_i = iterator::lower_bound(m_data.begin(), m_data.end(), target, m_i);
-            return;
-        }
-
-        detail::align(
-            m_gen, m_draw, m_sum, m_align, m_data.data(), m_data.size(), &m_start, &m_i, target
-        );
-    }
-};
-
-/**
- * Base class of an array of pseudorandom number generators.
- * This class provides common methods, but itself does not really do much.
- * See the description of derived classed for information.
- *
- * @tparam M Type to use storage of the shape and array vectors. E.g. `std::vector` or `std::array`
- */
-template <class Derived, class M>
-class GeneratorBase_array {
-public:
-    using shape_type = M; ///< Type of the shape and strides lists.
-    using size_type = typename M::value_type; ///< Type of sizes.
+        return this->lazy_impl(shape, [](auto& g) { return g.next_double(); });
+    }
 
     /**
-     * Return the size of the array of generators.
+     * @brief Lazily evaluated nd-array of random numbers distributed according to an exponential
+     * distribution, see lazy_random() and exponential().
      *
-     * @return unsigned int
+     * @param shape The shape of the nd-array.
+     * @param scale Scale.
+     * @return Expression of shape `shape`.
      */
-    size_type size() const
+    template <class S>
+    auto lazy_exponential(const S& shape, double scale = 1)
     {
-        return m_size;
+        return this->lazy_impl(shape, [scale](auto& g) { return g.exponential(scale); });
     }
 
     /**
-     * Return the strides of the array of generators.
-     *
-     * @return vector of unsigned ints
+     * @copydoc prrng::GeneratorBase::lazy_exponential(const S&, double)
      */
-    const shape_type& strides() const
+    template <class I, std::size_t L>
+    auto lazy_exponential(const I (&shape)[L], double scale = 1)
     {
-        return m_strides;
+        return this->lazy_impl(shape, [scale](auto& g) { return g.exponential(scale); });
     }
 
     /**
-     * Return the shape of the array of generators.
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a power
+     * distribution, see lazy_random() and power().
      *
-     * @return vector of unsigned ints
+     * @param shape The shape of the nd-array.
+     * @param k Exponent.
+     * @return Expression of shape `shape`.
      */
-    const shape_type& shape() const
+    template <class S>
+    auto lazy_power(const S& shape, double k = 1)
     {
-        return m_shape;
+        return this->lazy_impl(shape, [k](auto& g) { return g.power(k); });
     }
 
     /**
-     * Return the shape of the array of generators along a specific axis.
-     *
-     * @param axis The axis.
-     * @return vector of unsigned ints
+     * @copydoc prrng::GeneratorBase::lazy_power(const S&, double)
      */
-    template <class T>
-    auto shape(T axis) const
+    template <class I, std::size_t L>
+    auto lazy_power(const I (&shape)[L], double k = 1)
     {
-        return m_shape[axis];
+        return this->lazy_impl(shape, [k](auto& g) { return g.power(k); });
     }
 
     /**
-     * Return a flat index based on an array index specified as a list.
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a gamma
+     * distribution, see lazy_random() and gamma().
      *
-     * @param index Array index, e.g. as std::vector.
-     * @return Flat index.
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `shape`.
      */
-    template <class T>
-    auto flat_index(const T& index) const
+    template <class S>
+    auto lazy_gamma(const S& shape, double k = 1, double scale = 1)
     {
-        PRRNG_DEBUG(this->inbounds(index));
-        return std::inner_product(index.cbegin(), index.cend(), m_strides.cbegin(), 0);
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.gamma(k, scale); });
     }
 
     /**
-     * Check if an index is in bounds (and of the correct rank).
-     *
-     * @return `false` if out-of-bounds, `true` otherwise.
+     * @copydoc prrng::GeneratorBase::lazy_gamma(const S&, double, double)
      */
-    template <class T>
-    bool inbounds(const T& index) const
+    template <class I, std::size_t L>
+    auto lazy_gamma(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        if (index.size() != m_strides.size()) {
-            return false;
-        }
-
-        for (size_t i = 0; i < m_strides.size(); ++i) {
-            if (index[i] >= m_shape[i]) {
-                return false;
-            }
-        }
-
-        return true;
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.gamma(k, scale); });
     }
 
     /**
-     * Per generator, generate an nd-array of random numbers \f$ 0 \leq r \leq 1 \f$.
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a Pareto
+     * distribution, see lazy_random() and pareto().
      *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @return The array of arrays of samples: [#shape, `ishape`]
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `shape`.
      */
     template <class S>
-    auto random(const S& ishape) -> typename detail::composite_return_type<double, M, S>::type
+    auto lazy_pareto(const S& shape, double k = 1, double scale = 1)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->random_impl<R>(ishape);
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.pareto(k, scale); });
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::random(const S&)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::GeneratorBase::lazy_pareto(const S&, double, double)
      */
-    template <class R, class S>
-    R random(const S& ishape)
+    template <class I, std::size_t L>
+    auto lazy_pareto(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        return this->random_impl<R>(ishape);
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.pareto(k, scale); });
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::random(const S&)
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a Weibull
+     * distribution, see lazy_random() and weibull().
+     *
+     * @param shape The shape of the nd-array.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `shape`.
      */
-    template <class I, std::size_t L>
-    auto random(const I (&ishape)[L]) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class S>
+    auto lazy_weibull(const S& shape, double k = 1, double scale = 1)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->random_impl<R>(detail::to_array(ishape));
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.weibull(k, scale); });
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::random(const S&)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::GeneratorBase::lazy_weibull(const S&, double, double)
      */
-    template <class R, class I, std::size_t L>
-    R random(const I (&ishape)[L])
+    template <class I, std::size_t L>
+    auto lazy_weibull(const I (&shape)[L], double k = 1, double scale = 1)
     {
-        return this->random_impl<R>(detail::to_array(ishape));
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.weibull(k, scale); });
     }
 
     /**
-     * Per generator, generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a normal
+     * distribution, see lazy_random() and normal().
      *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param high The upper bound of the interval.
-     * @return The array of arrays of samples: [#shape, `ishape`]
+     * @param shape The shape of the nd-array.
+     * @param mu Average.
+     * @param sigma Standard deviation.
+     * @return Expression of shape `shape`.
      */
-    template <class S, typename T>
-    auto randint(const S& ishape, T high) -> typename detail::composite_return_type<T, M, S>::type
+    template <class S>
+    auto lazy_normal(const S& shape, double mu = 0, double sigma = 1)
     {
-        using R = typename detail::composite_return_type<T, M, S>::type;
-        return this->randint_impl<R>(ishape, high);
+        return this->lazy_impl(shape, [mu, sigma](auto& g) { return g.normal(mu, sigma); });
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::GeneratorBase::lazy_normal(const S&, double, double)
      */
-    template <class R, class S, typename T>
-    R randint(const S& ishape, T high)
+    template <class I, std::size_t L>
+    auto lazy_normal(const I (&shape)[L], double mu = 0, double sigma = 1)
     {
-        return this->randint_impl<R>(ishape, high);
+        return this->lazy_impl(shape, [mu, sigma](auto& g) { return g.normal(mu, sigma); });
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
-     */
-    template <class I, std::size_t L, typename T>
-    auto randint(const I (&ishape)[L], T high) ->
-        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+private:
+    template <class S, class F>
+    auto lazy_impl(const S& shape, F draw)
     {
-        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
-        return this->randint_impl<R>(detail::to_array(ishape), high);
+        static_assert(
+            !std::is_same<Derived, pcg32_reference>::value,
+            "Lazy draws require a generator that holds its state"
+        );
+
+        Derived* gen = static_cast<Derived*>(this);
+        size_t n = detail::size(shape);
+        std::vector<Derived> copy(1, *gen);
+        gen->advance(static_cast<int64_t>(n));
+        return detail::make_lazy_draw(std::move(copy), shape, n, draw);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L, typename T>
-    R randint(const I (&ishape)[L], T high)
+    template <class I, std::size_t L, class F>
+    auto lazy_impl(const I (&shape)[L], F draw)
     {
-        return this->randint_impl<R>(detail::to_array(ishape), high);
+        std::array<size_t, L> s;
+        std::copy(shape, shape + L, s.begin());
+        return this->lazy_impl(s, draw);
     }
 
-    /**
-     * Per generator, generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param low The lower bound of the interval.
-     * @param high The upper bound of the interval.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S, typename T, typename U>
-    auto randint(const S& ishape, T low, U high) ->
-        typename detail::composite_return_type<T, M, S>::type
+    void draw_list_double(double* data, size_t n)
     {
-        using R = typename detail::composite_return_type<T, M, S>::type;
-        return this->randint_impl<R>(ishape, low, high);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<Derived*>(this)->next_double();
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class S, typename T, typename U>
-    R randint(const S& ishape, T low, U high)
+    void draw_list_positive_double(double* data, size_t n)
     {
-        return this->randint_impl<R>(ishape, low, high);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<Derived*>(this)->next_positive_double();
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
-     */
-    template <class I, std::size_t L, typename T, typename U>
-    auto randint(const I (&ishape)[L], T low, U high) ->
-        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+    void draw_list_float(float* data, size_t n)
     {
-        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
-        return this->randint_impl<R>(detail::to_array(ishape), low, high);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<Derived*>(this)->next_float();
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L, typename T, typename U>
-    R randint(const I (&ishape)[L], T low, U high)
+    void draw_list_positive_float(float* data, size_t n)
     {
-        return this->randint_impl<R>(detail::to_array(ishape), low, high);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<Derived*>(this)->next_positive_float();
+        }
     }
 
-    /**
-     * Per generator, generate an nd-array of numbers that are delta distribution.
-     * These numbers are not random; calling this function does not change the state of the
-     * generators.
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param scale The value of the 'peak' of the delta distribution.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S>
-    auto delta(const S& ishape, double scale = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    template <class T>
+    void draw_list_real(T* data, size_t n)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->delta_impl<R>(ishape, scale);
+        static_assert(
+            std::is_same<T, double>::value || std::is_same<T, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        if constexpr (std::is_same<T, float>::value) {
+            this->draw_list_float(data, n);
+        }
+        else {
+            this->draw_list_double(data, n);
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class S>
-    R delta(const S& ishape, double scale = 1)
+    template <class T>
+    void draw_list_positive_real(T* data, size_t n)
     {
-        return this->delta_impl<R>(ishape, scale);
+        static_assert(
+            std::is_same<T, double>::value || std::is_same<T, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        if constexpr (std::is_same<T, float>::value) {
+            this->draw_list_positive_float(data, n);
+        }
+        else {
+            this->draw_list_positive_double(data, n);
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
-     */
-    template <class I, std::size_t L>
-    auto delta(const I (&ishape)[L], double scale = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    void draw_list_uint32(uint32_t* data, uint32_t bound, size_t n)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->delta_impl<R>(detail::to_array(ishape), scale);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<Derived*>(this)->next_uint32(bound);
+        }
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R delta(const I (&ishape)[L], double scale = 1)
+    uint64_t next_bounded(uint64_t bound)
     {
-        return this->delta_impl<R>(detail::to_array(ishape), scale);
+        if (bound > std::numeric_limits<uint32_t>::max()) {
+            return this->next_uint64(bound);
+        }
+
+        Derived* gen = static_cast<Derived*>(this);
+        uint32_t b = static_cast<uint32_t>(bound);
+        return detail::lemire_uint32(gen->next_uint32(), b, [gen]() { return gen->next_uint32(); });
     }
 
-    /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to an exponential distribution.
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param scale Scale.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S>
-    auto exponential(const S& ishape, double scale = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    template <class R, class S, typename T, typename U>
+    R fast_randint_impl(const S& shape, T low, U high)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->exponential_impl<R>(ishape, scale);
+        using value_type = typename detail::allocate_return<R>::value_type;
+
+        static_assert(
+            std::numeric_limits<value_type>::max() >= std::numeric_limits<T>::max() &&
+                std::numeric_limits<value_type>::min() <= std::numeric_limits<T>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        PRRNG_ASSERT(high > low);
+
+        detail::allocate_return<R> ret(shape);
+        uint64_t offset = static_cast<uint64_t>(low);
+        uint64_t bound = static_cast<uint64_t>(high) - offset;
+        value_type* data = ret.data();
+
+        for (size_t i = 0; i < ret.size(); ++i) {
+            data[i] = static_cast<value_type>(offset + this->next_bounded(bound));
+        }
+
+        return std::move(ret.value);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
     template <class R, class S>
-    R exponential(const S& ishape, double scale = 1)
+    R positive_random_impl(const S& shape)
     {
-        return this->exponential_impl<R>(ishape, scale);
+        detail::allocate_return<R> ret(shape);
+        this->draw_list_positive_real(ret.data(), ret.size());
+        return std::move(ret.value);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
-     */
-    template <class I, std::size_t L>
-    auto exponential(const I (&ishape)[L], double scale = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class R, class S>
+    R random_impl(const S& shape)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->exponential_impl<R>(detail::to_array(ishape), scale);
+        detail::allocate_return<R> ret(shape);
+        this->draw_list_real(ret.data(), ret.size());
+        return std::move(ret.value);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R exponential(const I (&ishape)[L], double scale = 1)
+    template <class R, class S, typename T>
+    R randint_impl(const S& shape, T high)
     {
-        return this->exponential_impl<R>(detail::to_array(ishape), scale);
-    }
+        static_assert(
+            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
+                std::numeric_limits<T>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
 
-    /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to an power distribution.
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param k Scale.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S>
-    auto power(const S& ishape, double k = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
-    {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->power_impl<R>(ishape, k);
-    }
+        PRRNG_ASSERT(high >= 0);
+        PRRNG_ASSERT(static_cast<uint32_t>(high) < std::numeric_limits<uint32_t>::max());
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class S>
-    R power(const S& ishape, double k = 1)
-    {
-        return this->power_impl<R>(ishape, k);
+        detail::allocate_return<R> ret(shape);
+        std::vector<uint32_t> tmp(ret.size());
+        this->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high), ret.size());
+        std::copy(tmp.begin(), tmp.end(), ret.data());
+        return std::move(ret.value);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
-     */
-    template <class I, std::size_t L>
-    auto power(const I (&ishape)[L], double k = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class R, class S, typename T, typename U>
+    R randint_impl(const S& shape, T low, U high)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->power_impl<R>(detail::to_array(ishape), k);
+        static_assert(
+            std::numeric_limits<typename detail::allocate_return<R>::value_type>::min() >=
+                std::numeric_limits<T>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
+                std::numeric_limits<T>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename detail::allocate_return<R>::value_type>::min() >=
+                std::numeric_limits<U>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename detail::allocate_return<R>::value_type>::max() >=
+                std::numeric_limits<U>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        PRRNG_ASSERT(high - low >= 0);
+        PRRNG_ASSERT(static_cast<uint32_t>(high - low) < std::numeric_limits<uint32_t>::max());
+
+        detail::allocate_return<R> ret(shape);
+        std::vector<uint32_t> tmp(ret.size());
+        this->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high - low), ret.size());
+        std::copy(tmp.begin(), tmp.end(), ret.data());
+        return ret.value + low;
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R power(const I (&ishape)[L], double k = 1)
+    template <class R, class S>
+    R delta_impl(const S& shape, double scale)
     {
-        return this->power_impl<R>(detail::to_array(ishape), k);
+        detail::allocate_return<R> ret(shape);
+        ret.value.fill(scale);
+        return std::move(ret.value);
     }
 
-    /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to a Gamma distribution.
-     * Only available when compiled with PRRNG_USE_BOOST
-     * (e.g. using the CMake target `prrng::use_boost`).
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S>
-    auto gamma(const S& ishape, double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    template <class R, class S>
+    R exponential_impl(const S& shape, double scale)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->gamma_impl<R>(ishape, k, scale);
+        R r = this->random_impl<R>(shape);
+        return exponential_distribution(scale).quantile(r);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
     template <class R, class S>
-    R gamma(const S& ishape, double k = 1, double scale = 1)
+    R power_impl(const S& shape, double k)
     {
-        return this->gamma_impl<R>(ishape, k, scale);
+        R r = this->random_impl<R>(shape);
+        return power_distribution(k).quantile(r);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
-     */
-    template <class I, std::size_t L>
-    auto gamma(const I (&ishape)[L], double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class R, class S>
+    R gamma_impl(const S& shape, double k, double scale)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->gamma_impl<R>(detail::to_array(ishape), k, scale);
+        R r = this->random_impl<R>(shape);
+        return gamma_distribution(k, scale).quantile(r);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R gamma(const I (&ishape)[L], double k = 1, double scale = 1)
+    template <class R, class S>
+    R pareto_impl(const S& shape, double k, double scale)
     {
-        return this->gamma_impl<R>(detail::to_array(ishape), k, scale);
+        R r = this->random_impl<R>(shape);
+        return pareto_distribution(k, scale).quantile(r);
     }
 
-    /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to a Pareto distribution.
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param k The "shape" parameter \f$ k \f$.
-     * @param scale The "scale" parameter \f$ \lambda \f$.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
-    template <class S>
-    auto pareto(const S& ishape, double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    template <class R, class S>
+    R weibull_impl(const S& shape, double k, double scale)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->pareto_impl<R>(ishape, k, scale);
+        R r = this->random_impl<R>(shape);
+        return weibull_distribution(k, scale).quantile(r);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
     template <class R, class S>
-    R pareto(const S& ishape, double k = 1, double scale = 1)
+    R normal_impl(const S& shape, double mu, double sigma)
     {
-        return this->pareto_impl<R>(ishape, k, scale);
+        R r = this->positive_random_impl<R>(shape);
+        return normal_distribution(mu, sigma).quantile(r);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
-     */
-    template <class I, std::size_t L>
-    auto pareto(const I (&ishape)[L], double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class R, class S, class F>
+    R convert_impl(const S& shape, const F& convert)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->pareto_impl<R>(detail::to_array(ishape), k, scale);
+        using value_type = typename detail::allocate_return<R>::value_type;
+
+        static_assert(
+            std::is_same<value_type, double>::value || std::is_same<value_type, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        detail::allocate_return<R> ret(shape);
+        value_type* data = ret.data();
+        for (size_t i = 0; i < ret.size(); ++i) {
+            data[i] = convert(static_cast<Derived*>(this)->next_uint32());
+        }
+        return std::move(ret.value);
     }
 
-    /**
-     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
-     */
-    template <class R, class I, std::size_t L>
-    R pareto(const I (&ishape)[L], double k = 1, double scale = 1)
+    template <class F>
+    double cumsum_skip(size_t n, const F& sum)
     {
-        return this->pareto_impl<R>(detail::to_array(ishape), k, scale);
+        if (n == 0) {
+            return 0.0;
+        }
+
+        uint32_t r = static_cast<Derived*>(this)->next_uint32();
+        static_cast<Derived*>(this)->advance(static_cast<int64_t>(n - 1));
+        return sum(r, n);
     }
+};
 
-    /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to a Weibull distribution.
-     * Internally, the output of random() is converted using the cumulative density
-     *
-     * \f$ \Phi(x) = 1 - e^{-(x / \lambda)^k} \f$
-     *
-     * such that the output `r` from random() leads to
-     *
-     * \f$ x = \lambda (- \ln (1 - r))^{1 / k}) \f$
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param k The "shape" parameter \f$ k \f$.
-     * @param scale The "scale" parameter \f$ \lambda \f$.
-     * @return The array of arrays of samples: [#shape, `ishape`]
-     */
+namespace detail {
+
+/**
+ * @brief Output function of pcg32 (xorshift followed by a random rotation).
+ *
+ * @param state The state of the generator *before* it is advanced.
+ * @return Random number.
+ *
+ * @author Melissa O'Neill, http://www.pcg-random.org.
+ */
+inline uint32_t pcg32_output(uint64_t state)
+{
+    uint32_t xorshifted = static_cast<uint32_t>(((state >> 18u) ^ state) >> 27u);
+    uint32_t rot = static_cast<uint32_t>(state >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+/**
+ * @brief Jump-ahead table of pcg32: the affine map `state -> mult[k] * state + plus[k] * inc`
+ * advances any pcg32 generator by `2^k` increments.
+ * Since `plus[k]` is per unit increment the table is shared by all generators (any `inc`).
+ */
+struct pcg32_jump_table {
+    uint64_t mult[64]; ///< Multiplier to advance `2^k` increments.
+    uint64_t plus[64]; ///< Additive constant (per unit increment) to advance `2^k` increments.
+};
+
+/**
+ * @brief Construct the jump-ahead table, see detail::pcg32_jump_table.
+ * @return Table.
+ */
+constexpr pcg32_jump_table make_pcg32_jump_table()
+{
+    pcg32_jump_table ret{};
+    uint64_t cur_mult = PRRNG_PCG32_MULT;
+    uint64_t cur_plus = 1u;
+
+    for (size_t k = 0; k < 64; ++k) {
+        ret.mult[k] = cur_mult;
+        ret.plus[k] = cur_plus;
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Jump-ahead table of pcg32 (evaluated at compile-time).
+ */
+inline constexpr pcg32_jump_table pcg32_jumps = make_pcg32_jump_table();
+
+/**
+ * @brief Affine map to advance a pcg32 generator by `delta` increments:
+ * `state -> mult * state + plus * inc`.
+ *
+ * @param delta Number of increments.
+ * @param mult Multiplier (output).
+ * @param plus Additive constant per unit increment (output).
+ *
+ * @note The method used here is based on Brown, "Random Number Generation
+ * with Arbitrary Stride", Transactions of the American Nuclear Society (Nov. 1994).
+ * The algorithm is very similar to fast exponentiation,
+ * but the powers of two are read from detail::pcg32_jumps.
+ * Because the map is linear in `inc` the result is bit-identical to the original algorithm.
+ */
+inline void pcg32_jump(uint64_t delta, uint64_t& mult, uint64_t& plus)
+{
+    mult = 1u;
+    plus = 0u;
+
+    for (size_t k = 0; delta > 0; ++k, delta >>= 1) {
+        if (delta & 1) {
+            mult *= pcg32_jumps.mult[k];
+            plus = plus * pcg32_jumps.mult[k] + pcg32_jumps.plus[k];
+        }
+    }
+}
+
+/**
+ * @brief Advance the state of a pcg32 generator (jump-ahead, or jump-back by going the long way
+ * round).
+ *
+ * @param state Current state.
+ * @param inc Increment.
+ * @param delta Number of increments.
+ * @return New state.
+ *
+ * @note See detail::pcg32_jump().
+ *
+ * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+ */
+inline uint64_t pcg32_advance(uint64_t state, uint64_t inc, uint64_t delta)
+{
+    if (delta == 1) {
+        return state * PRRNG_PCG32_MULT + inc;
+    }
+
+    uint64_t mult;
+    uint64_t plus;
+    pcg32_jump(delta, mult, plus);
+    return mult * state + plus * inc;
+}
+
+/**
+ * @brief Number of increments to go from `other_state` to `state` (modulo 2^64).
+ *
+ * @param state Target state.
+ * @param other_state Reference state.
+ * @param inc Increment (must be the same for both states).
+ * @return Distance.
+ *
+ * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+ */
+inline uint64_t pcg32_distance(uint64_t state, uint64_t other_state, uint64_t inc)
+{
+    uint64_t cur_state = other_state;
+    uint64_t the_bit = 1u;
+    uint64_t distance = 0u;
+
+    for (size_t k = 0; state != cur_state; ++k) {
+        if ((state & the_bit) != (cur_state & the_bit)) {
+            cur_state = cur_state * pcg32_jumps.mult[k] + pcg32_jumps.plus[k] * inc;
+            distance |= the_bit;
+        }
+        PRRNG_DEBUG((state & the_bit) == (cur_state & the_bit));
+        the_bit <<= 1;
+    }
+
+    return distance;
+}
+
+/**
+ * @brief State of a pcg32 generator just after seeding, see prrng::pcg32::seed().
+ *
+ * @param initstate State initiator.
+ * @param initseq Sequence initiator.
+ * @return State.
+ */
+inline uint64_t pcg32_seed(uint64_t initstate, uint64_t initseq)
+{
+    uint64_t inc = (initseq << 1u) | 1u;
+    return (inc + initstate) * PRRNG_PCG32_MULT + inc;
+}
+
+/**
+ * @brief Convert a random `uint32_t` to a float on the interval [0, 1).
+ * The result is identical to prrng::pcg32::next_float(): `(1 + (r >> 9) / 2^23) - 1` is exact.
+ */
+struct uint32_to_float {
+    float operator()(uint32_t r) const
+    {
+        return static_cast<float>(r >> 9) * 1.1920928955078125e-07f;
+    }
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a float on the interval (0, 1).
+ * The result is identical to prrng::pcg32::next_positive_float().
+ */
+struct uint32_to_positive_float {
+    float operator()(uint32_t r) const
+    {
+        return (r >> 9) == 0 ? 1.1920928955078125e-07f
+                             : static_cast<float>(r >> 9) * 1.1920928955078125e-07f;
+    }
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a double on the interval [0, 1).
+ * The result is identical to prrng::pcg32::next_double(): `(1 + r / 2^32) - 1` is exact.
+ */
+struct uint32_to_double {
+    double operator()(uint32_t r) const
+    {
+        return static_cast<double>(r) * 2.3283064365386962890625e-10;
+    }
+};
+
+/**
+ * @brief Convert a random `uint32_t` to a double on the interval (0, 1).
+ * The result is identical to prrng::pcg32::next_positive_double().
+ */
+struct uint32_to_positive_double {
+    double operator()(uint32_t r) const
+    {
+        return r == 0 ? 2.220446049250313080847263336181640625e-16
+                      : static_cast<double>(r) * 2.3283064365386962890625e-10;
+    }
+};
+
+/**
+ * @brief Draw `n` random numbers for each of `ngen` pcg32 generators, whose state is stored
+ * contiguously. Generators are advanced #PRRNG_PCG32_LANES at a time in lock-step,
+ * such that the inner loop has no dependencies and can be vectorised.
+ * The output is identical to drawing `n` numbers from each generator in turn.
+ *
+ * @param state State of each generator (updated) [ngen].
+ * @param inc Increment of each generator [ngen].
+ * @param ngen Number of generators.
+ * @param n Number of random numbers per generator.
+ * @param data Output, row-major [ngen, n] (no bounds-check).
+ * @param convert Conversion of the random `uint32_t` to the output type.
+ */
+template <class T, class F>
+inline void
+pcg32_lanes(uint64_t* state, const uint64_t* inc, size_t ngen, size_t n, T* data, const F& convert)
+{
+    constexpr size_t L = PRRNG_PCG32_LANES;
+    size_t i = 0;
+
+    for (; i + L <= ngen; i += L) {
+        uint64_t s[L];
+        uint64_t c[L];
+        T* out = &data[i * n];
+
+        for (size_t l = 0; l < L; ++l) {
+            s[l] = state[i + l];
+            c[l] = inc[i + l];
+        }
+
+        for (size_t j = 0; j < n; ++j) {
+            for (size_t l = 0; l < L; ++l) {
+                uint64_t old = s[l];
+                s[l] = old * PRRNG_PCG32_MULT + c[l];
+                out[l * n + j] = convert(pcg32_output(old));
+            }
+        }
+
+        for (size_t l = 0; l < L; ++l) {
+            state[i + l] = s[l];
+        }
+    }
+
+    for (; i < ngen; ++i) {
+        uint64_t s = state[i];
+        uint64_t c = inc[i];
+        T* out = &data[i * n];
+
+        for (size_t j = 0; j < n; ++j) {
+            uint64_t old = s;
+            s = old * PRRNG_PCG32_MULT + c;
+            out[j] = convert(pcg32_output(old));
+        }
+
+        state[i] = s;
+    }
+}
+
+/**
+ * @brief Number of generators for which decisions are taken at once by an array of generators
+ * (prrng::GeneratorBase_array::decide()). Multiple of 8 such that a block fills whole bytes
+ * of the bit-packed output (prrng::GeneratorBase_array::decide_packed()).
+ */
+constexpr size_t decide_block_size = 64;
+
+/**
+ * @brief Integer threshold `t` such that, for a random `uint32_t` `r`, `r < t` is identical
+ * to `uint32_to_double{}(r) < p` (i.e. to `pcg32::next_double() < p`).
+ * The conversion is an exact scaling by 2^-32, such that `t = ceil(p * 2^32)`,
+ * clipped to [0, 2^32] (`0` for NaN).
+ *
+ * @param p Probability.
+ * @return Threshold.
+ */
+inline uint64_t decide_threshold(double p)
+{
+    double t = std::ceil(p * 4294967296.0);
+    t = t > 0.0 ? t : 0.0;
+    t = t < 4294967296.0 ? t : 4294967296.0;
+    return static_cast<uint64_t>(t);
+}
+
+/**
+ * @brief Take one decision for each of `ngen` pcg32 generators, whose state is stored
+ * contiguously. The decision is identical to `next_double() < p`, but is taken without
+ * branches by comparing the raw random number to detail::decide_threshold().
+ * Where `mask` is `true` the decision is `false` and the state is not advanced.
+ *
+ * @param state State of each generator (updated) [ngen].
+ * @param inc Increment of each generator [ngen].
+ * @param p Probability per generator [ngen].
+ * @param mask Mask per generator [ngen] (`nullptr` for no mask).
+ * @param ngen Number of generators.
+ * @param ret Decision per generator [ngen].
+ */
+inline void pcg32_decide(
+    uint64_t* state,
+    const uint64_t* inc,
+    const double* p,
+    const bool* mask,
+    size_t ngen,
+    bool* ret
+)
+{
+    if (mask == nullptr) {
+        for (size_t i = 0; i < ngen; ++i) {
+            uint64_t old = state[i];
+            state[i] = old * PRRNG_PCG32_MULT + inc[i];
+            ret[i] = pcg32_output(old) < decide_threshold(p[i]);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < ngen; ++i) {
+        uint64_t old = state[i];
+        uint64_t keep = uint64_t(0) - static_cast<uint64_t>(mask[i]); // all bits set if masked
+        state[i] = (old & keep) | ((old * PRRNG_PCG32_MULT + inc[i]) & ~keep);
+        ret[i] = !mask[i] & (pcg32_output(old) < decide_threshold(p[i]));
+    }
+}
+
+/**
+ * @brief Pack `n` booleans in bytes: `d[i]` is bit `i % 8` of `ret[i / 8]`
+ * (as `numpy.packbits(d, bitorder="little")`).
+ *
+ * @param d Booleans [n].
+ * @param n Number of booleans.
+ * @param ret Packed bits [(n + 7) / 8].
+ */
+inline void pack_bits(const bool* d, size_t n, uint8_t* ret)
+{
+    for (size_t b = 0; b * 8 < n; ++b) {
+        size_t m = std::min(static_cast<size_t>(8), n - b * 8);
+        uint8_t byte = 0;
+        for (size_t l = 0; l < m; ++l) {
+            byte |= static_cast<uint8_t>(static_cast<uint8_t>(d[b * 8 + l]) << l);
+        }
+        ret[b] = byte;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Precomputed jump (of a fixed distance) that can be applied to any pcg32 generator.
+ * Applying the jump costs two multiplications, independent of the distance.
+ * Use this to repeatedly jump by the same distance, e.g. the size of a chunk.
+ * See prrng::pcg32::advance(const pcg32_stride&).
+ */
+class pcg32_stride {
+public:
+    pcg32_stride() = default;
+
+    /**
+     * @param distance Distance to jump ahead or jump back (depending on the sign).
+     */
+    template <typename T>
+    explicit pcg32_stride(T distance)
+    {
+        static_assert(sizeof(int64_t) >= sizeof(T), "Down-casting not allowed.");
+        m_distance = static_cast<int64_t>(distance);
+        detail::pcg32_jump((uint64_t)m_distance, m_mult, m_plus);
+    }
+
+    /**
+     * @brief Distance of the jump.
+     * @return Signed integer.
+     */
+    template <typename R = int64_t>
+    R distance() const
+    {
+        return static_cast<R>(m_distance);
+    }
+
+    /**
+     * @brief Apply the jump to a state.
+     * @param state Current state.
+     * @param inc Increment of the generator.
+     * @return New state.
+     */
+    uint64_t apply(uint64_t state, uint64_t inc) const
+    {
+        return m_mult * state + m_plus * inc;
+    }
+
+private:
+    int64_t m_distance = 0; ///< Distance of the jump.
+    uint64_t m_mult = 1u; ///< Multiplier, see detail::pcg32_jump().
+    uint64_t m_plus = 0u; ///< Additive constant per unit increment, see detail::pcg32_jump().
+};
+
+/**
+ * Random number generate using the pcg32 algorithm.
+ * The class generate random 32-bit random numbers (of type `uint32_t`).
+ * In addition, they can be converted to nd-arrays of random floating-point numbers (according)
+ * using derived methods from Generate().
+ *
+ * The algorithm is full based on:
+ *
+ *     The PCG random number generator was developed by Melissa O'Neill
+ *     <oneill@pcg-random.org>
+ *
+ *     Licensed under the Apache License, Version 2.0 (the "License");
+ *     you may not use this file except in compliance with the License.
+ *     You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ *
+ *     For additional information about the PCG random number generation scheme,
+ *     including its license and other licensing options, visit
+ *
+ *         http://www.pcg-random.org
+ *
+ * Whereby most code is taken from the follow wrapper:
+ *
+ *     Wenzel Jakob, February 2015
+ *     https://github.com/wjakob/pcg32
+ */
+class pcg32 : public GeneratorBase<pcg32> {
+    template <class G, class S>
+    friend class pcg32_arrayBase;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator.
+     * @param initseq Sequence initiator.
+     */
+    template <typename T = uint64_t, typename S = uint64_t>
+    pcg32(T initstate = PRRNG_PCG32_INITSTATE, S initseq = PRRNG_PCG32_INITSEQ)
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
+        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
+    }
+
+    /**
+     * @brief Seed the generator (constructor alias).
+     *
+     * @param initstate Initial state.
+     * @param initseq Initial sequence.
+     */
+    void seed(uint64_t initstate = PRRNG_PCG32_INITSTATE, uint64_t initseq = PRRNG_PCG32_INITSEQ)
+    {
+        m_initstate = initstate;
+        m_initseq = initseq;
+        m_inc = (initseq << 1u) | 1u;
+        m_state = detail::pcg32_seed(initstate, initseq);
+    }
+
+    /**
+     * Draw new random number (uniformly distributed, `0 <= r <= max(uint32_t)`).
+     * This advances the state of the generator by one increment.
+     *
+     * @return Next random number in sequence.
+     *
+     * @author Melissa O'Neill, http://www.pcg-random.org.
+     */
+    uint32_t operator()()
+    {
+        uint64_t oldstate = m_state;
+        m_state = oldstate * PRRNG_PCG32_MULT + m_inc;
+        return detail::pcg32_output(oldstate);
+    }
+
+    /**
+     * Draw new random number (uniformly distributed, `0 <= r <= max(uint32_t)`).
+     * This advances the state of the generator by one increment.
+     *
+     * @return Next random number in sequence.
+     *
+     * @note Wrapper around operator().
+     */
+    uint32_t next_uint32()
+    {
+        return (*this)();
+    }
+
+    /**
+     * Draw new random number (uniformly distributed, `0 <= r <= bound`).
+     *
+     * @param bound Bound on the return.
+     * @return Next random number in sequence.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    uint32_t next_uint32(uint32_t bound)
+    {
+        // To avoid bias, we need to make the range of the RNG a multiple of
+        // bound, which we do by dropping output less than a threshold.
+        // A naive scheme to calculate the threshold would be to do
+        //
+        //     uint32_t threshold = 0x100000000ull % bound;
+        //
+        // but 64-bit div/mod is slower than 32-bit div/mod (especially on
+        // 32-bit platforms).  In essence, we do
+        //
+        //     uint32_t threshold = (0x100000000ull-bound) % bound;
+        //
+        // because this version will calculate the same modulus, but the LHS
+        // value is less than 2^32.
+
+        uint32_t threshold = (~bound + 1u) % bound;
+
+        // Uniformity guarantees that this loop will terminate.  In practice, it
+        // should usually terminate quickly; on average (assuming all bounds are
+        // equally likely), 82.25% of the time, we can expect it to require just
+        // one iteration.  In the worst case, someone passes a bound of 2^31 + 1
+        // (i.e., 2147483649), which invalidates almost 50% of the range.  In
+        // practice, bounds are typically small and only a tiny amount of the range
+        // is eliminated.
+        for (;;) {
+            uint32_t r = next_uint32();
+            if (r >= threshold) {
+                return r % bound;
+            }
+        }
+    }
+
+    /**
+     * Generate a single precision floating point value on the interval [0, 1).
+     *
+     * @return Next random number in sequence.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    float next_float()
+    {
+        // Trick from MTGP: generate an uniformly distributed
+        // single precision number in [1,2) and subtract 1.
+        union {
+            uint32_t u;
+            float f;
+        } x;
+        x.u = (next_uint32() >> 9) | 0x3f800000u;
+        return x.f - 1.0f;
+    }
+
+    /**
+     * @brief Generate a single precision floating point value on the interval (0, 1).
+     * @return Next random number in sequence.
+     */
+    float next_positive_float()
+    {
+        union {
+            uint32_t u;
+            float f;
+        } x;
+
+        x.u = (next_uint32() >> 9) | 0x3f800000u;
+
+        if (x.u == 0x3f800000u) {
+            x.u += 1;
+        }
+
+        return x.f - 1.0f;
+    }
+
+    /**
+     * Generate a double precision floating point value on the interval [0, 1).
+     *
+     * @return Next random number in sequence.
+     *
+     * @remark Since the underlying random number generator produces 32 bit output,
+     * only the first 32 mantissa bits will be filled (however, the resolution is still
+     * finer than in next_float(), which only uses 23 mantissa bits).
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    double next_double()
+    {
+        union {
+            uint64_t u;
+            double d;
+        } x;
+
+        x.u = ((uint64_t)next_uint32() << 20) | 0x3ff0000000000000ULL;
+
+        return x.d - 1.0;
+    }
+
+    /**
+     * @brief Generate a double precision floating point value on the interval (0, 1).
+     * @return Next random number in sequence.
+     */
+    double next_positive_double()
+    {
+        union {
+            uint64_t u;
+            double d;
+        } x;
+
+        x.u = ((uint64_t)next_uint32() << 20) | 0x3ff0000000000000ULL;
+
+        if (x.u == 0x3ff0000000000000ULL) {
+            x.u += 1;
+        }
+
+        return x.d - 1.0;
+    }
+
+    /**
+     * The current "state" of the generator. If the same initseq() is used, this exact point
+     * in the sequence can be restored with restore().
+     *
+     * @return State of the generator.
+     */
+    uint64_t state() const
+    {
+        return m_state;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::state() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R state()
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_state)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_state)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_state);
+    }
+
+    /**
+     * The state initiator that was used upon construction.
+     *
+     * @return initiator.
+     */
+    uint64_t initstate() const
+    {
+        return m_initstate;
+    }
+
+    /**
+     * @copydoc initstate()
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initstate() const
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initstate)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initstate)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_initstate);
+    }
+
+    /**
+     * The sequence initiator that was used upon construction.
+     *
+     * @return initiator.
+     */
+    uint64_t initseq() const
+    {
+        return m_initseq;
+    }
+
+    /**
+     * @copydoc initseq()
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initseq() const
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initseq)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initseq)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_initseq);
+    }
+
+    /**
+     * Restore a given state in the sequence. See state().
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename T>
+    void restore(T state)
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        m_state = static_cast<uint64_t>(state);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     */
+    int64_t operator-(const pcg32& other) const
+    {
+        PRRNG_DEBUG(m_inc == other.m_inc);
+        return (int64_t)detail::pcg32_distance(m_state, other.m_state, m_inc);
+    }
+
+    /**
+     * The distance between two PCG32 pseudorandom number generators.
+     *
+     * @tparam R
+     *     Return-type.
+     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
+     *
+     * @return Distance.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    template <typename R = int64_t>
+    R distance(const pcg32& other) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        int64_t r = this->operator-(other);
+
+#ifdef PRRNG_ENABLE_DEBUG
+        bool u = std::is_unsigned<R>::value;
+        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
+#endif
+
+        return static_cast<R>(r);
+    }
+
+    /**
+     * The distance between two states.
+     *
+     * @tparam R
+     *     Return-type.
+     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
+     *
+     * @return Distance.
+     *
+     * @warning The increment of used to generate must be the same. There is no way of checking
+     * here!
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    template <
+        typename R = int64_t,
+        typename T,
+        std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    R distance(T other_state) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+
+        int64_t r =
+            (int64_t)detail::pcg32_distance(m_state, static_cast<uint64_t>(other_state), m_inc);
+
+#ifdef PRRNG_ENABLE_DEBUG
+        bool u = std::is_unsigned<R>::value;
+        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
+#endif
+
+        return static_cast<R>(r);
+    }
+
+    /**
+     * Multi-step advance function (jump-ahead, jump-back).
+     *
+     * @param distance Distance to jump ahead or jump back (depending on the sign).
+     * This changes that state of the generator by the appropriate number of increments.
+     *
+     * @note The method used here is based on Brown, "Random Number Generation
+     * with Arbitrary Stride", Transactions of the American Nuclear Society (Nov. 1994).
+     * The algorithm is very similar to fast exponentiation.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    template <typename T>
+    void advance(T distance)
+    {
+        static_assert(sizeof(int64_t) >= sizeof(T), "Down-casting not allowed.");
+
+        int64_t delta_ = static_cast<int64_t>(distance);
+
+        // Even though delta is an unsigned integer, we can pass a signed
+        // integer to go backwards, it just goes "the long way round".
+        m_state = detail::pcg32_advance(m_state, m_inc, (uint64_t)delta_);
+    }
+
+    /**
+     * Advance by a precomputed distance.
+     * This is cheaper than advance(T) if the same distance is used repeatedly.
+     *
+     * @param stride Precomputed jump.
+     */
+    void advance(const pcg32_stride& stride)
+    {
+        m_state = stride.apply(m_state, m_inc);
+    }
+
+    /**
+     * Equality operator.
+     *
+     * @param other The generator to which to compare.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    bool operator==(const pcg32& other) const
+    {
+        return m_state == other.m_state && m_inc == other.m_inc;
+    }
+
+    /**
+     * Inequality operator.
+     *
+     * @param other The generator to which to compare.
+     *
+     * @author Wenzel Jakob, https://github.com/wjakob/pcg32.
+     */
+    bool operator!=(const pcg32& other) const
+    {
+        return m_state != other.m_state || m_inc != other.m_inc;
+    }
+
+protected:
+    uint64_t m_initstate; ///< State initiator
+    uint64_t m_initseq; ///< Sequence initiator
+    uint64_t m_state; ///< RNG state. All values are possible.
+    uint64_t m_inc; ///< Controls which RNG sequence (stream) is selected. Must *always* be odd.
+};
+
+/**
+ * @brief Overload of prrng::pcg32() that keeps track of the current index of the generator
+ * in the sequence.
+ *
+ * @warning The user is responsible for updating the index.
+ * The purpose of this class is therefore mostly internal, to support prrng::pcg32_cumsum().
+ */
+class pcg32_index : public pcg32 {
+private:
+    ptrdiff_t m_index; ///< Index of the generator
+    bool m_delta; ///< Signal if uniquely a delta distribution will be drawn
+
+public:
+    /**
+     * @param initstate State initiator.
+     * @param initseq Sequence initiator.
+     * @param delta `true` if uniquely a delta distribution will be drawn.
+     */
+    template <typename T = uint64_t, typename S = uint64_t>
+    pcg32_index(
+        T initstate = PRRNG_PCG32_INITSTATE,
+        S initseq = PRRNG_PCG32_INITSEQ,
+        bool delta = false
+    )
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
+        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
+        m_index = 0;
+        m_delta = delta;
+    }
+
+    /**
+     * @brief State at a specific index of the sequence.
+     * Internally the generator is moved to the index, the state is stored,
+     * and the generator is restored to its original state.
+     * This call can therefore be expensive.
+     *
+     * @param index Index at which to get the state.
+     * @return uint64_t
+     */
+    uint64_t state_at(ptrdiff_t index)
+    {
+        if (m_delta) {
+            return m_state;
+        }
+        uint64_t state = m_state;
+        this->advance(index - m_index);
+        uint64_t ret = m_state;
+        this->restore(state);
+        return ret;
+    }
+
+    /**
+     * @brief Move to a certain index.
+     * @param index Index of the generator.
+     */
+    void jump_to(ptrdiff_t index)
+    {
+        if (m_delta) {
+            return;
+        }
+        this->advance(index - m_index);
+        m_index = index;
+    }
+
+    /**
+     * @brief Move to a certain index, reusing the last jump if the distance is the same.
+     * Repeated jumps of the same distance (e.g. shifting a chunk by its size) then cost
+     * only two multiplications.
+     *
+     * @param index Index of the generator.
+     * @param jump Last jump (updated if the distance is different).
+     */
+    void jump_to(ptrdiff_t index, pcg32_stride& jump)
+    {
+        if (m_delta) {
+            return;
+        }
+        ptrdiff_t distance = index - m_index;
+        if (distance != jump.distance<ptrdiff_t>()) {
+            jump = pcg32_stride(distance);
+        }
+        this->advance(jump);
+        m_index = index;
+    }
+
+    /**
+     * @brief Update the generator index with the number of items you have drawn.
+     * @param n Number of drawn numbers.
+     */
+    void drawn(ptrdiff_t n)
+    {
+        if (m_delta) {
+            return;
+        }
+        m_index += n;
+    }
+
+    /**
+     * @brief Signal if the generator is uniquely used to draw a delta distribution.
+     * @param delta `true` if uniquely a delta distribution will be drawn.
+     */
+    void set_delta(bool delta)
+    {
+        m_delta = delta;
+    }
+
+    /**
+     * @brief Get the generator index.
+     * @return Index of the generator.
+     */
+    ptrdiff_t index() const
+    {
+        return m_index;
+    }
+
+    /**
+     * @brief Overwrite the generator index.
+     * @param index Index of the generator.
+     */
+    void set_index(ptrdiff_t index)
+    {
+        m_index = index;
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Philox4x32-10 block function of Salmon et al. (2011), "Parallel random numbers:
+ * as easy as 1, 2, 3": four random `uint32_t` as a pure function of a counter and a key.
+ *
+ * @param ctr Counter (4 words).
+ * @param key Key (2 words).
+ * @param out Output (4 words, modified).
+ */
+inline void philox4x32(const uint32_t* ctr, const uint32_t* key, uint32_t* out)
+{
+    uint32_t c0 = ctr[0];
+    uint32_t c1 = ctr[1];
+    uint32_t c2 = ctr[2];
+    uint32_t c3 = ctr[3];
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+
+    for (size_t r = 0; r < 10; ++r) {
+        uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * c0;
+        uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * c2;
+        c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+        c1 = static_cast<uint32_t>(p1);
+        c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+        c3 = static_cast<uint32_t>(p0);
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+} // namespace detail
+
+/**
+ * @brief Counter-based random number generator (Philox4x32-10).
+ *
+ * The `i`-th random `uint32_t` of the sequence is a pure function of (key, stream, `i`):
+ * output `i % 4` of the Philox block function applied to the counter `{i / 4, stream}`
+ * with key `initstate`. The sequence is selected by `initstate` (the key) and
+ * `initseq` (the stream), each sequence has 2^64 entries.
+ *
+ * The API is that of prrng::pcg32(), whereby the "state" is simply the index in the sequence.
+ * Consequently, advance(), restore(), and distance() are of constant cost,
+ * and the random number at any index can be obtained without changing the state using at().
+ * The last computed block of four numbers is cached, such that drawing numbers one by one
+ * costs one block function per four numbers.
+ *
+ * Reference:
+ *
+ *      J.K. Salmon, M.A. Moraes, R.O. Dror, D.E. Shaw,
+ *      "Parallel random numbers: as easy as 1, 2, 3",
+ *      Proceedings of SC'11 (2011), https://doi.org/10.1145/2063384.2063405
+ */
+class philox : public GeneratorBase<philox> {
+public:
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator (the key).
+     * @param initseq Sequence initiator (the stream).
+     */
+    template <typename T = uint64_t, typename S = uint64_t>
+    philox(T initstate = PRRNG_PCG32_INITSTATE, S initseq = PRRNG_PCG32_INITSEQ)
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
+        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
+    }
+
+    /**
+     * @brief Seed the generator (constructor alias).
+     *
+     * @param initstate Initial state (the key).
+     * @param initseq Initial sequence (the stream).
+     */
+    void seed(uint64_t initstate = PRRNG_PCG32_INITSTATE, uint64_t initseq = PRRNG_PCG32_INITSEQ)
+    {
+        m_initstate = initstate;
+        m_initseq = initseq;
+        m_state = 0;
+        m_block = std::numeric_limits<uint64_t>::max();
+    }
+
+    /**
+     * @brief Random number at a given index of the sequence.
+     * This does not use or change the state of the generator.
+     *
+     * @param index Index in the sequence.
+     * @return Random number.
+     */
+    uint32_t at(uint64_t index) const
+    {
+        uint32_t block[4];
+        this->compute_block(index >> 2, block);
+        return block[index & 3u];
+    }
+
+    /**
+     * Draw new random number (uniformly distributed, `0 <= r <= max(uint32_t)`).
+     * This advances the state of the generator by one increment.
+     *
+     * @return Next random number in sequence.
+     */
+    uint32_t operator()()
+    {
+        uint64_t block = m_state >> 2;
+
+        if (block != m_block) {
+            this->compute_block(block, m_cache);
+            m_block = block;
+        }
+
+        return m_cache[m_state++ & 3u];
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_uint32()
+     */
+    uint32_t next_uint32()
+    {
+        return (*this)();
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_uint32(uint32_t)
+     */
+    uint32_t next_uint32(uint32_t bound)
+    {
+        uint32_t threshold = (~bound + 1u) % bound;
+
+        for (;;) {
+            uint32_t r = next_uint32();
+            if (r >= threshold) {
+                return r % bound;
+            }
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_float()
+     */
+    float next_float()
+    {
+        return detail::uint32_to_float{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_positive_float()
+     */
+    float next_positive_float()
+    {
+        return detail::uint32_to_positive_float{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_double()
+     */
+    double next_double()
+    {
+        return detail::uint32_to_double{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_positive_double()
+     */
+    double next_positive_double()
+    {
+        return detail::uint32_to_positive_double{}(next_uint32());
+    }
+
+    /**
+     * The current "state" of the generator: the index in the sequence.
+     * If the same initstate() and initseq() are used, this exact point in the sequence can be
+     * restored with restore().
+     *
+     * @return State of the generator.
+     */
+    uint64_t state() const
+    {
+        return m_state;
+    }
+
+    /**
+     * @copydoc prrng::philox::state() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R state()
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_state)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_state)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_state);
+    }
+
+    /**
+     * The state initiator (the key) that was used upon construction.
+     *
+     * @return initiator.
+     */
+    uint64_t initstate() const
+    {
+        return m_initstate;
+    }
+
+    /**
+     * @copydoc prrng::philox::initstate() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initstate() const
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initstate)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initstate)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_initstate);
+    }
+
+    /**
+     * The sequence initiator (the stream) that was used upon construction.
+     *
+     * @return initiator.
+     */
+    uint64_t initseq() const
+    {
+        return m_initseq;
+    }
+
+    /**
+     * @copydoc prrng::philox::initseq() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initseq() const
+    {
+        static_assert(
+            std::numeric_limits<R>::max() >= std::numeric_limits<decltype(m_initseq)>::max(),
+            "Down-casting not allowed."
+        );
+
+        static_assert(
+            std::numeric_limits<R>::min() <= std::numeric_limits<decltype(m_initseq)>::min(),
+            "Down-casting not allowed."
+        );
+
+        return static_cast<R>(m_initseq);
+    }
+
+    /**
+     * Restore a given state in the sequence. See state().
+     *
+     * @param state The state (index in the sequence).
+     */
+    template <typename T>
+    void restore(T state)
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        m_state = static_cast<uint64_t>(state);
+    }
+
+    /**
+     * @copydoc prrng::philox::distance(const philox&) const
+     */
+    int64_t operator-(const philox& other) const
+    {
+        PRRNG_DEBUG(m_initstate == other.m_initstate && m_initseq == other.m_initseq);
+        return static_cast<int64_t>(m_state - other.m_state);
+    }
+
+    /**
+     * The distance between two generators (of the same sequence).
+     *
+     * @tparam R
+     *     Return-type.
+     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
+     *
+     * @return Distance.
+     */
+    template <typename R = int64_t>
+    R distance(const philox& other) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        int64_t r = this->operator-(other);
+
+#ifdef PRRNG_ENABLE_DEBUG
+        bool u = std::is_unsigned<R>::value;
+        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
+#endif
+
+        return static_cast<R>(r);
+    }
+
+    /**
+     * The distance between two states.
+     *
+     * @tparam R
+     *     Return-type.
+     *     `static_assert` against down-casting, #PRRNG_DEBUG against loss of signedness.
+     *
+     * @return Distance.
+     */
+    template <
+        typename R = int64_t,
+        typename T,
+        std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    R distance(T other_state) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        int64_t r = static_cast<int64_t>(m_state - static_cast<uint64_t>(other_state));
+
+#ifdef PRRNG_ENABLE_DEBUG
+        bool u = std::is_unsigned<R>::value;
+        PRRNG_DEBUG((r < 0 && !u) || r >= 0);
+#endif
+
+        return static_cast<R>(r);
+    }
+
+    /**
+     * Jump ahead or jump back (depending on the sign).
+     * This is of constant cost.
+     *
+     * @param distance Distance to jump.
+     */
+    template <typename T>
+    void advance(T distance)
+    {
+        static_assert(sizeof(int64_t) >= sizeof(T), "Down-casting not allowed.");
+        m_state += static_cast<uint64_t>(static_cast<int64_t>(distance));
+    }
+
+    /**
+     * Equality operator.
+     *
+     * @param other The generator to which to compare.
+     */
+    bool operator==(const philox& other) const
+    {
+        return m_state == other.m_state && m_initstate == other.m_initstate &&
+               m_initseq == other.m_initseq;
+    }
+
+    /**
+     * Inequality operator.
+     *
+     * @param other The generator to which to compare.
+     */
+    bool operator!=(const philox& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    /**
+     * @brief Compute a block of four random numbers.
+     *
+     * @param block Index of the block (the first word of the counter).
+     * @param out Output (4 words, modified).
+     */
+    void compute_block(uint64_t block, uint32_t* out) const
+    {
+        uint32_t ctr[4] = {
+            static_cast<uint32_t>(block),
+            static_cast<uint32_t>(block >> 32),
+            static_cast<uint32_t>(m_initseq),
+            static_cast<uint32_t>(m_initseq >> 32)
+        };
+        uint32_t key[2] = {
+            static_cast<uint32_t>(m_initstate), static_cast<uint32_t>(m_initstate >> 32)
+        };
+        detail::philox4x32(ctr, key, out);
+    }
+
+protected:
+    uint64_t m_initstate; ///< State initiator (the key).
+    uint64_t m_initseq; ///< Sequence initiator (the stream).
+    uint64_t m_state; ///< Index in the sequence.
+    uint64_t m_block; ///< Index of the block in #m_cache.
+    uint32_t m_cache[4]; ///< Last computed block.
+};
+
+/**
+ * @brief Overload of prrng::philox() that keeps track of the current index of the generator
+ * in the sequence, with the same API as prrng::pcg32_index().
+ * Both state_at() and jump_to() are of constant cost.
+ *
+ * @warning The user is responsible for updating the index.
+ * The purpose of this class is therefore mostly internal, to support prrng::philox_array_cumsum().
+ */
+class philox_index : public philox {
+private:
+    ptrdiff_t m_index; ///< Index of the generator
+    bool m_delta; ///< Signal if uniquely a delta distribution will be drawn
+
+public:
+    /**
+     * @param initstate State initiator (the key).
+     * @param initseq Sequence initiator (the stream).
+     * @param delta `true` if uniquely a delta distribution will be drawn.
+     */
+    template <typename T = uint64_t, typename S = uint64_t>
+    philox_index(
+        T initstate = PRRNG_PCG32_INITSTATE,
+        S initseq = PRRNG_PCG32_INITSEQ,
+        bool delta = false
+    )
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        static_assert(sizeof(uint64_t) >= sizeof(S), "Down-casting not allowed.");
+        this->seed(static_cast<uint64_t>(initstate), static_cast<uint64_t>(initseq));
+        m_index = 0;
+        m_delta = delta;
+    }
+
+    /**
+     * @brief State at a specific index of the sequence.
+     * @param index Index at which to get the state.
+     * @return uint64_t
+     */
+    uint64_t state_at(ptrdiff_t index) const
+    {
+        if (m_delta) {
+            return m_state;
+        }
+        return m_state + static_cast<uint64_t>(index - m_index);
+    }
+
+    /**
+     * @brief Move to a certain index.
+     * @param index Index of the generator.
+     */
+    void jump_to(ptrdiff_t index)
+    {
+        if (m_delta) {
+            return;
+        }
+        m_state += static_cast<uint64_t>(index - m_index);
+        m_index = index;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::drawn(ptrdiff_t)
+     */
+    void drawn(ptrdiff_t n)
+    {
+        if (m_delta) {
+            return;
+        }
+        m_index += n;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::set_delta(bool)
+     */
+    void set_delta(bool delta)
+    {
+        m_delta = delta;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::index() const
+     */
+    ptrdiff_t index() const
+    {
+        return m_index;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::set_index(ptrdiff_t)
+     */
+    void set_index(ptrdiff_t index)
+    {
+        m_index = index;
+    }
+};
+
+/**
+ * @brief Structure to assemble the alignment parameters.
+ * These parameters are used when the chunk is aligned with a position,
+ * see prrng::pcg32_cumsum::align(), prrng::pcg32_arrayBase_cumsum::align().
+ */
+struct alignment {
+    /**
+     * @param buffer
+     *      If positive, only change the chunk if target is in `chunk[:buffer]` or `chunk[-buffer:]`
+     *
+     * @param margin
+     *      Index of the chunk to place the target.
+     *
+     * @param min_margin
+     *      Minimal index to accept if `strict = false`.
+     *
+     * @param strict
+     *      If `true`, `margin` is respected strictly: `argmin(target > chunk) == margin`.
+     *      If `false` `min_margin <= argmin(target > chunk) <= margin`, whereby
+     *      `argmin(target > chunk) < margin` if moving backwards is required to respect `margin`.
+     *
+     * @param sample_skip
+     *      If `true`, skipping random numbers outside the chunk samples their sum from its law
+     *      (see e.g. prrng::GeneratorBase::cumsum_normal()).
+     *
+     * @param slack
+     *      If positive, store the chunk with `slack` extra entries to shift it without moving it.
+     *
+     * @param lazy
+     *      If `true`, an array of chunks draws the first chunk of each generator only on first use.
+     */
+    alignment(
+        ptrdiff_t buffer = 0,
+        ptrdiff_t margin = 0,
+        ptrdiff_t min_margin = 0,
+        bool strict = false,
+        bool sample_skip = false,
+        ptrdiff_t slack = 0,
+        bool lazy = false
+    )
+    {
+        this->buffer = buffer;
+        this->margin = margin;
+        this->min_margin = min_margin;
+        this->strict = strict;
+        this->sample_skip = sample_skip;
+        this->slack = slack;
+        this->lazy = lazy;
+    }
+
+    /**
+     * If positive, only change the chunk if target is in `chunk[:buffer]` or `chunk[-buffer:]`.
+     */
+    ptrdiff_t buffer = 0;
+
+    /**
+     * Index of the chunk to place the target.
+     */
+    ptrdiff_t margin = 0;
+
+    /**
+     * Minimal index to accept if `strict = false`.
+     */
+    ptrdiff_t min_margin = 0;
+
+    /**
+     * If `true`, `margin` is respected strictly: `argmin(target > chunk) == margin`.
+     * If `false`, `min_margin <= argmin(target > chunk) <= margin`, whereby
+     * `argmin(target > chunk) < margin` if moving backwards is required to respect `margin`.
+     */
+    bool strict = false;
+
+    /**
+     * If `true`, skipping random numbers outside the chunk (when the target is far from the chunk)
+     * draws one random number and samples the sum of the skipped numbers from its law,
+     * rather than drawing all skipped numbers.
+     * This only applies to the exponential, gamma, and normal distributions (and their fast
+     * variants). Each skipped number still advances the generator, but the values of the chunk
+     * (and therefore the index at which a target is found) depend on the history of alignments.
+     */
+    bool sample_skip = false;
+
+    /**
+     * If positive, the chunk is stored as a window in a buffer with `slack` extra entries.
+     * Shifting the chunk right (keeping some overlap) then only moves the start of the window,
+     * the overlap is moved to the front of the buffer only once the slack is exhausted.
+     * The chunk returned by e.g. prrng::pcg32_cumsum::data() is copied from the window on demand.
+     * This reduces the cost of frequent small shifts of large chunks.
+     */
+    ptrdiff_t slack = 0;
+
+    /**
+     * If `true`, an array of chunks (e.g. prrng::pcg32_array_cumsum) does not draw the first
+     * chunk of each generator on construction, but only when the generator is first used
+     * (e.g. by `align` or `align_at` of that generator, or by any call that reads all chunks).
+     * This spreads the cost of constructing a large array over the first time steps,
+     * and skips it for generators that are never used.
+     * The result is identical to that of `lazy = false`.
+     * Note that the deferred chunks are drawn also by const member functions (e.g. `data()`),
+     * such that a lazy object must not be read from several threads at the same time.
+     */
+    bool lazy = false;
+};
+
+/**
+ * @brief Adapt the size of a chunk, and optionally its alignment, to the observed displacement
+ * of the target, see e.g. prrng::pcg32_cumsum::set_adaptation().
+ *
+ * After each alignment the displacement of the global index of the target is recorded in
+ * an exponential moving average `velocity` (the weight of the last displacement is `smoothing`).
+ * The chunk is then doubled if `velocity > grow * size` or halved if `velocity < shrink * size`,
+ * bounded to `[min_size, max_size]`.
+ * Resizing keeps the start of the chunk and the values at all global indices:
+ * the sequence is not changed, only the part of it that is held in memory.
+ */
+struct adaptation {
+    /**
+     * @param min_size Minimal size of the chunk.
+     * @param max_size Maximal size of the chunk (`0`: no adaptation).
+     * @param grow Double the chunk if the velocity exceeds `grow * size`.
+     * @param shrink Halve the chunk if the velocity is below `shrink * size`.
+     * @param smoothing Weight of the last displacement in the velocity.
+     *
+     * @param tune_alignment
+     *      If `true`, set alignment::buffer and alignment::margin to twice the velocity
+     *      (at most a quarter of the chunk).
+     */
+    adaptation(
+        size_t min_size = 0,
+        size_t max_size = 0,
+        double grow = 0.5,
+        double shrink = 0.05,
+        double smoothing = 0.2,
+        bool tune_alignment = false
+    )
+    {
+        this->min_size = min_size;
+        this->max_size = max_size;
+        this->grow = grow;
+        this->shrink = shrink;
+        this->smoothing = smoothing;
+        this->tune_alignment = tune_alignment;
+    }
+
+    /**
+     * Minimal size of the chunk (at least 2 is used).
+     */
+    size_t min_size = 0;
+
+    /**
+     * Maximal size of the chunk. If `0` the chunk is not adapted.
+     */
+    size_t max_size = 0;
+
+    /**
+     * Double the chunk if the velocity exceeds `grow * size`.
+     */
+    double grow = 0.5;
+
+    /**
+     * Halve the chunk if the velocity is below `shrink * size`.
+     */
+    double shrink = 0.05;
+
+    /**
+     * Weight of the last displacement in the (exponential moving average of the) velocity.
+     */
+    double smoothing = 0.2;
+
+    /**
+     * If `true`, set alignment::buffer and alignment::margin to twice the velocity
+     * (at most a quarter of the chunk), and reduce alignment::min_margin accordingly.
+     * This assumes that the target moves forward.
+     */
+    bool tune_alignment = false;
+};
+
+namespace detail {
+
+/**
+ * @brief Update the velocity of the target and get the new size of a chunk,
+ * see prrng::adaptation.
+ *
+ * @param adapt Adaptation settings.
+ * @param displacement Displacement of the global index of the target since the last alignment.
+ * @param velocity Average displacement (updated).
+ * @param size Current size of the chunk.
+ * @param align Alignment settings (updated if adaptation::tune_alignment).
+ * @return New size of the chunk.
+ */
+inline size_t adapt_chunk(
+    const adaptation& adapt,
+    double displacement,
+    double* velocity,
+    size_t size,
+    alignment* align
+)
+{
+    *velocity = adapt.smoothing * displacement + (1.0 - adapt.smoothing) * (*velocity);
+    double v = *velocity;
+    size_t lower = std::max(adapt.min_size, static_cast<size_t>(2));
+    size_t upper = std::max(adapt.max_size, lower);
+    size_t n = size;
+
+    if (v > adapt.grow * static_cast<double>(size)) {
+        n = 2 * size;
+    }
+    else if (v < adapt.shrink * static_cast<double>(size)) {
+        n = size / 2;
+    }
+
+    n = std::min(std::max(n, lower), upper);
+
+    if (adapt.tune_alignment) {
+        ptrdiff_t m = static_cast<ptrdiff_t>(std::ceil(2.0 * v));
+        m = std::min(m, static_cast<ptrdiff_t>(n / 4));
+        align->buffer = m;
+        align->margin = m;
+        align->min_margin = std::min(align->min_margin, m);
+    }
+
+    return n;
+}
+
+/**
+ * @brief Draw `n` random numbers according to a distribution known at compile time
+ * (including the offset), and write them straight to an existing buffer.
+ *
+ * @tparam D Type of distribution, see prrng::distribution (not `custom`).
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param param Parameters of the distribution, see prrng::default_parameters.
+ * @param data Pointer to the output (`n` entries, modified).
+ * @param n Number of random numbers to draw.
+ */
+template <enum distribution D, class G, class T>
+inline void draw_chunk(G&& generator, const std::array<double, 3>& param, T* data, size_t n)
+{
+    static_assert(D != distribution::custom, "Unknown distribution");
+
+    if constexpr (D == distribution::random) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.random() * param[0] + param[1];
+        }
+    }
+    else if constexpr (D == distribution::delta) {
+        std::fill(data, data + n, param[0] + param[1]);
+    }
+    else if constexpr (D == distribution::exponential) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.exponential(param[0]) + param[1];
+        }
+    }
+    else if constexpr (D == distribution::power) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.power(param[0]) + param[1];
+        }
+    }
+    else if constexpr (D == distribution::gamma) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.gamma(param[0], param[1]) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::pareto) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.pareto(param[0], param[1]) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::weibull) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.weibull(param[0], param[1]) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::normal) {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = generator.normal(param[0], param[1]) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::fast_normal) {
+        uint32_to_fast_normal convert(param[0], param[1]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::fast_exponential) {
+        uint32_to_fast_exponential convert(param[0]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[1];
+        }
+    }
+    else if constexpr (D == distribution::fast_gamma) {
+        uint32_to_fast_gamma convert(param[0], param[1]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::fast_power) {
+        uint32_to_fast_power convert(param[0]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[1];
+        }
+    }
+    else if constexpr (D == distribution::fast_pareto) {
+        uint32_to_fast_pareto convert(param[0], param[1]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[2];
+        }
+    }
+    else if constexpr (D == distribution::fast_weibull) {
+        uint32_to_fast_weibull convert(param[0], param[1]);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = convert(generator.next_uint32()) + param[2];
+        }
+    }
+}
+
+/**
+ * @brief Draw `n` random numbers according to some distribution (including the offset),
+ * and write them straight to an existing buffer.
+ * The distribution is selected once per call, see draw_chunk<D>().
+ *
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param distribution Type of distribution, see prrng::distribution (not `custom`).
+ * @param param Parameters of the distribution, see prrng::default_parameters.
+ * @param data Pointer to the output (`n` entries, modified).
+ * @param n Number of random numbers to draw.
+ */
+template <class G, class T>
+inline void draw_chunk(
+    G&& generator,
+    enum distribution distribution,
+    const std::array<double, 3>& param,
+    T* data,
+    size_t n
+)
+{
+    switch (distribution) {
+    case distribution::random:
+        return draw_chunk<distribution::random>(generator, param, data, n);
+    case distribution::delta:
+        return draw_chunk<distribution::delta>(generator, param, data, n);
+    case distribution::exponential:
+        return draw_chunk<distribution::exponential>(generator, param, data, n);
+    case distribution::power:
+        return draw_chunk<distribution::power>(generator, param, data, n);
+    case distribution::gamma:
+        return draw_chunk<distribution::gamma>(generator, param, data, n);
+    case distribution::pareto:
+        return draw_chunk<distribution::pareto>(generator, param, data, n);
+    case distribution::weibull:
+        return draw_chunk<distribution::weibull>(generator, param, data, n);
+    case distribution::normal:
+        return draw_chunk<distribution::normal>(generator, param, data, n);
+    case distribution::fast_normal:
+        return draw_chunk<distribution::fast_normal>(generator, param, data, n);
+    case distribution::fast_exponential:
+        return draw_chunk<distribution::fast_exponential>(generator, param, data, n);
+    case distribution::fast_gamma:
+        return draw_chunk<distribution::fast_gamma>(generator, param, data, n);
+    case distribution::fast_power:
+        return draw_chunk<distribution::fast_power>(generator, param, data, n);
+    case distribution::fast_pareto:
+        return draw_chunk<distribution::fast_pareto>(generator, param, data, n);
+    case distribution::fast_weibull:
+        return draw_chunk<distribution::fast_weibull>(generator, param, data, n);
+    case distribution::custom:
+        throw std::runtime_error("Unknown distribution");
+    }
+}
+
+/**
+ * @brief Cumulative sum of `n` random numbers according to a distribution known at compile time
+ * (including the offset), see prrng::GeneratorBase::cumsum().
+ *
+ * @tparam D Type of distribution, see prrng::distribution (not `custom`).
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param param Parameters of the distribution, see prrng::default_parameters.
+ * @param n Number of random numbers to sum.
+ * @param exact See prrng::GeneratorBase::cumsum_normal().
+ * @return Cumulative sum.
+ */
+template <enum distribution D, class G>
+inline double draw_cumsum(G&& generator, const std::array<double, 3>& param, size_t n, bool exact)
+{
+    static_assert(D != distribution::custom, "Unknown distribution");
+    double m = static_cast<double>(n);
+
+    if constexpr (D == distribution::random) {
+        return generator.cumsum_random(n) * param[0] + m * param[1];
+    }
+    else if constexpr (D == distribution::delta) {
+        return generator.cumsum_delta(n, param[0]) + m * param[1];
+    }
+    else if constexpr (D == distribution::exponential) {
+        return generator.cumsum_exponential(n, param[0], exact) + m * param[1];
+    }
+    else if constexpr (D == distribution::power) {
+        return generator.cumsum_power(n, param[0]) + m * param[1];
+    }
+    else if constexpr (D == distribution::gamma) {
+        return generator.cumsum_gamma(n, param[0], param[1], exact) + m * param[2];
+    }
+    else if constexpr (D == distribution::pareto) {
+        return generator.cumsum_pareto(n, param[0], param[1]) + m * param[2];
+    }
+    else if constexpr (D == distribution::weibull) {
+        return generator.cumsum_weibull(n, param[0], param[1]) + m * param[2];
+    }
+    else if constexpr (D == distribution::normal) {
+        return generator.cumsum_normal(n, param[0], param[1], exact) + m * param[2];
+    }
+    else if constexpr (D == distribution::fast_normal) {
+        return generator.cumsum_fast_normal(n, param[0], param[1], exact) + m * param[2];
+    }
+    else if constexpr (D == distribution::fast_exponential) {
+        return generator.cumsum_fast_exponential(n, param[0], exact) + m * param[1];
+    }
+    else if constexpr (D == distribution::fast_gamma) {
+        return generator.cumsum_fast_gamma(n, param[0], param[1], exact) + m * param[2];
+    }
+    else if constexpr (D == distribution::fast_power) {
+        return generator.cumsum_fast_power(n, param[0]) + m * param[1];
+    }
+    else if constexpr (D == distribution::fast_pareto) {
+        return generator.cumsum_fast_pareto(n, param[0], param[1]) + m * param[2];
+    }
+    else {
+        return generator.cumsum_fast_weibull(n, param[0], param[1]) + m * param[2];
+    }
+}
+
+/**
+ * @brief Cumulative sum of `n` random numbers according to some distribution
+ * (including the offset), see prrng::GeneratorBase::cumsum().
+ *
+ * @param generator Generator, see prrng::pcg32_index(), or a reference to it (modified).
+ * @param distribution Type of distribution, see prrng::distribution (not `custom`).
+ * @param param Parameters of the distribution, see prrng::default_parameters.
+ * @param n Number of random numbers to sum.
+ * @param exact See prrng::GeneratorBase::cumsum_normal().
+ * @return Cumulative sum.
+ */
+template <class G>
+inline double draw_cumsum(
+    G&& generator,
+    enum distribution distribution,
+    const std::array<double, 3>& param,
+    size_t n,
+    bool exact
+)
+{
+    switch (distribution) {
+    case distribution::random:
+        return draw_cumsum<distribution::random>(generator, param, n, exact);
+    case distribution::delta:
+        return draw_cumsum<distribution::delta>(generator, param, n, exact);
+    case distribution::exponential:
+        return draw_cumsum<distribution::exponential>(generator, param, n, exact);
+    case distribution::power:
+        return draw_cumsum<distribution::power>(generator, param, n, exact);
+    case distribution::gamma:
+        return draw_cumsum<distribution::gamma>(generator, param, n, exact);
+    case distribution::pareto:
+        return draw_cumsum<distribution::pareto>(generator, param, n, exact);
+    case distribution::weibull:
+        return draw_cumsum<distribution::weibull>(generator, param, n, exact);
+    case distribution::normal:
+        return draw_cumsum<distribution::normal>(generator, param, n, exact);
+    case distribution::fast_normal:
+        return draw_cumsum<distribution::fast_normal>(generator, param, n, exact);
+    case distribution::fast_exponential:
+        return draw_cumsum<distribution::fast_exponential>(generator, param, n, exact);
+    case distribution::fast_gamma:
+        return draw_cumsum<distribution::fast_gamma>(generator, param, n, exact);
+    case distribution::fast_power:
+        return draw_cumsum<distribution::fast_power>(generator, param, n, exact);
+    case distribution::fast_pareto:
+        return draw_cumsum<distribution::fast_pareto>(generator, param, n, exact);
+    case distribution::fast_weibull:
+        return draw_cumsum<distribution::fast_weibull>(generator, param, n, exact);
+    case distribution::custom:
+        throw std::runtime_error("Unknown distribution");
+    }
+
+    throw std::runtime_error("Unknown distribution");
+}
+
+} // namespace detail
+
+/**
+ * @brief Generator of a random cumulative sum of which a chunk is kept in memory.
+ * The random number generated by the pcg32 algorithm.
+ *
+ * Suppose that `cumsum` is the unlimited cumulative of random numbers starting from a seed, then a
+ * chunk `gen.data() == cumsum[gen.start() : gen.start() + gen.size()]` is kept in memory by this
+ * class. The chunk that is kept in memory can be changed by calling:
+ *
+ *  -   prrng::pcg32_cumsum::prev() to get the previous chunk.
+ *  -   prrng::pcg32_cumsum::next() to get the next chunk.
+ *  -   prrng::pcg32_cumsum::align() to align the chunk with a target value.
+ *
+ * Note that if the current chunk is far away from the seed a quick way to restore it without
+ * drawing all random numbers from the seed is to call prrng::pcg32_cumsum::restore().
+ * Note that you need to know one value and its index.
+ *
+ * @tparam Data
+ *      Storage of the data, e.g. `xt::xtensor<double, 1>`.
+ *      With value_type `float` the random numbers are drawn in double precision,
+ *      and are then stored (and summed) in single precision.
+ *
+ * @tparam Distribution
+ *      Distribution known at compile time, see prrng::distribution.
+ *      The random numbers are then drawn by a kernel specialised for that distribution
+ *      (see detail::draw_chunk<D>()), without selecting the distribution (or checking for custom
+ *      functions) on each draw. In that case set_functions() is not available.
+ *      Default: prrng::distribution::custom, i.e. the distribution is selected at runtime.
+ */
+template <class Data, enum distribution Distribution = distribution::custom>
+class pcg32_cumsum {
+private:
+    using value_type = typename Data::value_type; ///< Type of the entries (`double` or `float`).
+
+    mutable Data m_data; ///< The chunk (materialised lazily if `alignment::slack > 0`).
+    std::vector<value_type> m_buffer; ///< Storage of the chunk if `alignment::slack > 0`.
+    ptrdiff_t m_offset; ///< Start of the chunk in #m_buffer.
+    mutable bool m_synced; ///< Signal if #m_data is up-to-date with #m_buffer.
+    pcg32_index m_gen; ///< The generator.
+    std::function<Data(size_t)> m_draw; ///< Custom function to draw the random numbers.
+    std::function<double(size_t)> m_sum; ///< Custom function to get the cumsum of random numbers.
+    bool m_extendible; ///< Signal if the drawing functions are specified.
+    alignment m_align; ///< alignment settings, see prrng::alignment().
+    distribution m_distro; ///< Distribution name, see prrng::distribution().
+    std::array<double, 3> m_param; ///< Distribution parameters.
+    ptrdiff_t m_start; ///< Start index of the chunk.
+    ptrdiff_t m_i; ///< Last know index of `target` in align.
+    chunk_statistics m_stats; ///< See statistics().
+    pcg32_stride m_jump; ///< Last jump of the generator, see detail::jump_to().
+    adaptation m_adapt; ///< Adaptation settings, see set_adaptation().
+    double m_velocity = 0.0; ///< Average displacement of the target, see velocity().
+    ptrdiff_t m_last = 0; ///< Global index of the target at the last alignment.
+    bool m_aligned = false; ///< Signal if #m_last is set.
+    bool m_prefetch = false; ///< Signal to prefetch the next chunk, see set_prefetch().
+    std::vector<value_type> m_next; ///< Prefetched random numbers (not summed).
+    ptrdiff_t m_next_start = 0; ///< Global index of the first entry of #m_next.
+    std::vector<value_type> m_spare; ///< Random numbers that are being drawn by #m_worker.
+    ptrdiff_t m_spare_start = 0; ///< Global index of the first entry of #m_spare.
+    std::future<void> m_worker; ///< Prefetch of #m_spare (destroyed, i.e. waited for, first).
+
+    /**
+     * @brief Set draw function.
+     * The built-in distributions are drawn directly in the chunk, see draw_chunk().
+     */
+    void auto_functions()
+    {
+        m_extendible = m_distro != custom;
+        m_draw = nullptr;
+        m_sum = nullptr;
+    }
+
+    /**
+     * @brief Draw the next `n` random numbers starting from the current state of the generator.
+     * For the built-in distributions this does not allocate.
+     *
+     * @param data Pointer to the output (modified).
+     * @param n Number of random numbers.
+     */
+    void draw_chunk(value_type* data, size_t n)
+    {
+        if (m_prefetch && this->draw_prefetched(data, n)) {
+            return;
+        }
+
+        PRRNG_STATISTICS(&m_stats, drawn += n);
+
+        if constexpr (Distribution != distribution::custom) {
+            detail::draw_chunk<Distribution>(m_gen, m_param, data, n);
+        }
+        else {
+            if (m_draw) {
+                Data extra = m_draw(n);
+                std::copy(extra.begin(), extra.end(), data);
+                return;
+            }
+
+            detail::draw_chunk(m_gen, m_distro, m_param, data, n);
+        }
+    }
+
+    /**
+     * @brief Get the cumsum of the next `n` random numbers starting from the current state of the
+     * generator.
+     *
+     * @param n Number of random numbers.
+     * @return Cumulative sum.
+     */
+    double draw_sum(size_t n)
+    {
+        PRRNG_STATISTICS(&m_stats, summed += n);
+
+        if constexpr (Distribution != distribution::custom) {
+            return detail::draw_cumsum<Distribution>(m_gen, m_param, n, !m_align.sample_skip);
+        }
+        else {
+            if (m_sum) {
+                return m_sum(n);
+            }
+
+            return detail::draw_cumsum(m_gen, m_distro, m_param, n, !m_align.sample_skip);
+        }
+    }
+
+    /**
+     * @brief Wait for the prefetch (if any), and make its random numbers available.
+     */
+    void collect_prefetch()
+    {
+        if (m_worker.valid()) {
+            m_worker.get();
+            std::swap(m_next, m_spare);
+            m_next_start = m_spare_start;
+        }
+    }
+
+    /**
+     * @brief Draw the random numbers directly after the chunk on a background thread
+     * (if enabled, see set_prefetch()), using a copy of the generator.
+     * Numbers that are already prefetched are reused.
+     * Skipped if custom functions are set, see set_functions().
+     */
+    void launch_prefetch()
+    {
+        if (!m_prefetch || m_distro == distribution::custom || m_distro == distribution::delta) {
+            return;
+        }
+
+        if (this->has_functions()) {
+            return;
+        }
+
+        size_t n = m_data.size();
+        ptrdiff_t begin = m_start + static_cast<ptrdiff_t>(n);
+
+        if (m_worker.valid() && m_spare_start == begin && m_spare.size() == n) {
+            return;
+        }
+
+        this->collect_prefetch();
+
+        ptrdiff_t end = m_next_start + static_cast<ptrdiff_t>(m_next.size());
+        size_t keep = 0;
+
+        if (begin >= m_next_start && begin < end) {
+            keep = std::min(n, static_cast<size_t>(end - begin));
+        }
+
+        if (keep == n) {
+            return;
+        }
+
+        m_spare.resize(n);
+        m_spare_start = begin;
+
+        if (keep > 0) {
+            auto first = m_next.cbegin() + (begin - m_next_start);
+            std::copy(first, first + static_cast<ptrdiff_t>(keep), m_spare.begin());
+        }
+
+        pcg32_index gen = m_gen;
+        ptrdiff_t index = begin + static_cast<ptrdiff_t>(keep);
+        value_type* data = m_spare.data() + keep;
+        size_t m = n - keep;
+        auto distro = m_distro;
+        auto param = m_param;
+
+        m_worker = std::async(std::launch::async, [gen, index, data, m, distro, param]() mutable {
+            gen.jump_to(index);
+            if constexpr (Distribution != distribution::custom) {
+                detail::draw_chunk<Distribution>(gen, param, data, m);
+            }
+            else {
+                detail::draw_chunk(gen, distro, param, data, m);
+            }
+        });
+    }
+
+    /**
+     * @brief Copy the next `n` random numbers from the prefetched numbers, if available,
+     * and advance the generator accordingly (its index is updated by the caller).
+     *
+     * @param data Pointer to the output (modified).
+     * @param n Number of random numbers.
+     * @return `true` if the numbers were prefetched.
+     */
+    bool draw_prefetched(value_type* data, size_t n)
+    {
+        ptrdiff_t index = m_gen.index();
+        ptrdiff_t m = static_cast<ptrdiff_t>(n);
+
+        auto covers = [index, m](ptrdiff_t start, size_t size) {
+            return index >= start && index + m <= start + static_cast<ptrdiff_t>(size);
+        };
+
+        if (m_worker.valid() && covers(m_spare_start, m_spare.size())) {
+            this->collect_prefetch();
+        }
+
+        if (!covers(m_next_start, m_next.size())) {
+            return false;
+        }
+
+        auto first = m_next.cbegin() + (index - m_next_start);
+        std::copy(first, first + m, data);
+        m_gen.advance(m);
+        PRRNG_STATISTICS(&m_stats, prefetched += n);
+        return true;
+    }
+
+    /**
+     * @brief Allocate storage with slack if `alignment::slack > 0`, see detail::chunk_buffer.
+     */
+    void init_buffer()
+    {
+        m_offset = 0;
+        m_synced = true;
+
+        if (m_extendible && m_align.slack > 0 && m_buffer.empty()) {
+            m_buffer.resize(m_data.size() + static_cast<size_t>(m_align.slack));
+            std::copy(m_data.begin(), m_data.end(), m_buffer.begin());
+        }
+    }
+
+    /**
+     * @brief The chunk in its storage.
+     * @return detail::chunk_buffer
+     */
+    detail::chunk_buffer<value_type> chunk()
+    {
+        ptrdiff_t size = static_cast<ptrdiff_t>(m_data.size());
+
+        if (m_buffer.empty()) {
+            return detail::chunk_buffer<value_type>(
+                m_data.data(), size, &m_offset, size, &m_stats, &m_jump
+            );
+        }
+
+        m_synced = false;
+        ptrdiff_t capacity = static_cast<ptrdiff_t>(m_buffer.size());
+        return detail::chunk_buffer<value_type>(
+            m_buffer.data(), capacity, &m_offset, size, &m_stats, &m_jump
+        );
+    }
+
+    /**
+     * @brief Pointer to the first entry of the chunk in its storage.
+     * @return Pointer.
+     */
+    const value_type* chunk_data() const
+    {
+        if (m_buffer.empty()) {
+            return m_data.data();
+        }
+
+        return m_buffer.data() + m_offset;
+    }
+
+    /**
+     * @brief Copy the chunk from its storage to #m_data (if needed).
+     */
+    void pull() const
+    {
+        if (!m_synced) {
+            std::copy(this->chunk_data(), this->chunk_data() + m_data.size(), m_data.begin());
+            m_synced = true;
+        }
+    }
+
+    /**
+     * @brief Copy #m_data to the storage of the chunk (if needed).
+     */
+    void push()
+    {
+        if (!m_buffer.empty()) {
+            std::copy(m_data.begin(), m_data.end(), m_buffer.begin() + m_offset);
+        }
+    }
+
+    /**
+     * @brief Copy constructor.
+     * This function resets all internal pointers.
+     *
+     * @param other Object to copy.
+     */
+    void copy_from(const pcg32_cumsum& other)
+    {
+        this->collect_prefetch();
+        m_data = other.m_data;
+        m_buffer = other.m_buffer;
+        m_offset = other.m_offset;
+        m_synced = other.m_synced;
+        m_gen = other.m_gen;
+        m_align = other.m_align;
+        m_distro = other.m_distro;
+        m_param = other.m_param;
+        m_start = other.m_start;
+        m_i = other.m_i;
+        m_stats = other.m_stats;
+        m_jump = other.m_jump;
+        m_adapt = other.m_adapt;
+        m_velocity = other.m_velocity;
+        m_last = other.m_last;
+        m_aligned = other.m_aligned;
+        m_prefetch = other.m_prefetch;
+        m_next.clear();
+        m_spare.clear();
+        this->auto_functions();
+    }
+
+    /**
+     * @brief Record the displacement of the target and resize the chunk if needed,
+     * see prrng::adaptation.
+     * @return `true` if the chunk was resized.
+     */
+    bool adapt()
+    {
+        ptrdiff_t index = m_start + m_i;
+
+        if (!m_aligned) {
+            m_aligned = true;
+            m_last = index;
+            return false;
+        }
+
+        double displacement = std::abs(static_cast<double>(index - m_last));
+        m_last = index;
+        size_t size = m_data.size();
+        size_t n = detail::adapt_chunk(m_adapt, displacement, &m_velocity, size, &m_align);
+
+        if (n == size) {
+            return false;
+        }
+
+        this->resize(n);
+        return true;
+    }
+
+    /**
+     * @brief Align the chunk to encompass a target value (without adaptation).
+     * @param target Target value.
+     */
+    void align_chunk(double target)
+    {
+        auto get_chunk = [this](value_type* data, size_t n) { this->draw_chunk(data, n); };
+        auto get_sum = [this](size_t n) { return this->draw_sum(n); };
+        detail::align(m_gen, get_chunk, get_sum, m_align, this->chunk(), &m_start, &m_i, target);
+    }
+
+public:
+    /**
+     * @param shape Shape of the chunk.
+     * @param initstate State initiator.
+     * @param initseq Sequence initiator.
+     * @param distribution Distribution type, see prrng::distribution().
+     *
+     * @param parameters
+     *      Parameters for the distribution. The following is default (and the expected order):
+     *
+     *      -   prrng::distribution::random: {scale = 1, offset = 0}
+     *      -   prrng::distribution::delta: {scale = 1, offset = 0}
+     *      -   prrng::distribution::exponential: {scale = 1, offset = 0}
+     *      -   prrng::distribution::power: {k = 1, offset = 0}
+     *      -   prrng::distribution::gamma: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::pareto: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::weibull: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::normal: {mu = 1, sigma = , offset = 0}
+     *      -   prrng::distribution::fast_normal: {mu = 1, sigma = , offset = 0}
+     *      -   prrng::distribution::fast_exponential: {scale = 1, offset = 0}
+     *      -   prrng::distribution::fast_gamma: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::fast_power: {k = 1, offset = 0}
+     *      -   prrng::distribution::fast_pareto: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::fast_weibull: {k = 1, scale = 1, offset = 0}
+     *      -   prrng::distribution::custom: {}
+     *
+     *      Warning: if you want to use a custom distribution, you have to call
+     *      prrng::pcg32_cumsum::set_functions().
+     *
+     * @param align Alignment parameters, see prrng::alignment().
+     */
+    template <class R, typename T = uint64_t, typename S = uint64_t>
+    pcg32_cumsum(
+        const R& shape,
+        T initstate = PRRNG_PCG32_INITSTATE,
+        S initseq = PRRNG_PCG32_INITSEQ,
+        enum distribution distribution = Distribution,
+        const std::vector<double>& parameters = std::vector<double>{},
+        const alignment& align = alignment()
+    )
+    {
+        PRRNG_ASSERT(Distribution == distribution::custom || distribution == Distribution);
+        m_data = xt::empty<typename Data::value_type>(shape);
+        m_gen = pcg32_index(initstate, initseq, distribution == distribution::delta);
+        m_start = m_gen.index();
+        m_i = static_cast<ptrdiff_t>(m_data.size());
+        m_align = align;
+        m_distro = distribution;
+        std::copy(parameters.begin(), parameters.end(), m_param.begin());
+        m_buffer.clear();
+        this->auto_functions();
+        this->init_buffer();
+
+        if (!m_extendible) {
+            return;
+        }
+
+        value_type* data = this->chunk().data();
+        this->draw_chunk(data, m_data.size());
+        m_gen.drawn(m_data.size());
+        std::partial_sum(data, data + m_data.size(), data);
+    }
+
+    /**
+     * @brief Use external functions to draw the random numbers.
+     * @param get_chunk Function to draw the random numbers, called as `get_chunk(n)`.
+     * @param get_cumsum Function to get the cumsum of random numbers, called: `get_cumsum(n)`.
+     * @param uses_generator Set `true` is the random generator is used by the functions.
+     */
+    void set_functions(
+        std::function<Data(size_t)> get_chunk,
+        std::function<double(size_t)> get_cumsum,
+        bool uses_generator = true
+    )
+    {
+        static_assert(
+            Distribution == distribution::custom,
+            "Custom functions require a distribution selected at runtime"
+        );
+
+        m_extendible = true;
+        m_draw = get_chunk;
+        m_sum = get_cumsum;
+        m_gen.set_delta(!uses_generator);
+        this->init_buffer();
+
+        // the prefetched numbers are of the built-in distribution
+        this->collect_prefetch();
+        m_next.clear();
+        m_spare.clear();
+
+        value_type* data = this->chunk().data();
+        this->draw_chunk(data, m_data.size());
+        m_gen.drawn(m_data.size());
+        std::partial_sum(data, data + m_data.size(), data);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_cumsum::copy_from(const prrng::pcg32_cumsum&)
+     */
+    pcg32_cumsum(const pcg32_cumsum& other)
+    {
+        this->copy_from(other);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_cumsum::copy_from(const prrng::pcg32_cumsum&)
+     */
+    void operator=(const pcg32_cumsum& other)
+    {
+        this->copy_from(other);
+    }
+
+    /**
+     * @brief `true` if the chunk is extendible.
+     * @return bool
+     */
+    bool is_extendible() const
+    {
+        return m_extendible;
+    }
+
+    /**
+     * @brief `true` if custom functions are set, see set_functions().
+     * Then drawing (restore(), prev(), next(), align()) calls these functions.
+     * @return bool
+     */
+    bool has_functions() const
+    {
+        return m_draw != nullptr || m_sum != nullptr;
+    }
+
+    /**
+     * @brief Pointer to the generator.
+     * @return const pcg32&
+     */
+    const pcg32_index& generator() const
+    {
+        return m_gen;
+    }
+
+    /**
+     * @brief Shape of the chunk.
+     * @return const auto&
+     */
+    const auto& shape() const
+    {
+        return m_data.shape();
+    }
+
+    /**
+     * @brief Size of the chunk.
+     * @return auto
+     */
+    auto size() const
+    {
+        return m_data.size();
+    }
+
+    /**
+     * @brief Add value(s) to the chunk.
+     * @param value Value(s) to add.
+     */
+    template <class T>
+    pcg32_cumsum& operator+=(const T& value)
+    {
+        this->pull();
+        xt::noalias(m_data) += value;
+        this->push();
+        return *this;
+    }
+
+    /**
+     * @brief Subtract value(s) from the chunk.
+     * @param value Value(s) to subtract.
+     */
+    template <class T>
+    pcg32_cumsum& operator-=(const T& value)
+    {
+        this->pull();
+        xt::noalias(m_data) -= value;
+        this->push();
+        return *this;
+    }
+
+    /**
+     * @brief The current chunk of the cumsum of random numbers.
+     * Without alignment::slack this is the storage of the chunk itself, such that the reference
+     * (in Python: the array, which is not copied) follows all changes of the chunk.
+     * With alignment::slack the reference is updated (copied from the storage) on each call.
+     * @return Reference to the chunk.
+     */
+    const Data& data() const
+    {
+        this->pull();
+        return m_data;
+    }
+
+    /**
+     * @brief Overwrite the current chunk of the cumsum of random numbers.
+     * Please check if set_state() or set_start() should be called too.
+     *
+     * @param data The chunk.
+     */
+    void set_data(const Data& data)
+    {
+        PRRNG_ASSERT(xt::has_shape(data, m_data.shape()));
+        xt::noalias(m_data) = data;
+        m_synced = true;
+        this->push();
+    }
+
+    /**
+     * @brief Change the size of the chunk, keeping its start.
+     * Growing draws the entries directly after the current chunk, shrinking drops the last
+     * entries: the values at all global indices are unchanged.
+     * Only for one-dimensional chunks.
+     *
+     * @param n New size of the chunk.
+     */
+    void resize(size_t n)
+    {
+        PRRNG_ASSERT(m_data.dimension() == 1);
+        PRRNG_ASSERT(n >= 2);
+        PRRNG_ASSERT(m_extendible || n <= m_data.size());
+
+        size_t size = m_data.size();
+
+        if (n == size) {
+            return;
+        }
+
+        this->pull();
+        Data data = m_data;
+        m_data.resize(std::array<size_t, 1>{n});
+        std::copy(data.begin(), data.begin() + std::min(n, size), m_data.begin());
+
+        if (n > size) {
+            value_type* extra = m_data.data() + size;
+            m_gen.jump_to(m_start + static_cast<ptrdiff_t>(size));
+            this->draw_chunk(extra, n - size);
+            m_gen.drawn(n - size);
+            extra[0] += data.data()[size - 1];
+            std::partial_sum(extra, m_data.data() + n, extra);
+        }
+
+        m_i = std::min(m_i, static_cast<ptrdiff_t>(n));
+        m_buffer.clear();
+        this->init_buffer();
+        this->launch_prefetch();
+    }
+
+    /**
+     * @brief Adapt the size of the chunk (and optionally the alignment) to the displacement
+     * of the target in subsequent calls of align(), see prrng::adaptation.
+     * The sequence is not changed.
+     *
+     * @param adapt Adaptation settings.
+     */
+    void set_adaptation(const adaptation& adapt)
+    {
+        m_adapt = adapt;
+        m_velocity = 0.0;
+        m_aligned = false;
+    }
+
+    /**
+     * @brief Prefetch the random numbers of the next chunk on a background thread.
+     * After each move of the chunk, the random numbers directly after it are drawn
+     * asynchronously (from a copy of the generator). A subsequent shift of the chunk to the right
+     * (by next(), or by align() with an advancing target) then copies them instead of drawing
+     * them, which hides the cost of drawing behind the work between calls.
+     * Because a thread is started for every prefetch, this only pays off for large chunks.
+     * The sequence is not changed.
+     * Not used for the delta distribution and for custom functions (see set_functions()).
+     *
+     * @param prefetch `true` to enable.
+     */
+    void set_prefetch(bool prefetch)
+    {
+        m_prefetch = prefetch;
+
+        if (prefetch) {
+            this->launch_prefetch();
+            return;
+        }
+
+        this->collect_prefetch();
+        m_next.clear();
+        m_spare.clear();
+    }
+
+    /**
+     * @brief Signal if the next chunk is prefetched, see set_prefetch().
+     * @return bool
+     */
+    bool prefetch() const
+    {
+        return m_prefetch;
+    }
+
+    /**
+     * @brief Adaptation settings, see set_adaptation().
+     * @return prrng::adaptation
+     */
+    const adaptation& adaptation_settings() const
+    {
+        return m_adapt;
+    }
+
+    /**
+     * @brief Alignment settings (modified by adaptation::tune_alignment).
+     * @return prrng::alignment
+     */
+    const alignment& alignment_settings() const
+    {
+        return m_align;
+    }
+
+    /**
+     * @brief Average displacement of the global index of the target between subsequent calls of
+     * align(), only recorded if the chunk is adapted, see set_adaptation().
+     * @return double
+     */
+    double velocity() const
+    {
+        return m_velocity;
+    }
+
+    /**
+     * @brief Statistics of the moves of the chunk since construction or the last call of
+     * reset_statistics(). Only collected if #PRRNG_ENABLE_STATISTICS is defined.
+     * @return prrng::chunk_statistics
+     */
+    const chunk_statistics& statistics() const
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Reset all statistics() to zero.
+     */
+    void reset_statistics()
+    {
+        m_stats = chunk_statistics();
+    }
+
+    /**
+     * @brief Global index of the first element in the chunk.
+     * @return Global index.
+     */
+    ptrdiff_t start() const
+    {
+        return m_start;
+    }
+
+    /**
+     * @brief Set global index of the first element in the chunk.
+     * @param index Global index.
+     */
+    void set_start(ptrdiff_t index)
+    {
+        m_start = index;
+    }
+
+    /**
+     * @brief Global index of `target`
+     * (the last time prrng::pcg32_cumsum::align() was called).
+     *
+     * Suppose that `cumsum` is the unlimited cumsum of random numbers starting from a seed, then:
+     *
+     *  -   `gen.left_of_align() == cumsum[gen.index_at_align()] <= target`.
+     *  -   `gen.right_of_align() == cumsum[gen.index_at_align() + 1] > target`.
+     *
+     * Note thought that `cumsum` is not constructed by this class, that instead only holds a chunk
+     * `gen.data() == cumsum[gen.start():gen.start() + gen.size()]`.
+     *
+     * @return Global index.
+     */
+    ptrdiff_t index_at_align() const
+    {
+        return m_start + m_i;
+    }
+
+    /**
+     * @brief Index of `target` relative to the beginning of the chunk
+     * (the last time prrng::pcg32_cumsum::align() was called).
+     *
+     * The currently held chunk of the cumsum of random numbers is is `gen.data()`. As such,
+     *
+     *  -  `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
+     *  -  `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
+     *
+     * @return Local index.
+     */
+    ptrdiff_t chunk_index_at_align() const
+    {
+        return m_i;
+    }
+
+    /**
+     * @brief Return the value of the cumsum left of the `target`
+     * (the last time prrng::pcg32_cumsum::align() was called).
+     * `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
+     *
+     * @return double
+     */
+    double left_of_align() const
+    {
+        return this->chunk_data()[m_i];
+    }
+
+    /**
+     * @brief Return the value of the cumsum right of the `target`
+     * (the last time prrng::pcg32_cumsum::align() was called).
+     * `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
+     *
+     * @return double
+     */
+    double right_of_align() const
+    {
+        return this->chunk_data()[m_i + 1];
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::state()
+     */
+    uint64_t state_at(ptrdiff_t index)
+    {
+        return m_gen.state_at(index);
+    }
+
+    /**
+     * @brief Restore a specific state in the cumulative sum.
+     *
+     * @param state The state at the beginning of the new chunk.
+     * @param value The value of the first entry of the new chunk.
+     * @param index The index of the first entry of the new chunk.
+     */
+    void restore(uint64_t state, double value, ptrdiff_t index)
+    {
+        // the prefetched numbers may be of a different sequence
+        this->collect_prefetch();
+        m_next.clear();
+
+        m_gen.set_index(index);
+        m_gen.restore(state);
+        m_start = index;
+
+        value_type* data = this->chunk().data();
+        this->draw_chunk(data, m_data.size());
+        m_gen.drawn(m_data.size());
+        data[0] += value - data[0];
+        std::partial_sum(data, data + m_data.size(), data);
+        this->launch_prefetch();
+    }
+
+    /**
+     * @brief Check if the chunk contains a target.
+     * @param target The target.
+     * @return `true` if the chunk contains the target.
+     */
+    bool contains(double target) const
+    {
+        return target >= this->chunk_data()[0] && target <= this->chunk_data()[m_data.size() - 1];
+    }
+
+    /**
+     * @brief Shift chunk left.
+     * @param margin Overlap to keep with the current chunk.
+     */
+    void prev(size_t margin = 0)
+    {
+        PRRNG_ASSERT(m_extendible);
+        m_i = static_cast<ptrdiff_t>(m_data.size());
+        auto get_chunk = [this](value_type* data, size_t n) { this->draw_chunk(data, n); };
+        detail::prev(m_gen, get_chunk, margin, this->chunk(), &m_start);
+        this->launch_prefetch();
+    }
+
+    /**
+     * @brief Shift chunk right.
+     * @param margin Overlap to keep with the current chunk.
+     */
+    void next(size_t margin = 0)
+    {
+        PRRNG_ASSERT(m_extendible);
+        m_i = static_cast<ptrdiff_t>(m_data.size());
+        auto get_chunk = [this](value_type* data, size_t n) { this->draw_chunk(data, n); };
+        detail::next(m_gen, get_chunk, margin, this->chunk(), &m_start);
+        this->launch_prefetch();
+    }
+
+    /**
+     * @brief Align the chunk to encompass a target value.
+     * After this call:
+     *
+     *  -   prrng::pcg32_cumsum::index_at_align(): global index of `target` in the cumulative sum.
+     *
+     *  -   prrng::pcg32_cumsum::chunk_index_at_align(): local index of `target` in the currently
+     *      held chunk, whereby:
+     *
+     *      -  `gen.left_of_align() == gen.data()[gen.chunk_index_at_align()] <= target`.
+     *      -  `gen.right_of_align() == gen.data()[gen.chunk_index_at_align() + 1] > target`.
+     *
+     * If adaptation is enabled (see set_adaptation()) the chunk may be resized afterwards.
+     *
+     * @param target Target value.
+     */
+    void align(double target)
+    {
+        if (!m_extendible) {
+            PRRNG_ASSERT(this->contains(target));
+            const value_type* data = this->chunk_data();
+            m_i = iterator::lower_bound(data, data + m_data.size(), target, m_i);
+            return;
+        }
+
+        this->align_chunk(target);
+
+        // after resizing the target may be (at the edge of, or) outside the new chunk
+        if (m_adapt.max_size > 0 && this->adapt()) {
+            this->align_chunk(target);
+        }
+
+        this->launch_prefetch();
+    }
+};
+
+/**
+ * @brief Write a stream of blocks of random numbers to a file, see prrng::block_stream.
+ * The data is written in binary form (native byte order), as `std::fwrite`.
+ * The file is not closed by this class.
+ */
+class file_sink {
+public:
+    /**
+     * @param file Open file (e.g. the output of `std::fopen(filename, "wb")`).
+     */
+    explicit file_sink(std::FILE* file) : m_file(file)
+    {
+    }
+
+    /**
+     * @brief Write a block.
+     * @param data Pointer to the block.
+     * @param n Number of entries in the block.
+     */
+    template <class T>
+    void operator()(const T* data, size_t n) const
+    {
+        if (std::fwrite(data, sizeof(T), n, m_file) != n) {
+            throw std::runtime_error("[prrng] Failed to write to file");
+        }
+    }
+
+private:
+    std::FILE* m_file; ///< Output file.
+};
+
+/**
+ * @brief Write a stream of blocks of random numbers to consecutive memory,
+ * e.g. a memory-mapped file, see prrng::block_stream.
+ *
+ * @tparam T Type of the entries.
+ */
+template <class T>
+class memory_sink {
+public:
+    /**
+     * @param data Start of the output (no bounds-check).
+     */
+    explicit memory_sink(T* data) : m_data(data)
+    {
+    }
+
+    /**
+     * @brief Write a block, directly after the previous block.
+     * @param data Pointer to the block.
+     * @param n Number of entries in the block.
+     */
+    void operator()(const T* data, size_t n)
+    {
+        std::copy(data, data + n, m_data);
+        m_data += n;
+    }
+
+    /**
+     * @brief Position at which the next block will be written.
+     * @return Pointer.
+     */
+    T* data() const
+    {
+        return m_data;
+    }
+
+private:
+    T* m_data; ///< Position at which the next block will be written.
+};
+
+/**
+ * @brief Stream a long (e.g. larger than memory) sequence of random numbers, or of their
+ * cumulative sum, to a sink in blocks of a fixed size.
+ * The sink is any callable `sink(const T* data, size_t n)`, e.g. prrng::file_sink or
+ * prrng::memory_sink.
+ *
+ * The blocks are double buffered: while the sink consumes a block, the next block is drawn
+ * on a worker thread. The generator is only used by one thread at a time, and the output is
+ * identical to drawing the random numbers directly from the generator
+ * (the blocks of the cumulative sum are identical to the chunks of prrng::pcg32_cumsum() of
+ * the same size, moving through the sequence with prrng::pcg32_cumsum::next()).
+ * The running cumulative sum is carried across blocks and across calls of write().
+ *
+ * @tparam Generator Generator, e.g. prrng::pcg32.
+ * @tparam T Type of the output (`double` or `float`).
+ */
+template <class Generator, class T = double>
+class block_stream {
+public:
+    /**
+     * @param generator Generator (used, and advanced, by write()).
+     * @param block_size Number of entries per block.
+     * @param distribution Distribution type, see prrng::distribution() (not `custom`).
+     * @param parameters Parameters for the distribution, see prrng::default_parameters.
+     * @param cumsum Stream the cumulative sum of the random numbers (instead of the numbers).
+     */
+    block_stream(
+        Generator& generator,
+        size_t block_size,
+        enum distribution distribution = distribution::random,
+        const std::vector<double>& parameters = std::vector<double>{},
+        bool cumsum = false
+    )
+        : m_gen(generator), m_size(block_size), m_distro(distribution), m_cumsum(cumsum)
+    {
+        static_assert(
+            std::is_same<T, double>::value || std::is_same<T, float>::value,
+            "Output must be double or float"
+        );
+
+        PRRNG_ASSERT(distribution != distribution::custom);
+        auto par = default_parameters(distribution, parameters);
+        std::copy(par.begin(), par.end(), m_param.begin());
+        m_buffer[0].resize(m_size);
+        m_buffer[1].resize(m_size);
+    }
+
+    /**
+     * @brief Draw `nblock` blocks, and pass them one by one to `sink`.
+     * If the sink throws, the block that is being drawn is finished before the exception is
+     * passed on (the generator is then advanced beyond the last block that was written).
+     *
+     * @param nblock Number of blocks.
+     * @param sink Callable as `sink(const T* data, size_t n)`.
+     */
+    template <class Sink>
+    void write(size_t nblock, Sink&& sink)
+    {
+        if (nblock == 0) {
+            return;
+        }
+
+        std::vector<T>* current = &m_buffer[0];
+        std::vector<T>* next = &m_buffer[1];
+        this->draw_block(current->data());
+
+        for (size_t k = 0; k < nblock; ++k) {
+            std::future<void> worker;
+
+            if (k + 1 < nblock) {
+                T* data = next->data();
+                worker = std::async(std::launch::async, [this, data]() { this->draw_block(data); });
+            }
+
+            sink(static_cast<const T*>(current->data()), m_size);
+            m_written++;
+
+            if (worker.valid()) {
+                worker.get();
+            }
+
+            std::swap(current, next);
+        }
+    }
+
+    /**
+     * @brief Number of entries per block.
+     * @return Unsigned integer.
+     */
+    size_t block_size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Number of blocks passed to the sink so far.
+     * @return Unsigned integer.
+     */
+    size_t written() const
+    {
+        return m_written;
+    }
+
+    /**
+     * @brief Last value of the cumulative sum that was drawn, from which the next block continues.
+     * @return Value.
+     */
+    double back() const
+    {
+        return m_back;
+    }
+
+    /**
+     * @brief Overwrite the value from which the cumulative sum of the next block continues.
+     * @param value Value.
+     */
+    void set_back(double value)
+    {
+        m_back = value;
+    }
+
+private:
+    void draw_block(T* data)
+    {
+        detail::draw_chunk(m_gen, m_distro, m_param, data, m_size);
+
+        if (m_cumsum && m_size > 0) {
+            data[0] += m_back;
+            std::partial_sum(data, data + m_size, data);
+            m_back = data[m_size - 1];
+        }
+    }
+
+    Generator& m_gen; ///< The generator.
+    size_t m_size; ///< See block_size().
+    distribution m_distro; ///< Distribution name, see prrng::distribution().
+    std::array<double, 3> m_param = {}; ///< Distribution parameters.
+    bool m_cumsum; ///< Stream the cumulative sum.
+    double m_back = 0.0; ///< See back().
+    size_t m_written = 0; ///< See written().
+    std::array<std::vector<T>, 2> m_buffer; ///< The two blocks.
+};
+
+/**
+ * Base class of an array of pseudorandom number generators.
+ * This class provides common methods, but itself does not really do much.
+ * See the description of derived classed for information.
+ *
+ * The output of the distributions can have value_type `double` or `float`.
+ * In the latter case, each random `uint32_t` is converted to one float
+ * (see prrng::pcg32::next_float()), after which the distribution is evaluated in double precision
+ * and rounded to float.
+ *
+ * @tparam M Type to use storage of the shape and array vectors. E.g. `std::vector` or `std::array`
+ */
+template <class Derived, class M>
+class GeneratorBase_array {
+public:
+    using shape_type = M; ///< Type of the shape and strides lists.
+    using size_type = typename M::value_type; ///< Type of sizes.
+
+    /**
+     * Return the size of the array of generators.
+     *
+     * @return unsigned int
+     */
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Return the strides of the array of generators.
+     *
+     * @return vector of unsigned ints
+     */
+    const shape_type& strides() const
+    {
+        return m_strides;
+    }
+
+    /**
+     * Return the shape of the array of generators.
+     *
+     * @return vector of unsigned ints
+     */
+    const shape_type& shape() const
+    {
+        return m_shape;
+    }
+
+    /**
+     * Return the shape of the array of generators along a specific axis.
+     *
+     * @param axis The axis.
+     * @return vector of unsigned ints
+     */
+    template <class T>
+    auto shape(T axis) const
+    {
+        return m_shape[axis];
+    }
+
+    /**
+     * Return a flat index based on an array index specified as a list.
+     *
+     * @param index Array index, e.g. as std::vector.
+     * @return Flat index.
+     */
+    template <class T>
+    auto flat_index(const T& index) const
+    {
+        PRRNG_DEBUG(this->inbounds(index));
+        return std::inner_product(index.cbegin(), index.cend(), m_strides.cbegin(), 0);
+    }
+
+    /**
+     * Check if an index is in bounds (and of the correct rank).
+     *
+     * @return `false` if out-of-bounds, `true` otherwise.
+     */
+    template <class T>
+    bool inbounds(const T& index) const
+    {
+        if (index.size() != m_strides.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_strides.size(); ++i) {
+            if (index[i] >= m_shape[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers \f$ 0 \leq r \leq 1 \f$.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto random(const S& ishape) -> typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->random_impl<R>(ishape);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::random(const S&)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R random(const S& ishape)
+    {
+        return this->random_impl<R>(ishape);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::random(const S&)
+     */
+    template <class I, std::size_t L>
+    auto random(const I (&ishape)[L]) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->random_impl<R>(detail::to_array(ishape));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::random(const S&)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R random(const I (&ishape)[L])
+    {
+        return this->random_impl<R>(detail::to_array(ishape));
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::random(const S&)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void random(const S& ishape, R& ret)
+    {
+        this->random_impl(ishape, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param high The upper bound of the interval.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S, typename T>
+    auto randint(const S& ishape, T high) -> typename detail::composite_return_type<T, M, S>::type
+    {
+        using R = typename detail::composite_return_type<T, M, S>::type;
+        return this->randint_impl<R>(ishape, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S, typename T>
+    R randint(const S& ishape, T high)
+    {
+        return this->randint_impl<R>(ishape, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
+     */
+    template <class I, std::size_t L, typename T>
+    auto randint(const I (&ishape)[L], T high) ->
+        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
+        return this->randint_impl<R>(detail::to_array(ishape), high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T>
+    R randint(const I (&ishape)[L], T high)
+    {
+        return this->randint_impl<R>(detail::to_array(ishape), high);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random integers \f$ 0 \leq r \leq bound \f$.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param low The lower bound of the interval.
+     * @param high The upper bound of the interval.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S, typename T, typename U>
+    auto randint(const S& ishape, T low, U high) ->
+        typename detail::composite_return_type<T, M, S>::type
+    {
+        using R = typename detail::composite_return_type<T, M, S>::type;
+        return this->randint_impl<R>(ishape, low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S, typename T, typename U>
+    R randint(const S& ishape, T low, U high)
+    {
+        return this->randint_impl<R>(ishape, low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
+     */
+    template <class I, std::size_t L, typename T, typename U>
+    auto randint(const I (&ishape)[L], T low, U high) ->
+        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
+        return this->randint_impl<R>(detail::to_array(ishape), low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T, typename U>
+    R randint(const I (&ishape)[L], T low, U high)
+    {
+        return this->randint_impl<R>(detail::to_array(ishape), low, high);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random integers \f$ 0 \leq r < high \f$,
+     * using the multiply-shift method, see prrng::GeneratorBase::fast_randint(T).
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param high The upper bound of the interval.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S, typename T>
+    auto fast_randint(const S& ishape, T high) ->
+        typename detail::composite_return_type<T, M, S>::type
+    {
+        using R = typename detail::composite_return_type<T, M, S>::type;
+        return this->fast_randint_impl<R>(ishape, T(0), high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     */
+    template <class R, class S, typename T>
+    R fast_randint(const S& ishape, T high)
+    {
+        return this->fast_randint_impl<R>(ishape, T(0), high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T)
+     */
+    template <class I, std::size_t L, typename T>
+    auto fast_randint(const I (&ishape)[L], T high) ->
+        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
+        return this->fast_randint_impl<R>(detail::to_array(ishape), T(0), high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T)
+     * @tparam R return type, e.g. `xt::xtensor<uint32_t, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T>
+    R fast_randint(const I (&ishape)[L], T high)
+    {
+        return this->fast_randint_impl<R>(detail::to_array(ishape), T(0), high);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random integers \f$ low \leq r < high \f$,
+     * using the multiply-shift method, see prrng::GeneratorBase::fast_randint(T).
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param low The lower bound of the interval.
+     * @param high The upper bound of the interval.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S, typename T, typename U>
+    auto fast_randint(const S& ishape, T low, U high) ->
+        typename detail::composite_return_type<T, M, S>::type
+    {
+        using R = typename detail::composite_return_type<T, M, S>::type;
+        return this->fast_randint_impl<R>(ishape, low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<int64_t, 1>`
+     */
+    template <class R, class S, typename T, typename U>
+    R fast_randint(const S& ishape, T low, U high)
+    {
+        return this->fast_randint_impl<R>(ishape, low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T, U)
+     */
+    template <class I, std::size_t L, typename T, typename U>
+    auto fast_randint(const I (&ishape)[L], T low, U high) ->
+        typename detail::composite_return_type<T, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<T, M, std::array<size_t, L>>::type;
+        return this->fast_randint_impl<R>(detail::to_array(ishape), low, high);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_randint(const S&, T, U)
+     * @tparam R return type, e.g. `xt::xtensor<int64_t, 1>`
+     */
+    template <class R, class I, std::size_t L, typename T, typename U>
+    R fast_randint(const I (&ishape)[L], T low, U high)
+    {
+        return this->fast_randint_impl<R>(detail::to_array(ishape), low, high);
+    }
+
+    /**
+     * Per generator, generate an nd-array of numbers that are delta distribution.
+     * These numbers are not random; calling this function does not change the state of the
+     * generators.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale The value of the 'peak' of the delta distribution.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto delta(const S& ishape, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->delta_impl<R>(ishape, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R delta(const S& ishape, double scale = 1)
+    {
+        return this->delta_impl<R>(ishape, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto delta(const I (&ishape)[L], double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->delta_impl<R>(detail::to_array(ishape), scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::delta(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R delta(const I (&ishape)[L], double scale = 1)
+    {
+        return this->delta_impl<R>(detail::to_array(ishape), scale);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::delta(const S&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale The value of the 'peak' of the delta distribution.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void delta(const S& ishape, double scale, R& ret)
+    {
+        this->delta_impl(ishape, scale, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to an exponential distribution.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale Scale.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto exponential(const S& ishape, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->exponential_impl<R>(ishape, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R exponential(const S& ishape, double scale = 1)
+    {
+        return this->exponential_impl<R>(ishape, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto exponential(const I (&ishape)[L], double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->exponential_impl<R>(detail::to_array(ishape), scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R exponential(const I (&ishape)[L], double scale = 1)
+    {
+        return this->exponential_impl<R>(detail::to_array(ishape), scale);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::exponential(const S&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale Scale.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void exponential(const S& ishape, double scale, R& ret)
+    {
+        this->exponential_impl(ishape, scale, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to an power distribution.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Scale.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto power(const S& ishape, double k = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->power_impl<R>(ishape, k);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R power(const S& ishape, double k = 1)
+    {
+        return this->power_impl<R>(ishape, k);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto power(const I (&ishape)[L], double k = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->power_impl<R>(detail::to_array(ishape), k);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R power(const I (&ishape)[L], double k = 1)
+    {
+        return this->power_impl<R>(detail::to_array(ishape), k);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::power(const S&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Exponent.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void power(const S& ishape, double k, R& ret)
+    {
+        this->power_impl(ishape, k, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a Gamma distribution.
+     * Only available when compiled with PRRNG_USE_BOOST
+     * (e.g. using the CMake target `prrng::use_boost`).
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto gamma(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->gamma_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R gamma(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->gamma_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto gamma(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->gamma_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R gamma(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->gamma_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::gamma(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void gamma(const S& ishape, double k, double scale, R& ret)
+    {
+        this->gamma_impl(ishape, k, scale, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a Pareto distribution.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k The "shape" parameter \f$ k \f$.
+     * @param scale The "scale" parameter \f$ \lambda \f$.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto pareto(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->pareto_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R pareto(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->pareto_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto pareto(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->pareto_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R pareto(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->pareto_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::pareto(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void pareto(const S& ishape, double k, double scale, R& ret)
+    {
+        this->pareto_impl(ishape, k, scale, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a Weibull distribution.
+     * Internally, the output of random() is converted using the cumulative density
+     *
+     * \f$ \Phi(x) = 1 - e^{-(x / \lambda)^k} \f$
+     *
+     * such that the output `r` from random() leads to
+     *
+     * \f$ x = \lambda (- \ln (1 - r))^{1 / k}) \f$
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k The "shape" parameter \f$ k \f$.
+     * @param scale The "scale" parameter \f$ \lambda \f$.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto weibull(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->weibull_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R weibull(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->weibull_impl<R>(ishape, k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto weibull(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->weibull_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R weibull(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->weibull_impl<R>(detail::to_array(ishape), k, scale);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::weibull(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void weibull(const S& ishape, double k, double scale, R& ret)
+    {
+        this->weibull_impl(ishape, k, scale, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a normal distribution.
+     * Internally, the output of random() is converted using the cumulative density
+     *
+     * \f$ \Phi(x) = \frac{1}{2} \left[
+     *     1 + \mathrm{erf}\left( \frac{x - \mu}{\sigma \sqrt{2}} \right)
+     * \right]\f$
+     *
+     * such that the output `r` from random() leads to
+     *
+     * \f$ x = \mu + \sigma \sqrt{2} \mathrm{erf}^{-1} (2r - 1) \f$
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto normal(const S& ishape, double mu = 0, double sigma = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->normal_impl<R>(ishape, mu, sigma);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R normal(const S& ishape, double mu = 0, double sigma = 1)
+    {
+        return this->normal_impl<R>(ishape, mu, sigma);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto normal(const I (&ishape)[L], double mu = 0, double sigma = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->normal_impl<R>(detail::to_array(ishape), mu, sigma);
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R normal(const I (&ishape)[L], double mu = 0, double sigma = 1)
+    {
+        return this->normal_impl<R>(detail::to_array(ishape), mu, sigma);
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::normal(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void normal(const S& ishape, double mu, double sigma, R& ret)
+    {
+        this->normal_impl(ishape, mu, sigma, ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a normal distribution, see prrng::GeneratorBase::fast_normal().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_normal(const S& ishape, double mu = 0, double sigma = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_normal(mu, sigma));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_normal(const S& ishape, double mu = 0, double sigma = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_normal(mu, sigma));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_normal(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_normal(const I (&ishape)[L], double mu = 0, double sigma = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_normal(mu, sigma)
+        );
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_normal(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_normal(const I (&ishape)[L], double mu = 0, double sigma = 1)
+    {
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_normal(mu, sigma)
+        );
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_normal(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_normal(const S& ishape, double mu, double sigma, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_normal(mu, sigma), ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to an exponential distribution, see prrng::GeneratorBase::fast_exponential().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale Scale.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_exponential(const S& ishape, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_exponential(scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_exponential(const S& ishape, double scale = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_exponential(scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_exponential(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_exponential(const I (&ishape)[L], double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_exponential(scale)
+        );
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_exponential(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_exponential(const I (&ishape)[L], double scale = 1)
+    {
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_exponential(scale)
+        );
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_exponential(const S&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param scale Scale.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_exponential(const S& ishape, double scale, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_exponential(scale), ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a gamma distribution, see prrng::GeneratorBase::fast_gamma().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_gamma(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_gamma(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_gamma(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_gamma(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_gamma(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_gamma(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_gamma(k, scale)
+        );
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_gamma(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_gamma(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_gamma(k, scale)
+        );
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_gamma(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_gamma(const S& ishape, double k, double scale, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_gamma(k, scale), ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a power distribution, see prrng::GeneratorBase::fast_power().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Scale.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_power(const S& ishape, double k = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_power(k));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_power(const S& ishape, double k = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_power(k));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_power(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_power(const I (&ishape)[L], double k = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(detail::to_array(ishape), detail::uint32_to_fast_power(k));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_power(const S&, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_power(const I (&ishape)[L], double k = 1)
+    {
+        return this->convert_impl<R>(detail::to_array(ishape), detail::uint32_to_fast_power(k));
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_power(const S&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Scale.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_power(const S& ishape, double k, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_power(k), ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a Pareto distribution, see prrng::GeneratorBase::fast_pareto().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_pareto(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_pareto(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_pareto(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_pareto(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_pareto(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_pareto(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_pareto(k, scale)
+        );
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_pareto(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_pareto(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_pareto(k, scale)
+        );
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_pareto(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_pareto(const S& ishape, double k, double scale, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_pareto(k, scale), ret);
+    }
+
+    /**
+     * Per generator, generate an nd-array of random numbers distributed
+     * according to a Weibull distribution, see prrng::GeneratorBase::fast_weibull().
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return The array of arrays of samples: [#shape, `ishape`]
+     */
+    template <class S>
+    auto fast_weibull(const S& ishape, double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, S>::type
+    {
+        using R = typename detail::composite_return_type<double, M, S>::type;
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_weibull(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class S>
+    R fast_weibull(const S& ishape, double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(ishape, detail::uint32_to_fast_weibull(k, scale));
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_weibull(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto fast_weibull(const I (&ishape)[L], double k = 1, double scale = 1) ->
+        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    {
+        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_weibull(k, scale)
+        );
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::fast_weibull(const S&, double, double)
+     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     */
+    template <class R, class I, std::size_t L>
+    R fast_weibull(const I (&ishape)[L], double k = 1, double scale = 1)
+    {
+        return this->convert_impl<R>(
+            detail::to_array(ishape), detail::uint32_to_fast_weibull(k, scale)
+        );
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::fast_weibull(const S&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param ishape The shape of the nd-array drawn per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Output: [#shape, `ishape`] (overwritten).
+     */
+    template <class S, class R>
+    void fast_weibull(const S& ishape, double k, double scale, R& ret)
+    {
+        this->convert_impl(ishape, detail::uint32_to_fast_weibull(k, scale), ret);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers.
+     * @param n Number of steps.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_random(const T& n) -> typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_random_impl(ret.data(), n.data());
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers.
+     * @param n Number of steps.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_random(const T& n)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_random_impl(ret.data(), n.data());
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_random(const T&)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_random(const T& n, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_random_impl(ret.data(), n.data());
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a delta distribution,
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_delta(const T& n, double scale = 1) -> typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        for (size_t i = 0; i < ret.size(); ++i) {
+            ret.flat(i) = static_cast<double>(n.flat(i)) * scale;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a delta distribution,
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_delta(const T& n, double scale = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        for (size_t i = 0; i < ret.size(); ++i) {
+            ret.flat(i) = static_cast<double>(n.flat(i)) * scale;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an exponential distribution, see exponential_distribution(),
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_exponential().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_exponential(const T& n, double scale = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_exponential_impl(ret.data(), n.data(), scale, exact);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an exponential distribution, see exponential_distribution(),
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_exponential().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_exponential(const T& n, double scale = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_exponential_impl(ret.data(), n.data(), scale, exact);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_exponential(const T&, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_exponential().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_exponential(const T& n, double scale, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_exponential_impl(ret.data(), n.data(), scale, exact);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an power distribution, see power_distribution(),
+     * @param n Number of steps.
+     * @param k Scale.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_power(const T& n, double k = 1) -> typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_power_impl(ret.data(), n.data(), k);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an power distribution, see power_distribution(),
+     * @param n Number of steps.
+     * @param k Scale.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_power(const T& n, double k = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_power_impl(ret.data(), n.data(), k);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_power(const T&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Exponent.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_power(const T& n, double k, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_power_impl(ret.data(), n.data(), k);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a gamma distribution, see gamma_distribution(),
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_gamma().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_gamma(const T& n, double k = 1, double scale = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, exact);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a gamma distribution, see gamma_distribution(),
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_gamma().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_gamma(const T& n, double k = 1, double scale = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, exact);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_gamma(const T&, double, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_gamma().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_gamma(const T& n, double k, double scale, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, exact);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a pareto distribution, see pareto_distribution(),
+     * @param n Number of steps.
+     * @param k Shape.
+     * @param scale Scale.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_pareto(const T& n, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_pareto_impl(ret.data(), n.data(), k, scale);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a pareto distribution, see pareto_distribution(),
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_pareto(const T& n, double k = 1, double scale = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_pareto_impl(ret.data(), n.data(), k, scale);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_pareto(const T&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_pareto(const T& n, double k, double scale, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_pareto_impl(ret.data(), n.data(), k, scale);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a weibull distribution, see weibull_distribution(),
+     * @param n Number of steps.
+     * @param k Shape.
+     * @param scale Scale.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_weibull(const T& n, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_weibull_impl(ret.data(), n.data(), k, scale);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a weibull distribution, see weibull_distribution(),
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_weibull(const T& n, double k = 1, double scale = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_weibull_impl(ret.data(), n.data(), k, scale);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_weibull(const T&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_weibull(const T& n, double k, double scale, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_weibull_impl(ret.data(), n.data(), k, scale);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a normal distribution, see normal_distribution(),
+     * @param n Number of steps.
+     * @param mu Mean.
+     * @param sigma Standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_normal().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_normal(const T& n, double mu = 0, double sigma = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, exact);
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a normal distribution, see normal_distribution(),
+     * @param n Number of steps.
+     * @param mu Mean.
+     * @param sigma Standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_normal().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_normal(const T& n, double mu = 0, double sigma = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, exact);
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_normal(const T&, double, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_normal().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_normal(const T& n, double mu, double sigma, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, exact);
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a normal distribution, see prrng::GeneratorBase::fast_normal().
+     * @param n Number of steps.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_normal().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_normal(const T& n, double mu = 0, double sigma = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_normal(mu, sigma)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, false);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a normal distribution, see prrng::GeneratorBase::fast_normal().
+     * @param n Number of steps.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_normal().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_normal(const T& n, double mu = 0, double sigma = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_normal(mu, sigma)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, false);
+        }
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_normal(const T&, double, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param mu The average.
+     * @param sigma The standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_normal().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_normal(const T& n, double mu, double sigma, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_normal(mu, sigma)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma, false);
+        }
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an exponential distribution,
+     * see prrng::GeneratorBase::fast_exponential().
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_exponential().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_exponential(const T& n, double scale = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_exponential(scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_exponential_impl(
+                ret.data(), n.data(), scale, false
+            );
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to an exponential distribution,
+     * see prrng::GeneratorBase::fast_exponential().
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_exponential().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_exponential(const T& n, double scale = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_exponential(scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_exponential_impl(
+                ret.data(), n.data(), scale, false
+            );
+        }
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_exponential(const T&, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_exponential().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_exponential(const T& n, double scale, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_exponential(scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_exponential_impl(
+                ret.data(), n.data(), scale, false
+            );
+        }
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a gamma distribution, see prrng::GeneratorBase::fast_gamma().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_gamma().
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_gamma(const T& n, double k = 1, double scale = 1, bool exact = true) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_gamma(k, scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, false);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a gamma distribution, see prrng::GeneratorBase::fast_gamma().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_gamma().
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_gamma(const T& n, double k = 1, double scale = 1, bool exact = true)
+    {
+        R ret = R::from_shape(m_shape);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_gamma(k, scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, false);
+        }
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_gamma(const T&, double, double, bool)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_fast_gamma().
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_gamma(const T& n, double k, double scale, bool exact, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        if (exact) {
+            static_cast<Derived*>(this)->cumsum_convert_impl(
+                ret.data(), n.data(), detail::uint32_to_fast_gamma(k, scale)
+            );
+        }
+        else {
+            static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale, false);
+        }
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a power distribution, see prrng::GeneratorBase::fast_power().
+     * @param n Number of steps.
+     * @param k Scale.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_power(const T& n, double k = 1) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_power(k)
+        );
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a power distribution, see prrng::GeneratorBase::fast_power().
+     * @param n Number of steps.
+     * @param k Scale.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_power(const T& n, double k = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_power(k)
+        );
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_power(const T&, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Scale.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_power(const T& n, double k, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_power(k)
+        );
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a Pareto distribution, see prrng::GeneratorBase::fast_pareto().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_pareto(const T& n, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_pareto(k, scale)
+        );
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a Pareto distribution, see prrng::GeneratorBase::fast_pareto().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_pareto(const T& n, double k = 1, double scale = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_pareto(k, scale)
+        );
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_pareto(const T&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_pareto(const T& n, double k, double scale, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_pareto(k, scale)
+        );
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a Weibull distribution, see prrng::GeneratorBase::fast_weibull().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class T>
+    auto cumsum_fast_weibull(const T& n, double k = 1, double scale = 1) ->
+        typename detail::return_type<double, M>::type
+    {
+        using R = typename detail::return_type<double, M>::type;
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_weibull(k, scale)
+        );
+        return ret;
+    }
+
+    /**
+     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
+     * distributed according to a Weibull distribution, see prrng::GeneratorBase::fast_weibull().
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Cumulative sum.
+     */
+    template <class R, class T>
+    R cumsum_fast_weibull(const T& n, double k = 1, double scale = 1)
+    {
+        R ret = R::from_shape(m_shape);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_weibull(k, scale)
+        );
+        return ret;
+    }
+
+    /**
+     * @copybrief prrng::GeneratorBase_array::cumsum_fast_weibull(const T&, double, double)
+     * The output is written to an existing (contiguous, row-major) array, such that no memory
+     * is allocated.
+     *
+     * @param n Number of steps.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param ret Cumulative sum per generator (overwritten).
+     */
+    template <class T, class R>
+    void cumsum_fast_weibull(const T& n, double k, double scale, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(n, m_shape));
+        PRRNG_ASSERT(xt::has_shape(ret, m_shape));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->cumsum_convert_impl(
+            ret.data(), n.data(), detail::uint32_to_fast_weibull(k, scale)
+        );
+    }
+
+    /**
+     * @brief Decide based on probability per generator.
+     * This is fully equivalent to `generators.random({}) <= p`, but avoids the
+     * memory allocation of `random``.
+     *
+     * @param p Probability per generator [0, 1).
+     * @return Decision for each `p`.
+     */
+    template <class P>
+    auto decide(const P& p) -> typename detail::return_type<bool, P>::type
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        using R = typename detail::return_type<bool, P>::type;
+        R ret = R::from_shape(m_shape);
+        this->decide_bool_impl(p.data(), nullptr, ret.data());
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::decide(const P& p)
+     */
+    template <class P, class R>
+    R decide(const P& p)
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        R ret = R::from_shape(m_shape);
+        this->decide_bool_impl(p.data(), nullptr, ret.data());
+        return ret;
+    }
+
+    /**
+     * @brief Decide based on probability per generator.
+     * This is fully equivalent to `generators.random({}) <= p`, but avoids the
+     * memory allocation of `random``.
+     *
+     * @param p Probability per generator [0, 1).
+     * @param ret Decision for each ``p``.
+     */
+    template <class P, class R>
+    void decide(const P& p, R& ret)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, bool>::value, "Return value_type must be bool"
+        );
+
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
+        this->decide_bool_impl(p.data(), nullptr, ret.data());
+    }
+
+    /**
+     * @brief Decide based on probability per generator.
+     * This is fully equivalent to `generators.random({}) <= p`,
+     * but avoids the memory allocation of `random`.
+     *
+     * @param p Probability per generator [0, 1).
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @return Decision for each `p`.
+     */
+    template <class P, class T>
+    auto decide_masked(const P& p, const T& mask) -> typename detail::return_type<bool, P>::type
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
+        using R = typename detail::return_type<bool, P>::type;
+        R ret = R::from_shape(m_shape);
+        this->decide_bool_impl(p.data(), mask.data(), ret.data());
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::GeneratorBase_array::decide_masked(const P&, const T&)
+     */
+    template <class P, class T, class R>
+    R decide_masked(const P& p, const T& mask)
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
+        R ret = R::from_shape(m_shape);
+        this->decide_bool_impl(p.data(), mask.data(), ret.data());
+        return ret;
+    }
+
+    /**
+     * @brief Decide based on probability per generator.
+     * This is fully equivalent to `generators.random({}) <= p`,
+     * but avoids the memory allocation of `random`.
+     *
+     * @param p Probability per generator [0, 1).
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @param ret Decision for each ``p``.
+     */
+    template <class P, class T, class R>
+    void decide_masked(const P& p, const T& mask, R& ret)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, bool>::value, "Return value_type must be bool"
+        );
+
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
+        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
+        this->decide_bool_impl(p.data(), mask.data(), ret.data());
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and store the decisions bit-packed:
+     * the decision for (flat) generator `i` is bit `i % 8` of byte `i / 8`
+     * (in NumPy: `numpy.unpackbits(ret, count=size, bitorder="little")`).
+     * The decisions, and the state of the generators afterwards, are identical to decide(),
+     * but the output is 8 times smaller.
+     *
+     * @param p Probability per generator [0, 1).
+     * @return Bit-packed decisions, `(size() + 7) / 8` bytes.
+     */
+    template <class P, class R = xt::xtensor<uint8_t, 1>>
+    R decide_packed(const P& p)
+    {
+        std::array<size_t, 1> shape = {static_cast<size_t>((m_size + 7) / 8)};
+        R ret = R::from_shape(shape);
+        this->decide_packed(p, ret);
+        return ret;
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and store the decisions bit-packed.
+     * See decide_packed(const P&).
+     *
+     * @param p Probability per generator [0, 1).
+     * @param ret Bit-packed decisions, `(size() + 7) / 8` bytes.
+     */
+    template <class P, class R>
+    void decide_packed(const P& p, R& ret)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, uint8_t>::value,
+            "Return value_type must be uint8_t"
+        );
+
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(ret.size() == (m_size + 7) / 8);
+        this->decide_packed_impl(p.data(), nullptr, ret.data());
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and store the decisions bit-packed.
+     * See decide_packed(const P&) and decide_masked(const P&, const T&).
+     *
+     * @param p Probability per generator [0, 1).
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @return Bit-packed decisions, `(size() + 7) / 8` bytes.
+     */
+    template <class P, class T, class R = xt::xtensor<uint8_t, 1>>
+    R decide_masked_packed(const P& p, const T& mask)
+    {
+        std::array<size_t, 1> shape = {static_cast<size_t>((m_size + 7) / 8)};
+        R ret = R::from_shape(shape);
+        this->decide_masked_packed(p, mask, ret);
+        return ret;
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and store the decisions bit-packed.
+     * See decide_packed(const P&) and decide_masked(const P&, const T&).
+     *
+     * @param p Probability per generator [0, 1).
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @param ret Bit-packed decisions, `(size() + 7) / 8` bytes.
+     */
+    template <class P, class T, class R>
+    void decide_masked_packed(const P& p, const T& mask, R& ret)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, uint8_t>::value,
+            "Return value_type must be uint8_t"
+        );
+
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
+        PRRNG_ASSERT(ret.size() == (m_size + 7) / 8);
+        this->decide_packed_impl(p.data(), mask.data(), ret.data());
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and return only the (flat) indices of
+     * the generators for which the decision is `true`, in increasing order.
+     * The decisions, and the state of the generators afterwards, are identical to decide().
+     *
+     * @param p Probability per generator [0, 1).
+     * @return Flat indices of accepted generators.
+     */
+    template <class P, class R = xt::xtensor<size_t, 1>>
+    R decide_indices(const P& p)
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        return this->template decide_indices_impl<R>(p.data(), nullptr);
+    }
+
+    /**
+     * @brief Decide based on probability per generator, and return only the (flat) indices of
+     * the generators for which the decision is `true`, in increasing order.
+     * See decide_masked(const P&, const T&).
+     *
+     * @param p Probability per generator [0, 1).
+     * @param mask Where `true` the decision is `false` (no random number is drawn there).
+     * @return Flat indices of accepted generators.
+     */
+    template <class P, class T, class R = xt::xtensor<size_t, 1>>
+    R decide_masked_indices(const P& p, const T& mask)
+    {
+        PRRNG_ASSERT(xt::has_shape(p, m_shape));
+        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
+        return this->template decide_indices_impl<R>(p.data(), mask.data());
+    }
+
+private:
+    void decide_bool_impl(const double* p, const bool* mask, bool* ret)
+    {
+        constexpr size_t B = detail::decide_block_size;
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; i += B) {
+            size_t n = std::min(static_cast<size_t>(B), static_cast<size_t>(m_size - i));
+            const bool* m = mask == nullptr ? nullptr : &mask[i];
+            static_cast<Derived*>(this)->decide_block(i, n, &p[i], m, &ret[i]);
+        }
+    }
+
+    void decide_packed_impl(const double* p, const bool* mask, uint8_t* ret)
+    {
+        constexpr size_t B = detail::decide_block_size;
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; i += B) {
+            size_t n = std::min(static_cast<size_t>(B), static_cast<size_t>(m_size - i));
+            const bool* m = mask == nullptr ? nullptr : &mask[i];
+            bool d[B];
+            static_cast<Derived*>(this)->decide_block(i, n, &p[i], m, d);
+            detail::pack_bits(d, n, &ret[i / 8]);
+        }
+    }
+
+    template <class R>
+    R decide_indices_impl(const double* p, const bool* mask)
+    {
+        std::vector<uint8_t> bits(static_cast<size_t>((m_size + 7) / 8));
+        this->decide_packed_impl(p, mask, bits.data());
+
+        std::vector<size_t> index;
+        for (size_t b = 0; b < bits.size(); ++b) {
+            for (size_t l = 0, byte = bits[b]; byte != 0; ++l, byte >>= 1) {
+                if (byte & 1) {
+                    index.push_back(b * 8 + l);
+                }
+            }
+        }
+
+        std::array<size_t, 1> shape = {index.size()};
+        R ret = R::from_shape(shape);
+        std::copy(index.begin(), index.end(), ret.begin());
+        return ret;
+    }
+
+    template <class T>
+    void draw_list_real(T* data, size_t n)
+    {
+        static_assert(
+            std::is_same<T, double>::value || std::is_same<T, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        if constexpr (std::is_same<T, float>::value) {
+            static_cast<Derived*>(this)->draw_list_float(data, n);
+        }
+        else {
+            static_cast<Derived*>(this)->draw_list_double(data, n);
+        }
+    }
+
+    template <class T>
+    void draw_list_positive_real(T* data, size_t n)
+    {
+        static_assert(
+            std::is_same<T, double>::value || std::is_same<T, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        if constexpr (std::is_same<T, float>::value) {
+            static_cast<Derived*>(this)->draw_list_positive_float(data, n);
+        }
+        else {
+            static_cast<Derived*>(this)->draw_list_positive_double(data, n);
+        }
+    }
+
+    template <class R, class S>
+    R positive_random_impl(const S& ishape)
+    {
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        this->draw_list_positive_real(&ret.front(), n);
+        return ret;
+    }
+
+    template <class R, class S>
+    R random_impl(const S& ishape)
+    {
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        this->draw_list_real(&ret.front(), n);
+        return ret;
+    }
+
+    template <class R, class S, typename T>
+    R randint_impl(const S& ishape, T high)
+    {
+        static_assert(
+            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<T>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<T>::max() <= std::numeric_limits<uint32_t>::max(), "Bound too large"
+        );
+
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        std::vector<uint32_t> tmp(ret.size());
+        static_cast<Derived*>(this)->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high), n);
+        std::copy(tmp.begin(), tmp.end(), ret.begin());
+        return ret;
+    }
+
+    template <class R, class S, typename T, typename U>
+    R randint_impl(const S& ishape, T low, U high)
+    {
+        static_assert(
+            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<T>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename R::value_type>::min() >= std::numeric_limits<T>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<U>::max(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            std::numeric_limits<typename R::value_type>::min() >= std::numeric_limits<U>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        static_assert(
+            static_cast<uint32_t>(std::numeric_limits<T>::max()) <
+                std::numeric_limits<uint32_t>::max(),
+            "Bound too large"
+        );
+
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        std::vector<uint32_t> tmp(ret.size());
+        static_cast<Derived*>(this)->draw_list_uint32(
+            &tmp.front(), static_cast<uint32_t>(high - low), n
+        );
+        std::copy(tmp.begin(), tmp.end(), ret.begin());
+        return ret + low;
+    }
+
+    template <class R, class S, typename T, typename U>
+    R fast_randint_impl(const S& ishape, T low, U high)
+    {
+        using value_type = typename R::value_type;
+
+        static_assert(
+            std::numeric_limits<value_type>::max() >= std::numeric_limits<T>::max() &&
+                std::numeric_limits<value_type>::min() <= std::numeric_limits<T>::min(),
+            "Return value_type must must be able to accommodate the bound"
+        );
+
+        PRRNG_ASSERT(high > low);
+
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        uint64_t offset = static_cast<uint64_t>(low);
+        uint64_t bound = static_cast<uint64_t>(high) - offset;
+        static_cast<Derived*>(this)->draw_list_bounded(ret.data(), offset, bound, n);
+        return ret;
+    }
+
+    template <class R, class S>
+    R delta_impl(const S& ishape, double scale)
+    {
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        ret.fill(scale);
+        return ret;
+    }
+
+    template <class R, class S>
+    R exponential_impl(const S& ishape, double scale)
+    {
+        R r = this->random_impl<R>(ishape);
+        return exponential_distribution(scale).quantile(r);
+    }
+
+    template <class R, class S>
+    R power_impl(const S& ishape, double k)
+    {
+        R r = this->random_impl<R>(ishape);
+        return power_distribution(k).quantile(r);
+    }
+
+    template <class R, class S>
+    R gamma_impl(const S& ishape, double k, double scale)
+    {
+        R r = this->random_impl<R>(ishape);
+        return gamma_distribution(k, scale).quantile(r);
+    }
+
+    template <class R, class S>
+    R pareto_impl(const S& ishape, double k, double scale)
+    {
+        R r = this->random_impl<R>(ishape);
+        return pareto_distribution(k, scale).quantile(r);
+    }
+
+    template <class R, class S>
+    R weibull_impl(const S& ishape, double k, double scale)
+    {
+        R r = this->random_impl<R>(ishape);
+        return weibull_distribution(k, scale).quantile(r);
+    }
+
+    template <class R, class S>
+    R normal_impl(const S& ishape, double mu, double sigma)
+    {
+        R r = this->positive_random_impl<R>(ishape);
+        return normal_distribution(mu, sigma).quantile(r);
+    }
+
+    template <class S, class R>
+    void random_impl(const S& ishape, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(ret, detail::concatenate<M, S>::two(m_shape, ishape)));
+        detail::check_row_major(ret);
+        this->draw_list_real(ret.data(), detail::size(ishape));
+    }
+
+    template <class S, class R>
+    void positive_random_impl(const S& ishape, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(ret, detail::concatenate<M, S>::two(m_shape, ishape)));
+        detail::check_row_major(ret);
+        this->draw_list_positive_real(ret.data(), detail::size(ishape));
+    }
+
+    template <class S, class R>
+    void delta_impl(const S& ishape, double scale, R& ret)
+    {
+        PRRNG_ASSERT(xt::has_shape(ret, detail::concatenate<M, S>::two(m_shape, ishape)));
+        detail::check_row_major(ret);
+        ret.fill(scale);
+    }
+
+    // the quantile functions of the distributions, evaluated in place
+
+    template <class S, class R>
+    void exponential_impl(const S& ishape, double scale, R& ret)
+    {
+        this->random_impl(ishape, ret);
+        xt::noalias(ret) = exponential_distribution(scale).quantile_expression(ret);
+    }
+
+    template <class S, class R>
+    void power_impl(const S& ishape, double k, R& ret)
+    {
+        this->random_impl(ishape, ret);
+        xt::noalias(ret) = power_distribution(k).quantile_expression(ret);
+    }
+
+    template <class S, class R>
+    void gamma_impl(const S& ishape, double k, double scale, R& ret)
+    {
+        this->random_impl(ishape, ret);
+        xt::noalias(ret) = gamma_distribution(k, scale).quantile_expression(ret);
+    }
+
+    template <class S, class R>
+    void pareto_impl(const S& ishape, double k, double scale, R& ret)
+    {
+        this->random_impl(ishape, ret);
+        xt::noalias(ret) = pareto_distribution(k, scale).quantile_expression(ret);
+    }
+
+    template <class S, class R>
+    void weibull_impl(const S& ishape, double k, double scale, R& ret)
+    {
+        this->random_impl(ishape, ret);
+        xt::noalias(ret) = weibull_distribution(k, scale).quantile_expression(ret);
+    }
+
+    template <class S, class R>
+    void normal_impl(const S& ishape, double mu, double sigma, R& ret)
+    {
+        this->positive_random_impl(ishape, ret);
+        xt::noalias(ret) = normal_distribution(mu, sigma).quantile_expression(ret);
+    }
+
+    template <class S, class F, class R>
+    void convert_impl(const S& ishape, const F& convert, R& ret)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, double>::value ||
+                std::is_same<typename R::value_type, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        PRRNG_ASSERT(xt::has_shape(ret, detail::concatenate<M, S>::two(m_shape, ishape)));
+        detail::check_row_major(ret);
+        static_cast<Derived*>(this)->draw_list(ret.data(), detail::size(ishape), convert);
+    }
+
+    template <class R, class S, class F>
+    R convert_impl(const S& ishape, const F& convert)
+    {
+        static_assert(
+            std::is_same<typename R::value_type, double>::value ||
+                std::is_same<typename R::value_type, float>::value,
+            "Return value_type must be double or float"
+        );
+
+        auto n = detail::size(ishape);
+        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
+        static_cast<Derived*>(this)->draw_list(&ret.front(), n, convert);
+        return ret;
+    }
+
+protected:
+    size_type m_size = 0; ///< See size().
+    shape_type m_shape; ///< See shape().
+    shape_type m_strides; ///< The strides of the array of generators.
+};
+
+namespace detail {
+
+/**
+ * @brief Identifier of the binary format of prrng::pcg32_arrayBase::serialize()
+ * (the characters "prrng" followed by zeros, read as little-endian `uint64_t`).
+ */
+constexpr uint64_t serial_magic = 0x000000676e727270ull;
+
+/**
+ * @brief Version of the binary format of prrng::pcg32_arrayBase::serialize().
+ */
+constexpr uint64_t serial_version = 1;
+
+/**
+ * @brief Flag of the binary format: the index of each generator is stored.
+ */
+constexpr uint64_t serial_index = 1u << 0;
+
+/**
+ * @brief Flag of the binary format: the chunk is a cumulative sum.
+ */
+constexpr uint64_t serial_cumsum = 1u << 1;
+
+/**
+ * @brief Flag of the binary format: the chunk data are stored.
+ */
+constexpr uint64_t serial_data = 1u << 2;
+
+/**
+ * @brief Check if a generator keeps track of its index, see prrng::pcg32_index().
+ * @tparam G Generator.
+ */
+template <class G, class = void>
+struct has_index : std::false_type {};
+
+template <class G>
+struct has_index<G, std::void_t<decltype(std::declval<const G&>().index())>> : std::true_type {};
+
+/**
+ * @brief Append raw values to a byte buffer.
+ * Every call is padded to a multiple of 8 bytes, such that all fields are aligned.
+ */
+struct serial_writer {
+    /**
+     * @param buffer Buffer to append to (modified).
+     */
+    serial_writer(std::vector<char>& buffer) : buffer(buffer)
+    {
+    }
+
+    /**
+     * @brief Append `n` values.
+     * @param data Pointer to the values.
+     * @param n Number of values.
+     */
+    template <class T>
+    void put(const T* data, size_t n)
+    {
+        size_t pos = buffer.size();
+        size_t bytes = n * sizeof(T);
+        buffer.resize(pos + ((bytes + 7) / 8) * 8, 0);
+        std::memcpy(buffer.data() + pos, data, bytes);
+    }
+
+    /**
+     * @brief Append one value.
+     * @param value Value.
+     */
+    template <class T>
+    void put(const T& value)
+    {
+        this->put(&value, 1);
+    }
+
+    std::vector<char>& buffer; ///< Buffer.
+};
+
+/**
+ * @brief Read raw values from a byte buffer written by serial_writer.
+ * The buffer can be a memory-mapped file, it is never modified.
+ *
+ * @throw std::runtime_error if the buffer is too small.
+ */
+struct serial_reader {
+    /**
+     * @param data Pointer to the buffer.
+     * @param size Size of the buffer (in bytes).
+     */
+    serial_reader(const char* data, size_t size)
+    {
+        this->data = data;
+        this->size = size;
+        this->pos = 0;
+    }
+
+    /**
+     * @brief Read `n` values.
+     * @param out Pointer to the output (modified).
+     * @param n Number of values.
+     */
+    template <class T>
+    void get(T* out, size_t n)
+    {
+        size_t bytes = n * sizeof(T);
+        size_t padded = ((bytes + 7) / 8) * 8;
+
+        if (padded > size - pos) {
+            throw std::runtime_error("[prrng] Serialized data is truncated");
+        }
+
+        std::memcpy(out, data + pos, bytes);
+        pos += padded;
+    }
+
+    /**
+     * @brief Read one value.
+     * @return Value.
+     */
+    template <class T>
+    T get()
+    {
+        T ret;
+        this->get(&ret, 1);
+        return ret;
+    }
+
+    /**
+     * @brief Check that the rest of the buffer can hold `n` items of `bytes` bytes each,
+     * before storage is allocated for them.
+     *
+     * @param n Number of items (e.g. read from the buffer).
+     * @param bytes Size of each item (in bytes).
+     */
+    void require(size_t n, size_t bytes) const
+    {
+        if (bytes > 0 && n > (size - pos) / bytes) {
+            throw std::runtime_error("[prrng] Serialized data is truncated");
+        }
+    }
+
+    const char* data; ///< Pointer to the buffer.
+    size_t size; ///< Size of the buffer.
+    size_t pos; ///< Number of bytes read.
+};
+
+} // namespace detail
+
+/**
+ * Base class, see pcg32_array for description.
+ */
+template <class Generator, class Shape>
+class pcg32_arrayBase : public GeneratorBase_array<pcg32_arrayBase<Generator, Shape>, Shape> {
+    friend GeneratorBase_array<pcg32_arrayBase<Generator, Shape>, Shape>;
+
+private:
+    using derived_type = pcg32_arrayBase<Generator, Shape>;
+
+public:
+    using size_type = typename Shape::value_type; ///< Size type
+    using shape_type = Shape; ///< Shape type
+
+protected:
+    /**
+     * @brief Constructor alias.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    void init(const T& initstate)
+    {
+        std::copy(initstate.shape().cbegin(), initstate.shape().cend(), m_shape.begin());
+        std::copy(initstate.strides().cbegin(), initstate.strides().cend(), m_strides.begin());
+        m_size = initstate.size();
+        m_gen.resize(m_size);
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            m_gen[i] = Generator(initstate.flat(i));
+        }
+    }
+
+    /**
+     * @brief Constructor alias.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * @param initseq Sequence initiator for every item.
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    void init(const T& initstate, const U& initseq)
+    {
+        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+
+        std::copy(initstate.shape().cbegin(), initstate.shape().cend(), m_shape.begin());
+        std::copy(initstate.strides().cbegin(), initstate.strides().cend(), m_strides.begin());
+        m_size = initstate.size();
+        m_gen.resize(m_size);
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            m_gen[i] = Generator(initstate.flat(i), initseq.flat(i));
+        }
+    }
+
+public:
+    pcg32_arrayBase() = default;
+
+    /**
+     * Return a reference to one generator, using an array index.
+     *
+     * @param args Array index (number of arguments should correspond to the rank of the array).
+     * @return Reference to underlying generator.
+     */
+    template <class... Args>
+    Generator& operator()(Args... args)
+    {
+        return m_gen[this->get_item(0, 0, args...)];
+    }
+
+    /**
+     * Return a constant reference to one generator, using an array index.
+     *
+     * @param args Array index (number of arguments should correspond to the rank of the array).
+     * @return Reference to underlying generator.
+     */
+    template <class... Args>
+    const Generator& operator()(Args... args) const
+    {
+        return m_gen[this->get_item(0, 0, args...)];
+    }
+
+    /**
+     * Return a reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    Generator& operator[](size_t i)
+    {
+        PRRNG_DEBUG(i < m_size);
+        return m_gen[i];
+    }
+
+    /**
+     * Return a constant reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    const Generator& operator[](size_t i) const
+    {
+        PRRNG_DEBUG(i < m_size);
+        return m_gen[i];
+    }
+
+    /**
+     * Return a reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    Generator& flat(size_t i)
+    {
+        PRRNG_DEBUG(i < m_size);
+        return m_gen[i];
+    }
+
+    /**
+     * Return a constant reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    const Generator& flat(size_t i) const
+    {
+        PRRNG_DEBUG(i < m_size);
+        return m_gen[i];
+    }
+
+    /**
+     * Return the state of all generators.
+     * See pcg32::state().
+     *
+     * @return The state of each generator.
+     */
+    auto state() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->state<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::state()
+     *
+     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     */
+    template <class R>
+    R state()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = m_gen[i].template state<value_type>();
+        }
+
+        return ret;
+    }
+
+    /**
+     * Return the state initiator of all generators.
+     * See pcg32::initstate().
+     *
+     * @return The state initiator of each generator.
+     */
+    auto initstate() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->initstate<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initstate()
+     *
+     * @return The state initiator of each generator.
+     */
+    template <class R>
+    R initstate()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = m_gen[i].template initstate<value_type>();
+        }
+
+        return ret;
+    }
+
+    /**
+     * Return the sequence initiator of all generators.
+     * See pcg32::initseq().
+     *
+     * @return The sequence initiator of each generator.
+     */
+    auto initseq() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->initseq<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initseq()
+     *
+     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     */
+    template <class R>
+    R initseq()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = m_gen[i].template initseq<value_type>();
+        }
+
+        return ret;
+    }
+
+    /**
+     * Distance between two states.
+     * See pcg32::distance().
+     *
+     * @tparam T Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
+     * @param arg The state to which to compare.
+     */
+    template <class T>
+    auto distance(const T& arg) -> typename detail::return_type<int64_t, Shape>::type
+    {
+        using R = typename detail::return_type<int64_t, Shape>::type;
+        return this->distance<R, T>(arg);
+    }
+
+    /**
+     * Distance between two states.
+     * See pcg32::distance().
+     *
+     * @tparam R Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
+     * @tparam T Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
+     * @param arg The state to which to compare.
+     */
+    template <class R, class T>
+    R distance(const T& arg)
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = m_gen[i].template distance<value_type>(arg.flat(i));
+        }
+
+        return ret;
+    }
+
+    /**
+     * Advance generators.
+     * See pcg32::advance().
+     *
+     * @tparam T The type of the input array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`
+     *
+     * @param arg The distance (positive or negative) by which to advance each generator.
+     */
+    template <class T, std::enable_if_t<!std::is_integral<T>::value, bool> = true>
+    void advance(const T& arg)
+    {
+        for (size_type i = 0; i < m_size; ++i) {
+            m_gen[i].advance(arg.flat(i));
+        }
+    }
+
+    /**
+     * Advance all generators by the same distance.
+     * The jump is computed once, and then applied to each generator (at the cost of two
+     * multiplications per generator), see pcg32_stride.
+     *
+     * @param distance The distance (positive or negative) by which to advance all generators.
+     */
+    template <class T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    void advance(T distance)
+    {
+        if constexpr (std::is_base_of<pcg32, Generator>::value) {
+            pcg32_stride stride(distance);
+            for (size_type i = 0; i < m_size; ++i) {
+                m_gen[i].advance(stride);
+            }
+        }
+        else {
+            for (size_type i = 0; i < m_size; ++i) {
+                m_gen[i].advance(distance);
+            }
+        }
+    }
+
+    /**
+     * Restore generators from a state.
+     * See pcg32::restore().
+     *
+     * @tparam T The type of the input array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     *
+     * @param arg The state of each generator.
+     */
+    template <class T>
+    void restore(const T& arg)
+    {
+        for (size_type i = 0; i < m_size; ++i) {
+            m_gen[i].restore(arg.flat(i));
+        }
+    }
+
+    /**
+     * @brief Serialize the generators to a single binary blob,
+     * from which they can be restored using deserialize().
+     *
+     * The format is versioned, and consists of fields of 8 bytes (in the native byte order):
+     *
+     *      magic, version, flags, rank, shape[rank],
+     *      initstate[size], initseq[size], state[size], (index[size])
+     *
+     * whereby `index` is only stored for generators that keep track of their index
+     * (e.g. prrng::pcg32_index_array()).
+     * Because all fields are aligned, the blob can be read directly from a memory-mapped file.
+     *
+     * @return Binary blob.
+     */
+    std::vector<char> serialize() const
+    {
+        std::vector<char> ret;
+        this->serialize_to(ret);
+        return ret;
+    }
+
+    /**
+     * @brief Restore the generators (including their shape) from serialize().
+     *
+     * @param data Pointer to the binary blob (e.g. a memory-mapped file).
+     * @param size Size of the binary blob (in bytes).
+     * @return Number of bytes read.
+     * @throw std::runtime_error if the blob is not compatible with this array
+     * (that is then not modified).
+     */
+    size_t deserialize(const char* data, size_t size)
+    {
+        detail::serial_reader in(data, size);
+
+        if (in.get<uint64_t>() != detail::serial_magic) {
+            throw std::runtime_error("[prrng] Not serialized by prrng");
+        }
+
+        if (in.get<uint64_t>() != detail::serial_version) {
+            throw std::runtime_error("[prrng] Unsupported version of serialized data");
+        }
+
+        bool index = (in.get<uint64_t>() & detail::serial_index) != 0;
+
+        if (index != detail::has_index<Generator>::value) {
+            throw std::runtime_error("[prrng] Serialized data of a different generator type");
+        }
+
+        size_t rank = static_cast<size_t>(in.get<uint64_t>());
+
+        if constexpr (detail::is_std_array<Shape>::value) {
+            if (rank != m_shape.size()) {
+                throw std::runtime_error("[prrng] Serialized data of a different rank");
+            }
+        }
+
+        // the sizes are checked before anything is allocated (without overflowing)
+        in.require(rank, sizeof(uint64_t));
+        std::vector<size_t> shape(rank);
+        size_t count = 1;
+
+        for (auto& n : shape) {
+            n = static_cast<size_t>(in.get<uint64_t>());
+            in.require(n, count * sizeof(uint64_t));
+            count *= n;
+        }
+
+        // initstate, initseq, state (and index)
+        in.require(count, (detail::has_index<Generator>::value ? 4 : 3) * sizeof(uint64_t));
+
+        xt::xarray<uint64_t> initstate = xt::empty<uint64_t>(shape);
+        xt::xarray<uint64_t> initseq = xt::empty<uint64_t>(shape);
+        xt::xarray<uint64_t> state = xt::empty<uint64_t>(shape);
+        in.get(initstate.data(), initstate.size());
+        in.get(initseq.data(), initseq.size());
+        in.get(state.data(), state.size());
+
+        std::vector<int64_t> idx;
+
+        if constexpr (detail::has_index<Generator>::value) {
+            idx.resize(state.size());
+            in.get(idx.data(), idx.size());
+        }
+
+        if constexpr (!detail::is_std_array<Shape>::value) {
+            m_shape.resize(shape.size());
+            m_strides.resize(shape.size());
+        }
+
+        m_gen.clear();
+        this->init(initstate, initseq);
+        this->restore(state);
+
+        if constexpr (detail::has_index<Generator>::value) {
+            for (size_type i = 0; i < m_size; ++i) {
+                m_gen[i].set_index(static_cast<ptrdiff_t>(idx[i]));
+            }
+        }
+
+        return in.pos;
+    }
+
+    /**
+     * @brief Append serialize() to a buffer.
+     * @param buffer Buffer (modified).
+     */
+    void serialize_to(std::vector<char>& buffer) const
+    {
+        detail::serial_writer out(buffer);
+        out.put(detail::serial_magic);
+        out.put(detail::serial_version);
+        out.put(detail::has_index<Generator>::value ? detail::serial_index : uint64_t(0));
+        out.put(static_cast<uint64_t>(m_shape.size()));
+
+        for (auto& n : m_shape) {
+            out.put(static_cast<uint64_t>(n));
+        }
+
+        std::vector<uint64_t> tmp(m_size);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            tmp[i] = m_gen[i].initstate();
+        }
+        out.put(tmp.data(), tmp.size());
+
+        for (size_type i = 0; i < m_size; ++i) {
+            tmp[i] = m_gen[i].initseq();
+        }
+        out.put(tmp.data(), tmp.size());
+
+        for (size_type i = 0; i < m_size; ++i) {
+            tmp[i] = m_gen[i].state();
+        }
+        out.put(tmp.data(), tmp.size());
+
+        if constexpr (detail::has_index<Generator>::value) {
+            std::vector<int64_t> idx(m_size);
+
+            for (size_type i = 0; i < m_size; ++i) {
+                idx[i] = static_cast<int64_t>(m_gen[i].index());
+            }
+            out.put(idx.data(), idx.size());
+        }
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers \f$ 0 \leq r < 1 \f$, see
+     * prrng::GeneratorBase::lazy_random(). The draws of each generator are independent of the
+     * other generators, and equal to the draws of random().
+     *
+     * @param shape The shape of the draws per generator.
+     * @return Expression of shape `[shape(), shape]`.
+     */
     template <class S>
-    auto weibull(const S& ishape, double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    auto lazy_random(const S& shape)
+    {
+        return this->lazy_impl(shape, [](auto& g) { return g.next_double(); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_random(const S&)
+     */
+    template <class I, std::size_t L>
+    auto lazy_random(const I (&shape)[L])
+    {
+        return this->lazy_impl(shape, [](auto& g) { return g.next_double(); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to an exponential
+     * distribution, see lazy_random() and exponential().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param scale Scale.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_exponential(const S& shape, double scale = 1)
+    {
+        return this->lazy_impl(shape, [scale](auto& g) { return g.exponential(scale); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_exponential(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_exponential(const I (&shape)[L], double scale = 1)
+    {
+        return this->lazy_impl(shape, [scale](auto& g) { return g.exponential(scale); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a power
+     * distribution, see lazy_random() and power().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param k Exponent.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_power(const S& shape, double k = 1)
+    {
+        return this->lazy_impl(shape, [k](auto& g) { return g.power(k); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_power(const S&, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_power(const I (&shape)[L], double k = 1)
+    {
+        return this->lazy_impl(shape, [k](auto& g) { return g.power(k); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a gamma
+     * distribution, see lazy_random() and gamma().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_gamma(const S& shape, double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.gamma(k, scale); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_gamma(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_gamma(const I (&shape)[L], double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.gamma(k, scale); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a Pareto
+     * distribution, see lazy_random() and pareto().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_pareto(const S& shape, double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.pareto(k, scale); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_pareto(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_pareto(const I (&shape)[L], double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.pareto(k, scale); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a Weibull
+     * distribution, see lazy_random() and weibull().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_weibull(const S& shape, double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.weibull(k, scale); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_weibull(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_weibull(const I (&shape)[L], double k = 1, double scale = 1)
+    {
+        return this->lazy_impl(shape, [k, scale](auto& g) { return g.weibull(k, scale); });
+    }
+
+    /**
+     * @brief Lazily evaluated nd-array of random numbers distributed according to a normal
+     * distribution, see lazy_random() and normal().
+     *
+     * @param shape The shape of the draws per generator.
+     * @param mu Average.
+     * @param sigma Standard deviation.
+     * @return Expression of shape `[shape(), shape]`.
+     */
+    template <class S>
+    auto lazy_normal(const S& shape, double mu = 0, double sigma = 1)
+    {
+        return this->lazy_impl(shape, [mu, sigma](auto& g) { return g.normal(mu, sigma); });
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_normal(const S&, double, double)
+     */
+    template <class I, std::size_t L>
+    auto lazy_normal(const I (&shape)[L], double mu = 0, double sigma = 1)
+    {
+        return this->lazy_impl(shape, [mu, sigma](auto& g) { return g.normal(mu, sigma); });
+    }
+
+protected:
+    /**
+     * @brief Lazily evaluated draws, see detail::lazy_draw.
+     * The generators are advanced as if all numbers were drawn.
+     *
+     * @param ishape The shape of the draws per generator.
+     * @param draw Function drawing one number, called as `draw(generator)`.
+     * @return Expression of shape `[shape(), ishape]`.
+     */
+    template <class S, class F>
+    auto lazy_impl(const S& ishape, F draw)
+    {
+        size_t n = detail::size(ishape);
+        std::vector<Generator> copy = m_gen;
+
+        for (auto& gen : m_gen) {
+            gen.advance(static_cast<int64_t>(n));
+        }
+
+        auto shape = detail::concatenate<Shape, S>::two(m_shape, ishape);
+        return detail::make_lazy_draw(std::move(copy), shape, n, draw);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::lazy_impl(const S&, F)
+     */
+    template <class I, std::size_t L, class F>
+    auto lazy_impl(const I (&ishape)[L], F draw)
+    {
+        std::array<size_t, L> s;
+        std::copy(ishape, ishape + L, s.begin());
+        return this->lazy_impl(s, draw);
+    }
+
+    /**
+     * @brief Take a decision for generators `[i, i + n)`: `next_double() < p`.
+     * For pcg32() generators the generators are advanced without branches, comparing the raw
+     * random number to an integer threshold (see detail::pcg32_decide()).
+     *
+     * @param i Flat index of the first generator.
+     * @param n Number of generators (at most detail::decide_block_size).
+     * @param p Probability per generator [n].
+     * @param mask Where `true` the decision is `false` and no random number is drawn
+     *     [n] (`nullptr` for no mask).
+     * @param ret Outcome [n].
+     */
+    void decide_block(size_t i, size_t n, const double* p, const bool* mask, bool* ret)
+    {
+        if constexpr (std::is_base_of<pcg32, Generator>::value) {
+            uint64_t state[detail::decide_block_size];
+            uint64_t inc[detail::decide_block_size];
+
+            for (size_t l = 0; l < n; ++l) {
+                const pcg32& gen = m_gen[i + l];
+                state[l] = gen.m_state;
+                inc[l] = gen.m_inc;
+            }
+
+            detail::pcg32_decide(state, inc, p, mask, n, ret);
+
+            for (size_t l = 0; l < n; ++l) {
+                static_cast<pcg32&>(m_gen[i + l]).m_state = state[l];
+            }
+        }
+        else {
+            for (size_t l = 0; l < n; ++l) {
+                if (mask != nullptr && mask[l]) {
+                    ret[l] = false;
+                }
+                else {
+                    ret[l] = m_gen[i + l].next_double() < p[l];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     */
+    void cumsum_random_impl(double* ret, const size_t* n)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_random(n[i]);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param scale Scale.
+     * @param exact See prrng::GeneratorBase::cumsum_exponential().
+     */
+    void cumsum_exponential_impl(double* ret, const size_t* n, double scale, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_exponential(n[i], scale, exact);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param k Scale.
+     */
+    void cumsum_power_impl(double* ret, const size_t* n, double k)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_power(n[i], k);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     * @param exact See prrng::GeneratorBase::cumsum_gamma().
+     */
+    void cumsum_gamma_impl(double* ret, const size_t* n, double k, double scale, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_gamma(n[i], k, scale, exact);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     */
+    void cumsum_pareto_impl(double* ret, const size_t* n, double k, double scale)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_pareto(n[i], k, scale);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param k Shape parameter.
+     * @param scale Scale parameter.
+     */
+    void cumsum_weibull_impl(double* ret, const size_t* n, double k, double scale)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_weibull(n[i], k, scale);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param mu Mean.
+     * @param sigma Standard deviation.
+     * @param exact See prrng::GeneratorBase::cumsum_normal().
+     */
+    void cumsum_normal_impl(double* ret, const size_t* n, double mu, double sigma, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = m_gen[i].cumsum_normal(n[i], mu, sigma, exact);
+        }
+    }
+
+    /**
+     * @brief Return the result of the cumulative sum of `n` random numbers.
+     * @param ret Output, per generator.
+     * @param n Number to draw, per generator.
+     * @param convert Conversion of each random `uint32_t` to a random number.
+     */
+    template <class F>
+    void cumsum_convert_impl(double* ret, const size_t* n, const F& convert)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            double sum = 0.0;
+            for (size_t j = 0; j < n[i]; ++j) {
+                sum += convert(m_gen[i].next_uint32());
+            }
+            ret[i] = sum;
+        }
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param n The number of random numbers per generator.
+     */
+    void draw_list_double(double* data, size_t n)
+    {
+        this->draw_list(data, n, detail::uint32_to_double{});
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param n The number of random numbers per generator.
+     */
+    void draw_list_positive_double(double* data, size_t n)
+    {
+        this->draw_list(data, n, detail::uint32_to_positive_double{});
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     * Single precision, see prrng::pcg32::next_float().
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param n The number of random numbers per generator.
+     */
+    void draw_list_float(float* data, size_t n)
+    {
+        this->draw_list(data, n, detail::uint32_to_float{});
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     * Single precision, see prrng::pcg32::next_positive_float().
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param n The number of random numbers per generator.
+     */
+    void draw_list_positive_float(float* data, size_t n)
+    {
+        this->draw_list(data, n, detail::uint32_to_positive_float{});
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     * For pcg32() generators, #PRRNG_PCG32_LANES generators are advanced in lock-step
+     * (see detail::pcg32_lanes()).
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param n The number of random numbers per generator.
+     * @param convert Conversion of each random `uint32_t` to the output type.
+     */
+    template <class T, class F>
+    void draw_list(T* data, size_t n, const F& convert)
+    {
+        if constexpr (std::is_base_of<pcg32, Generator>::value) {
+            constexpr size_t L = PRRNG_PCG32_LANES;
+
+            PRRNG_PARALLEL_FOR(m_size * n)
+            for (size_type i = 0; i < m_size; i += L) {
+                size_t m = std::min(static_cast<size_t>(L), static_cast<size_t>(m_size - i));
+                uint64_t state[L];
+                uint64_t inc[L];
+
+                for (size_t l = 0; l < m; ++l) {
+                    const pcg32& gen = m_gen[i + l];
+                    state[l] = gen.m_state;
+                    inc[l] = gen.m_inc;
+                }
+
+                detail::pcg32_lanes(state, inc, m, n, &data[i * n], convert);
+
+                for (size_t l = 0; l < m; ++l) {
+                    static_cast<pcg32&>(m_gen[i + l]).m_state = state[l];
+                }
+            }
+        }
+        else {
+            PRRNG_PARALLEL_FOR(m_size * n)
+            for (size_type i = 0; i < m_size; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    data[i * n + j] = convert(m_gen[i].next_uint32());
+                }
+            }
+        }
+    }
+
+    /**
+     * Draw `n` random numbers per array item, and write them to the correct position in `data`
+     * (assuming row-major storage!).
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param bound The upper bound of the random numbers.
+     * @param n The number of random numbers per generator.
+     */
+    void draw_list_uint32(uint32_t* data, uint32_t bound, size_t n)
+    {
+        PRRNG_PARALLEL_FOR(m_size * n)
+        for (size_type i = 0; i < m_size; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                data[i * n + j] = m_gen[i].next_uint32(bound);
+            }
+        }
+    }
+
+    /**
+     * Draw `n` random integers \f$ offset \leq r < offset + bound \f$ per array item
+     * using the multiply-shift method (see detail::lemire_uint32()), and write them to the
+     * correct position in `data` (assuming row-major storage!).
+     * The random numbers are drawn using draw_list() (i.e. in lock-step for pcg32() generators),
+     * only the few rejected numbers are redrawn per generator.
+     * The output is identical to prrng::GeneratorBase::fast_randint() per generator.
+     *
+     * @param data Pointer to the data (no bounds-check).
+     * @param offset Lower bound of the random integers.
+     * @param bound Size of the interval of the random integers.
+     * @param n The number of random numbers per generator.
+     */
+    template <class T>
+    void draw_list_bounded(T* data, uint64_t offset, uint64_t bound, size_t n)
+    {
+        if (bound > std::numeric_limits<uint32_t>::max()) {
+            PRRNG_PARALLEL_FOR(m_size * n)
+            for (size_type i = 0; i < m_size; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    data[i * n + j] = static_cast<T>(offset + m_gen[i].next_uint64(bound));
+                }
+            }
+            return;
+        }
+
+        uint32_t b = static_cast<uint32_t>(bound);
+        std::vector<uint32_t> raw(m_size * n);
+        this->draw_list(raw.data(), n, detail::uint32_to_uint32{});
+
+        PRRNG_PARALLEL_FOR(m_size * n)
+        for (size_type i = 0; i < m_size; ++i) {
+            const uint32_t* r = &raw[i * n];
+            size_t k = 0;
+            auto next = [&]() { return k < n ? r[k++] : m_gen[i].next_uint32(); };
+            for (size_t j = 0; j < n; ++j) {
+                data[i * n + j] = static_cast<T>(offset + detail::lemire_uint32(next(), b, next));
+            }
+        }
+    }
+
+private:
+    /**
+     * implementation of `operator()`.
+     * (Last call in recursion).
+     */
+    template <class T>
+    size_t get_item(size_t sum, size_t d, T arg)
+    {
+        return sum + arg * m_strides[d];
+    }
+
+    /**
+     * implementation of `operator()`.
+     * (Called recursively).
+     */
+    template <class T, class... Args>
+    size_t get_item(size_t sum, size_t d, T arg, Args... args)
+    {
+        return get_item(sum + arg * m_strides[d], d + 1, args...);
+    }
+
+protected:
+    std::vector<Generator> m_gen; ///< Underlying storage: one generator per array item
+    using GeneratorBase_array<derived_type, Shape>::m_size;
+    using GeneratorBase_array<derived_type, Shape>::m_shape;
+    using GeneratorBase_array<derived_type, Shape>::m_strides;
+};
+
+/**
+ * Array of independent generators.
+ * The idea is that each array-entry has its own random sequence, initiated by its own seed.
+ * An array of random numbers can then be generated whose shape if composed of the #shape,
+ * the shape of the array of generators, followed by the desired shape of the random sequence
+ * draw per generator.
+ * Let us consider an example. Suppose that we have a list of n = 5 generators,
+ * and we want to generate i = 8 random numbers for each generator.
+ * Then the output will be collected in a matrix of shape [n, i] = [5, 8] where each row
+ * corresponds to a generator and the columns for that row are the random sequence generated
+ * by that generator.
+ * Since this class is general, you can also imagine an array of [m, n, o, p] generators with
+ * a random sequence reshaped in a (row-major) array of shape [a, b, c, d, e].
+ * The output is then collected in an array of shape [m, n, o, p, a, b, c, d, e].
+ *
+ * Note that a reference to each generator can be obtained using the `[]` and `()` operators,
+ * e.g. `generators[flat_index]` and `generators(i, j, k, ...)`. All functions of pcg32()
+ * can be used for each reference.
+ * In addition, convenience functions state(), initstate(), initseq(), restore() are provided
+ * here to store/restore the state of the entire array of generators.
+ */
+class pcg32_array : public pcg32_arrayBase<pcg32, std::vector<size_t>> {
+private:
+    using derived_type = pcg32_arrayBase<pcg32, std::vector<size_t>>;
+
+public:
+    using size_type = size_t; ///< Size type
+    using shape_type = std::vector<size_t>; ///< Shape type
+
+    pcg32_array() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    pcg32_array(const T& initstate)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate);
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_array(const T& initstate, const U& initseq)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<pcg32, shape_type>::m_gen;
+    using GeneratorBase_array<derived_type, shape_type>::m_size;
+    using GeneratorBase_array<derived_type, shape_type>::m_shape;
+    using GeneratorBase_array<derived_type, shape_type>::m_strides;
+};
+
+/**
+ * Fixed rank version of pcg32_array
+ */
+template <size_t N>
+class pcg32_tensor : public pcg32_arrayBase<pcg32, std::array<size_t, N>> {
+private:
+    using derived_type = pcg32_arrayBase<pcg32, std::array<size_t, N>>;
+
+public:
+    using size_type = size_t; ///< Size type
+    using shape_type = std::array<size_t, N>; ///< Shape type
+
+    pcg32_tensor() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    pcg32_tensor(const T& initstate)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate);
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_tensor(const T& initstate, const U& initseq)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<pcg32, shape_type>::m_gen;
+    using GeneratorBase_array<derived_type, shape_type>::m_size;
+    using GeneratorBase_array<derived_type, shape_type>::m_shape;
+    using GeneratorBase_array<derived_type, shape_type>::m_strides;
+};
+
+/**
+ * @brief Array of prrng::pcg32_index().
+ */
+class pcg32_index_array : public pcg32_arrayBase<pcg32_index, std::vector<size_t>> {
+private:
+    using derived_type = pcg32_arrayBase<pcg32_index, std::vector<size_t>>;
+
+public:
+    pcg32_index_array() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_index_array(const T& initstate, const U& initseq)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<pcg32_index, std::vector<size_t>>::m_gen;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_size;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_shape;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_strides;
+};
+
+/**
+ * Fixed rank version of pcg32_index_array
+ */
+template <size_t N>
+class pcg32_index_tensor : public pcg32_arrayBase<pcg32_index, std::array<size_t, N>> {
+private:
+    using derived_type = pcg32_arrayBase<pcg32_index, std::array<size_t, N>>;
+
+public:
+    pcg32_index_tensor() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_index_tensor(const T& initstate, const U& initseq)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<pcg32_index, std::array<size_t, N>>::m_gen;
+    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_size;
+    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_shape;
+    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_strides;
+};
+
+/**
+ * @brief Array of prrng::philox() generators, with the same API as prrng::pcg32_array().
+ */
+class philox_array : public pcg32_arrayBase<philox, std::vector<size_t>> {
+private:
+    using derived_type = pcg32_arrayBase<philox, std::vector<size_t>>;
+
+public:
+    using size_type = size_t; ///< Size type
+    using shape_type = std::vector<size_t>; ///< Shape type
+
+    philox_array() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    philox_array(const T& initstate)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate);
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    philox_array(const T& initstate, const U& initseq)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<philox, shape_type>::m_gen;
+    using GeneratorBase_array<derived_type, shape_type>::m_size;
+    using GeneratorBase_array<derived_type, shape_type>::m_shape;
+    using GeneratorBase_array<derived_type, shape_type>::m_strides;
+};
+
+/**
+ * @brief Array of prrng::philox_index().
+ */
+class philox_index_array : public pcg32_arrayBase<philox_index, std::vector<size_t>> {
+private:
+    using derived_type = pcg32_arrayBase<philox_index, std::vector<size_t>>;
+
+public:
+    philox_index_array() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    philox_index_array(const T& initstate, const U& initseq)
+    {
+        m_shape.resize(initstate.dimension());
+        m_strides.resize(initstate.dimension());
+        this->init(initstate, initseq);
+    }
+
+protected:
+    using pcg32_arrayBase<philox_index, std::vector<size_t>>::m_gen;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_size;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_shape;
+    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_strides;
+};
+
+/**
+ * @brief Reference to one item of an array of generators with structure-of-arrays storage,
+ * see prrng::pcg32_soa_array().
+ * It behaves like prrng::pcg32(), whereby all methods act on the referenced item.
+ *
+ * @warning The reference only stores pointers to the storage of the array:
+ * it is cheap to copy, but it should not outlive the array (or a resize of it).
+ */
+class pcg32_reference : public GeneratorBase<pcg32_reference> {
+public:
+    /**
+     * @param state Pointer to the state.
+     * @param inc Pointer to the increment.
+     * @param initstate Pointer to the state initiator.
+     * @param initseq Pointer to the sequence initiator.
+     */
+    pcg32_reference(
+        uint64_t* state,
+        const uint64_t* inc,
+        const uint64_t* initstate,
+        const uint64_t* initseq
+    )
+    {
+        m_state = state;
+        m_inc = inc;
+        m_initstate = initstate;
+        m_initseq = initseq;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::operator()()
+     */
+    uint32_t operator()()
+    {
+        uint64_t oldstate = *m_state;
+        *m_state = oldstate * PRRNG_PCG32_MULT + *m_inc;
+        return detail::pcg32_output(oldstate);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_uint32()
+     */
+    uint32_t next_uint32()
+    {
+        return (*this)();
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_uint32(uint32_t)
+     */
+    uint32_t next_uint32(uint32_t bound)
+    {
+        // see pcg32::next_uint32(uint32_t)
+        uint32_t threshold = (~bound + 1u) % bound;
+
+        for (;;) {
+            uint32_t r = next_uint32();
+            if (r >= threshold) {
+                return r % bound;
+            }
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_float()
+     */
+    float next_float()
+    {
+        return detail::uint32_to_float{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_positive_float()
+     */
+    float next_positive_float()
+    {
+        return detail::uint32_to_positive_float{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_double()
+     */
+    double next_double()
+    {
+        return detail::uint32_to_double{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::next_positive_double()
+     */
+    double next_positive_double()
+    {
+        return detail::uint32_to_positive_double{}(next_uint32());
+    }
+
+    /**
+     * @copydoc prrng::pcg32::state() const
+     */
+    uint64_t state() const
+    {
+        return *m_state;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::state() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R state() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_state);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initstate() const
+     */
+    uint64_t initstate() const
+    {
+        return *m_initstate;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initstate() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initstate() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_initstate);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initseq() const
+     */
+    uint64_t initseq() const
+    {
+        return *m_initseq;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initseq() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initseq() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_initseq);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::restore(T)
+     */
+    template <typename T>
+    void restore(T state)
+    {
+        static_assert(sizeof(uint64_t) >= sizeof(T), "Down-casting not allowed.");
+        *m_state = static_cast<uint64_t>(state);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     */
+    int64_t operator-(const pcg32_reference& other) const
+    {
+        PRRNG_DEBUG(*m_inc == *other.m_inc);
+        return (int64_t)detail::pcg32_distance(*m_state, *other.m_state, *m_inc);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     */
+    template <typename R = int64_t>
+    R distance(const pcg32_reference& other) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        return static_cast<R>(this->operator-(other));
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(T) const
+     */
+    template <
+        typename R = int64_t,
+        typename T,
+        std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    R distance(T other_state) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        uint64_t d = detail::pcg32_distance(*m_state, static_cast<uint64_t>(other_state), *m_inc);
+        return static_cast<R>((int64_t)d);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::advance(T)
+     */
+    template <typename T>
+    void advance(T distance)
+    {
+        static_assert(sizeof(int64_t) >= sizeof(T), "Down-casting not allowed.");
+        int64_t delta = static_cast<int64_t>(distance);
+        *m_state = detail::pcg32_advance(*m_state, *m_inc, (uint64_t)delta);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::advance(const pcg32_stride&)
+     */
+    void advance(const pcg32_stride& stride)
+    {
+        *m_state = stride.apply(*m_state, *m_inc);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::operator==(const pcg32&) const
+     */
+    bool operator==(const pcg32_reference& other) const
+    {
+        return *m_state == *other.m_state && *m_inc == *other.m_inc;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::operator!=(const pcg32&) const
+     */
+    bool operator!=(const pcg32_reference& other) const
+    {
+        return *m_state != *other.m_state || *m_inc != *other.m_inc;
+    }
+
+protected:
+    uint64_t* m_state; ///< Pointer to the RNG state.
+    const uint64_t* m_inc; ///< Pointer to the increment.
+    const uint64_t* m_initstate; ///< Pointer to the state initiator.
+    const uint64_t* m_initseq; ///< Pointer to the sequence initiator.
+};
+
+/**
+ * @brief Reference to one item of an array of generators with structure-of-arrays storage,
+ * see prrng::pcg32_index_soa_array().
+ * It behaves like prrng::pcg32_index(), whereby all methods act on the referenced item.
+ *
+ * @warning The reference only stores pointers to the storage of the array:
+ * it is cheap to copy, but it should not outlive the array (or a resize of it).
+ */
+class pcg32_index_reference : public pcg32_reference {
+public:
+    /**
+     * @param state Pointer to the state.
+     * @param inc Pointer to the increment.
+     * @param initstate Pointer to the state initiator.
+     * @param initseq Pointer to the sequence initiator.
+     * @param index Pointer to the index of the generator.
+     * @param delta Pointer to the delta-distribution signal.
+     */
+    pcg32_index_reference(
+        uint64_t* state,
+        const uint64_t* inc,
+        const uint64_t* initstate,
+        const uint64_t* initseq,
+        ptrdiff_t* index,
+        uint8_t* delta
+    )
+        : pcg32_reference(state, inc, initstate, initseq)
+    {
+        m_index = index;
+        m_delta = delta;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::state_at(ptrdiff_t)
+     */
+    uint64_t state_at(ptrdiff_t index)
+    {
+        if (*m_delta) {
+            return *m_state;
+        }
+        return detail::pcg32_advance(*m_state, *m_inc, (uint64_t)(index - *m_index));
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::jump_to(ptrdiff_t)
+     */
+    void jump_to(ptrdiff_t index)
+    {
+        if (*m_delta) {
+            return;
+        }
+        this->advance(index - *m_index);
+        *m_index = index;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::jump_to(ptrdiff_t, pcg32_stride&)
+     */
+    void jump_to(ptrdiff_t index, pcg32_stride& jump)
+    {
+        if (*m_delta) {
+            return;
+        }
+        ptrdiff_t distance = index - *m_index;
+        if (distance != jump.distance<ptrdiff_t>()) {
+            jump = pcg32_stride(distance);
+        }
+        this->advance(jump);
+        *m_index = index;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::drawn(ptrdiff_t)
+     */
+    void drawn(ptrdiff_t n)
+    {
+        if (*m_delta) {
+            return;
+        }
+        *m_index += n;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::set_delta(bool)
+     */
+    void set_delta(bool delta)
+    {
+        *m_delta = static_cast<uint8_t>(delta);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::index() const
+     */
+    ptrdiff_t index() const
+    {
+        return *m_index;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::set_index(ptrdiff_t)
+     */
+    void set_index(ptrdiff_t index)
+    {
+        *m_index = index;
+    }
+
+protected:
+    ptrdiff_t* m_index; ///< Pointer to the index of the generator.
+    uint8_t* m_delta; ///< Pointer to the delta-distribution signal.
+};
+
+/**
+ * @brief Read-only reference to one item of an array of generators with structure-of-arrays
+ * storage, obtained from a constant prrng::pcg32_soa_array().
+ * It provides the functions of prrng::pcg32_reference() that do not modify the generator.
+ *
+ * @warning The reference only stores pointers to the storage of the array:
+ * it is cheap to copy, but it should not outlive the array (or a resize of it).
+ */
+class pcg32_const_reference {
+public:
+    /**
+     * @param state Pointer to the state.
+     * @param inc Pointer to the increment.
+     * @param initstate Pointer to the state initiator.
+     * @param initseq Pointer to the sequence initiator.
+     */
+    pcg32_const_reference(
+        const uint64_t* state,
+        const uint64_t* inc,
+        const uint64_t* initstate,
+        const uint64_t* initseq
+    )
+    {
+        m_state = state;
+        m_inc = inc;
+        m_initstate = initstate;
+        m_initseq = initseq;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::state() const
+     */
+    uint64_t state() const
+    {
+        return *m_state;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::state() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R state() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_state);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initstate() const
+     */
+    uint64_t initstate() const
+    {
+        return *m_initstate;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initstate() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initstate() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_initstate);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initseq() const
+     */
+    uint64_t initseq() const
+    {
+        return *m_initseq;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::initseq() const
+     *
+     * @tparam R use a different return-type. There are some internal checks if the type is able to
+     * store the internal state of type `uint64_t`.
+     */
+    template <typename R>
+    R initseq() const
+    {
+        static_assert(std::numeric_limits<R>::max() >= std::numeric_limits<uint64_t>::max(), "");
+        static_assert(std::numeric_limits<R>::min() <= std::numeric_limits<uint64_t>::min(), "");
+        return static_cast<R>(*m_initseq);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     */
+    int64_t operator-(const pcg32_const_reference& other) const
+    {
+        PRRNG_DEBUG(*m_inc == *other.m_inc);
+        return (int64_t)detail::pcg32_distance(*m_state, *other.m_state, *m_inc);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(const pcg32&) const
+     */
+    template <typename R = int64_t>
+    R distance(const pcg32_const_reference& other) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        return static_cast<R>(this->operator-(other));
+    }
+
+    /**
+     * @copydoc prrng::pcg32::distance(T) const
+     */
+    template <
+        typename R = int64_t,
+        typename T,
+        std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    R distance(T other_state) const
+    {
+        static_assert(sizeof(R) >= sizeof(int64_t), "Down-casting not allowed.");
+        uint64_t d = detail::pcg32_distance(*m_state, static_cast<uint64_t>(other_state), *m_inc);
+        return static_cast<R>((int64_t)d);
+    }
+
+    /**
+     * @copydoc prrng::pcg32::operator==(const pcg32&) const
+     */
+    bool operator==(const pcg32_const_reference& other) const
+    {
+        return *m_state == *other.m_state && *m_inc == *other.m_inc;
+    }
+
+    /**
+     * @copydoc prrng::pcg32::operator!=(const pcg32&) const
+     */
+    bool operator!=(const pcg32_const_reference& other) const
+    {
+        return *m_state != *other.m_state || *m_inc != *other.m_inc;
+    }
+
+protected:
+    const uint64_t* m_state; ///< Pointer to the RNG state.
+    const uint64_t* m_inc; ///< Pointer to the increment.
+    const uint64_t* m_initstate; ///< Pointer to the state initiator.
+    const uint64_t* m_initseq; ///< Pointer to the sequence initiator.
+};
+
+/**
+ * @brief Read-only reference to one item of an array of generators with structure-of-arrays
+ * storage, obtained from a constant prrng::pcg32_index_soa_array().
+ * It provides the functions of prrng::pcg32_index_reference() that do not modify the generator.
+ *
+ * @warning The reference only stores pointers to the storage of the array:
+ * it is cheap to copy, but it should not outlive the array (or a resize of it).
+ */
+class pcg32_index_const_reference : public pcg32_const_reference {
+public:
+    /**
+     * @param state Pointer to the state.
+     * @param inc Pointer to the increment.
+     * @param initstate Pointer to the state initiator.
+     * @param initseq Pointer to the sequence initiator.
+     * @param index Pointer to the index of the generator.
+     * @param delta Pointer to the delta-distribution signal.
+     */
+    pcg32_index_const_reference(
+        const uint64_t* state,
+        const uint64_t* inc,
+        const uint64_t* initstate,
+        const uint64_t* initseq,
+        const ptrdiff_t* index,
+        const uint8_t* delta
+    )
+        : pcg32_const_reference(state, inc, initstate, initseq)
+    {
+        m_index = index;
+        m_delta = delta;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::state_at(ptrdiff_t)
+     */
+    uint64_t state_at(ptrdiff_t index) const
+    {
+        if (*m_delta) {
+            return *m_state;
+        }
+        return detail::pcg32_advance(*m_state, *m_inc, (uint64_t)(index - *m_index));
+    }
+
+    /**
+     * @copydoc prrng::pcg32_index::index() const
+     */
+    ptrdiff_t index() const
+    {
+        return *m_index;
+    }
+
+protected:
+    const ptrdiff_t* m_index; ///< Pointer to the index of the generator.
+    const uint8_t* m_delta; ///< Pointer to the delta-distribution signal.
+};
+
+/**
+ * Base class, see pcg32_soa_array for description.
+ *
+ * @tparam Reference Type of the reference to one item, prrng::pcg32_reference() or
+ * prrng::pcg32_index_reference().
+ * @tparam Shape Type of the shape and strides lists.
+ */
+template <class Reference, class Shape>
+class pcg32_soa_arrayBase
+    : public GeneratorBase_array<pcg32_soa_arrayBase<Reference, Shape>, Shape> {
+    friend GeneratorBase_array<pcg32_soa_arrayBase<Reference, Shape>, Shape>;
+
+private:
+    using derived_type = pcg32_soa_arrayBase<Reference, Shape>;
+    static constexpr bool is_index = std::is_same<Reference, pcg32_index_reference>::value;
+
+public:
+    using size_type = typename Shape::value_type; ///< Size type
+    using shape_type = Shape; ///< Shape type
+    using reference = Reference; ///< Reference to one item
+
+    /**
+     * Read-only reference to one item.
+     */
+    using const_reference =
+        std::conditional_t<is_index, pcg32_index_const_reference, pcg32_const_reference>;
+
+protected:
+    /**
+     * @brief Constructor alias.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    void init(const T& initstate)
+    {
+        this->allocate(initstate);
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            this->seed_item(i, static_cast<uint64_t>(initstate.flat(i)), PRRNG_PCG32_INITSEQ);
+        }
+    }
+
+    /**
+     * @brief Constructor alias.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * @param initseq Sequence initiator for every item.
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    void init(const T& initstate, const U& initseq)
+    {
+        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+        this->allocate(initstate);
+
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            this->seed_item(
+                i, static_cast<uint64_t>(initstate.flat(i)), static_cast<uint64_t>(initseq.flat(i))
+            );
+        }
+    }
+
+public:
+    pcg32_soa_arrayBase() = default;
+
+    /**
+     * Return a reference to one generator, using an array index.
+     *
+     * @param args Array index (number of arguments should correspond to the rank of the array).
+     * @return Reference to underlying generator.
+     */
+    template <class... Args>
+    Reference operator()(Args... args)
+    {
+        return this->get_reference(this->get_item(0, 0, args...));
+    }
+
+    /**
+     * Return a read-only reference to one generator, using an array index.
+     *
+     * @param args Array index (number of arguments should correspond to the rank of the array).
+     * @return Reference to underlying generator.
+     */
+    template <class... Args>
+    const_reference operator()(Args... args) const
+    {
+        return this->get_reference(this->get_item(0, 0, args...));
+    }
+
+    /**
+     * Return a reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    Reference operator[](size_t i)
+    {
+        PRRNG_DEBUG(i < m_size);
+        return this->get_reference(i);
+    }
+
+    /**
+     * Return a read-only reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    const_reference operator[](size_t i) const
+    {
+        PRRNG_DEBUG(i < m_size);
+        return this->get_reference(i);
+    }
+
+    /**
+     * Return a reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    Reference flat(size_t i)
+    {
+        PRRNG_DEBUG(i < m_size);
+        return this->get_reference(i);
+    }
+
+    /**
+     * Return a read-only reference to one generator, using a flat index.
+     *
+     * @param i Flat index.
+     * @return Reference to underlying generator.
+     */
+    const_reference flat(size_t i) const
+    {
+        PRRNG_DEBUG(i < m_size);
+        return this->get_reference(i);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::state()
+     */
+    auto state() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->state<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::state()
+     *
+     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     */
+    template <class R>
+    R state()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = static_cast<value_type>(m_state[i]);
+        }
+
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initstate()
+     */
+    auto initstate() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->initstate<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initstate()
+     *
+     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     */
+    template <class R>
+    R initstate()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = static_cast<value_type>(m_initstate[i]);
+        }
+
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initseq()
+     */
+    auto initseq() -> typename detail::return_type<uint64_t, Shape>::type
+    {
+        using R = typename detail::return_type<uint64_t, Shape>::type;
+        return this->initseq<R>();
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::initseq()
+     *
+     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
+     * N>`
+     */
+    template <class R>
+    R initseq()
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = static_cast<value_type>(m_initseq[i]);
+        }
+
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::distance(const T&)
+     */
+    template <class T>
+    auto distance(const T& arg) -> typename detail::return_type<int64_t, Shape>::type
+    {
+        using R = typename detail::return_type<int64_t, Shape>::type;
+        return this->distance<R, T>(arg);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::distance(const T&)
+     */
+    template <class R, class T>
+    R distance(const T& arg)
+    {
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_shape);
+
+        for (size_type i = 0; i < m_size; ++i) {
+            ret.flat(i) = this->get_reference(i).template distance<value_type>(arg.flat(i));
+        }
+
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::advance(const T&)
+     */
+    template <class T, std::enable_if_t<!std::is_integral<T>::value, bool> = true>
+    void advance(const T& arg)
+    {
+        for (size_type i = 0; i < m_size; ++i) {
+            int64_t delta = static_cast<int64_t>(arg.flat(i));
+            m_state[i] = detail::pcg32_advance(m_state[i], m_inc[i], (uint64_t)delta);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::advance(T)
+     */
+    template <class T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
+    void advance(T distance)
+    {
+        pcg32_stride stride(distance);
+        for (size_type i = 0; i < m_size; ++i) {
+            m_state[i] = stride.apply(m_state[i], m_inc[i]);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::restore(const T&)
+     */
+    template <class T>
+    void restore(const T& arg)
+    {
+        for (size_type i = 0; i < m_size; ++i) {
+            m_state[i] = static_cast<uint64_t>(arg.flat(i));
+        }
+    }
+
+protected:
+    /**
+     * @copydoc prrng::pcg32_arrayBase::decide_block
+     */
+    void decide_block(size_t i, size_t n, const double* p, const bool* mask, bool* ret)
+    {
+        detail::pcg32_decide(&m_state[i], &m_inc[i], p, mask, n, ret);
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_random_impl(double*, const size_t*)
+     */
+    void cumsum_random_impl(double* ret, const size_t* n)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_random(n[i]);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_exponential_impl
+     */
+    void cumsum_exponential_impl(double* ret, const size_t* n, double scale, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_exponential(n[i], scale, exact);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_power_impl(double*, const size_t*, double)
+     */
+    void cumsum_power_impl(double* ret, const size_t* n, double k)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_power(n[i], k);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_gamma_impl
+     */
+    void cumsum_gamma_impl(double* ret, const size_t* n, double k, double scale, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_gamma(n[i], k, scale, exact);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_pareto_impl(double*, const size_t*, double, double)
+     */
+    void cumsum_pareto_impl(double* ret, const size_t* n, double k, double scale)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_pareto(n[i], k, scale);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_weibull_impl(double*, const size_t*, double, double)
+     */
+    void cumsum_weibull_impl(double* ret, const size_t* n, double k, double scale)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_weibull(n[i], k, scale);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_normal_impl
+     */
+    void cumsum_normal_impl(double* ret, const size_t* n, double mu, double sigma, bool exact)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            ret[i] = this->get_reference(i).cumsum_normal(n[i], mu, sigma, exact);
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::cumsum_convert_impl(double*, const size_t*, const F&)
+     */
+    template <class F>
+    void cumsum_convert_impl(double* ret, const size_t* n, const F& convert)
+    {
+        PRRNG_PARALLEL_FOR(m_size)
+        for (size_type i = 0; i < m_size; ++i) {
+            double sum = 0.0;
+            for (size_t j = 0; j < n[i]; ++j) {
+                sum += convert(this->next_item(i));
+            }
+            ret[i] = sum;
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::draw_list_double(double*, size_t)
+     */
+    void draw_list_double(double* data, size_t n)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->weibull_impl<R>(ishape, k, scale);
+        this->draw_list(data, n, detail::uint32_to_double{});
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::pcg32_arrayBase::draw_list_positive_double(double*, size_t)
      */
-    template <class R, class S>
-    R weibull(const S& ishape, double k = 1, double scale = 1)
+    void draw_list_positive_double(double* data, size_t n)
     {
-        return this->weibull_impl<R>(ishape, k, scale);
+        this->draw_list(data, n, detail::uint32_to_positive_double{});
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
+     * @copydoc prrng::pcg32_arrayBase::draw_list_float(float*, size_t)
      */
-    template <class I, std::size_t L>
-    auto weibull(const I (&ishape)[L], double k = 1, double scale = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    void draw_list_float(float* data, size_t n)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->weibull_impl<R>(detail::to_array(ishape), k, scale);
+        this->draw_list(data, n, detail::uint32_to_float{});
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::weibull(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::pcg32_arrayBase::draw_list_positive_float(float*, size_t)
      */
-    template <class R, class I, std::size_t L>
-    R weibull(const I (&ishape)[L], double k = 1, double scale = 1)
+    void draw_list_positive_float(float* data, size_t n)
     {
-        return this->weibull_impl<R>(detail::to_array(ishape), k, scale);
+        this->draw_list(data, n, detail::uint32_to_positive_float{});
     }
 
     /**
-     * Per generator, generate an nd-array of random numbers distributed
-     * according to a normal distribution.
-     * Internally, the output of random() is converted using the cumulative density
-     *
-     * \f$ \Phi(x) = \frac{1}{2} \left[
-     *     1 + \mathrm{erf}\left( \frac{x - \mu}{\sigma \sqrt{2}} \right)
-     * \right]\f$
-     *
-     * such that the output `r` from random() leads to
-     *
-     * \f$ x = \mu + \sigma \sqrt{2} \mathrm{erf}^{-1} (2r - 1) \f$
-     *
-     * @param ishape The shape of the nd-array drawn per generator.
-     * @param mu The average.
-     * @param sigma The standard deviation.
-     * @return The array of arrays of samples: [#shape, `ishape`]
+     * @copydoc prrng::pcg32_arrayBase::draw_list_uint32(uint32_t*, uint32_t, size_t)
      */
-    template <class S>
-    auto normal(const S& ishape, double mu = 0, double sigma = 1) ->
-        typename detail::composite_return_type<double, M, S>::type
+    void draw_list_uint32(uint32_t* data, uint32_t bound, size_t n)
     {
-        using R = typename detail::composite_return_type<double, M, S>::type;
-        return this->normal_impl<R>(ishape, mu, sigma);
+        PRRNG_PARALLEL_FOR(m_size * n)
+        for (size_type i = 0; i < m_size; ++i) {
+            Reference gen = this->get_reference(i);
+            for (size_t j = 0; j < n; ++j) {
+                data[i * n + j] = gen.next_uint32(bound);
+            }
+        }
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @copydoc prrng::pcg32_arrayBase::draw_list_bounded(T*, uint64_t, uint64_t, size_t)
      */
-    template <class R, class S>
-    R normal(const S& ishape, double mu = 0, double sigma = 1)
+    template <class T>
+    void draw_list_bounded(T* data, uint64_t offset, uint64_t bound, size_t n)
+    {
+        if (bound > std::numeric_limits<uint32_t>::max()) {
+            PRRNG_PARALLEL_FOR(m_size * n)
+            for (size_type i = 0; i < m_size; ++i) {
+                Reference gen = this->get_reference(i);
+                for (size_t j = 0; j < n; ++j) {
+                    data[i * n + j] = static_cast<T>(offset + gen.next_uint64(bound));
+                }
+            }
+            return;
+        }
+
+        uint32_t b = static_cast<uint32_t>(bound);
+        std::vector<uint32_t> raw(m_size * n);
+        this->draw_list(raw.data(), n, detail::uint32_to_uint32{});
+
+        PRRNG_PARALLEL_FOR(m_size * n)
+        for (size_type i = 0; i < m_size; ++i) {
+            const uint32_t* r = &raw[i * n];
+            size_t k = 0;
+            auto next = [&]() { return k < n ? r[k++] : this->next_item(i); };
+            for (size_t j = 0; j < n; ++j) {
+                data[i * n + j] = static_cast<T>(offset + detail::lemire_uint32(next(), b, next));
+            }
+        }
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase::draw_list(T*, size_t, const F&)
+     */
+    template <class T, class F>
+    void draw_list(T* data, size_t n, const F& convert)
     {
-        return this->normal_impl<R>(ishape, mu, sigma);
+        constexpr size_t L = PRRNG_PCG32_LANES;
+
+        PRRNG_PARALLEL_FOR(m_size * n)
+        for (size_type i = 0; i < m_size; i += L) {
+            size_t m = std::min(static_cast<size_t>(L), static_cast<size_t>(m_size - i));
+            detail::pcg32_lanes(&m_state[i], &m_inc[i], m, n, &data[i * n], convert);
+        }
     }
 
+private:
     /**
-     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
+     * @brief Allocate storage for an array of generators of a certain shape.
+     * @param initstate The shape of this argument determines the shape of the generator array.
      */
-    template <class I, std::size_t L>
-    auto normal(const I (&ishape)[L], double mu = 0, double sigma = 1) ->
-        typename detail::composite_return_type<double, M, std::array<size_t, L>>::type
+    template <class T>
+    void allocate(const T& initstate)
     {
-        using R = typename detail::composite_return_type<double, M, std::array<size_t, L>>::type;
-        return this->normal_impl<R>(detail::to_array(ishape), mu, sigma);
+        if constexpr (detail::is_std_array<Shape>::value) {
+            std::copy(initstate.shape().cbegin(), initstate.shape().cend(), m_shape.begin());
+            std::copy(initstate.strides().cbegin(), initstate.strides().cend(), m_strides.begin());
+        }
+        else {
+            m_shape.assign(initstate.shape().cbegin(), initstate.shape().cend());
+            m_strides.assign(initstate.strides().cbegin(), initstate.strides().cend());
+        }
+
+        m_size = initstate.size();
+        m_state.resize(m_size);
+        m_inc.resize(m_size);
+        m_initstate.resize(m_size);
+        m_initseq.resize(m_size);
+
+        if constexpr (is_index) {
+            m_index.assign(m_size, 0);
+            m_delta.assign(m_size, 0);
+        }
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::normal(const S&, double, double)
-     * @tparam R return type, e.g. `xt::xtensor<double, 1>`
+     * @brief Seed one item, see pcg32::seed().
+     * @param i Flat index.
+     * @param initstate State initiator.
+     * @param initseq Sequence initiator.
      */
-    template <class R, class I, std::size_t L>
-    R normal(const I (&ishape)[L], double mu = 0, double sigma = 1)
+    void seed_item(size_t i, uint64_t initstate, uint64_t initseq)
     {
-        return this->normal_impl<R>(detail::to_array(ishape), mu, sigma);
+        m_initstate[i] = initstate;
+        m_initseq[i] = initseq;
+        m_inc[i] = (initseq << 1u) | 1u;
+        m_state[i] = detail::pcg32_seed(initstate, initseq);
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers.
-     * @param n Number of steps.
-     * @return Cumulative sum.
+     * @brief Draw the next random number of one item.
+     * @param i Flat index.
+     * @return Random number.
+     */
+    uint32_t next_item(size_t i)
+    {
+        uint64_t oldstate = m_state[i];
+        m_state[i] = oldstate * PRRNG_PCG32_MULT + m_inc[i];
+        return detail::pcg32_output(oldstate);
+    }
+
+    /**
+     * @brief Reference to one item.
+     * @param i Flat index.
+     * @return Reference.
+     */
+    Reference get_reference(size_t i)
+    {
+        if constexpr (is_index) {
+            return Reference(
+                &m_state[i], &m_inc[i], &m_initstate[i], &m_initseq[i], &m_index[i], &m_delta[i]
+            );
+        }
+        else {
+            return Reference(&m_state[i], &m_inc[i], &m_initstate[i], &m_initseq[i]);
+        }
+    }
+
+    /**
+     * @brief Read-only reference to one item.
+     * @param i Flat index.
+     * @return Reference.
+     */
+    const_reference get_reference(size_t i) const
+    {
+        if constexpr (is_index) {
+            return const_reference(
+                &m_state[i], &m_inc[i], &m_initstate[i], &m_initseq[i], &m_index[i], &m_delta[i]
+            );
+        }
+        else {
+            return const_reference(&m_state[i], &m_inc[i], &m_initstate[i], &m_initseq[i]);
+        }
+    }
+
+    /**
+     * implementation of `operator()`.
+     * (Last call in recursion).
      */
     template <class T>
-    auto cumsum_random(const T& n) -> typename detail::return_type<double, M>::type
+    size_t get_item(size_t sum, size_t d, T arg) const
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_random_impl(ret.data(), n.data());
-        return ret;
+        return sum + arg * m_strides[d];
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers.
-     * @param n Number of steps.
-     * @return Cumulative sum.
+     * implementation of `operator()`.
+     * (Called recursively).
      */
-    template <class R, class T>
-    R cumsum_random(const T& n)
+    template <class T, class... Args>
+    size_t get_item(size_t sum, size_t d, T arg, Args... args) const
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_random_impl(ret.data(), n.data());
-        return ret;
+        return get_item(sum + arg * m_strides[d], d + 1, args...);
     }
 
+protected:
+    std::vector<uint64_t> m_state; ///< State of each item (hot).
+    std::vector<uint64_t> m_inc; ///< Increment of each item (hot).
+    std::vector<uint64_t> m_initstate; ///< State initiator of each item (cold).
+    std::vector<uint64_t> m_initseq; ///< Sequence initiator of each item (cold).
+    std::vector<ptrdiff_t> m_index; ///< Index of each item (prrng::pcg32_index_reference() only).
+    std::vector<uint8_t> m_delta; ///< Delta signal of each item (pcg32_index_reference() only).
+    using GeneratorBase_array<derived_type, Shape>::m_size;
+    using GeneratorBase_array<derived_type, Shape>::m_shape;
+    using GeneratorBase_array<derived_type, Shape>::m_strides;
+};
+
+/**
+ * Array of independent generators, like prrng::pcg32_array(),
+ * with a structure-of-arrays storage: the states and increments of all generators
+ * (the fields needed to draw) are stored contiguously, separate from the initiators.
+ * Bulk operations (drawing, advancing, deciding) therefore stream through less memory and
+ * can be vectorised.
+ *
+ * Note that a reference to each generator can be obtained using the `[]` and `()` operators,
+ * e.g. `generators[flat_index]` and `generators(i, j, k, ...)`.
+ * This returns a lightweight prrng::pcg32_reference() (by value) that provides all functions
+ * of pcg32().
+ * For a constant array it returns a prrng::pcg32_const_reference() that cannot modify the item.
+ */
+class pcg32_soa_array : public pcg32_soa_arrayBase<pcg32_reference, std::vector<size_t>> {
+public:
+    pcg32_soa_array() = default;
+
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a delta distribution,
-     * @param n Number of steps.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * Constructor.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
      */
     template <class T>
-    auto cumsum_delta(const T& n, double scale = 1) -> typename detail::return_type<double, M>::type
+    pcg32_soa_array(const T& initstate)
+    {
+        this->init(initstate);
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_soa_array(const T& initstate, const U& initseq)
+    {
+        this->init(initstate, initseq);
+    }
+};
+
+/**
+ * Fixed rank version of pcg32_soa_array
+ */
+template <size_t N>
+class pcg32_soa_tensor : public pcg32_soa_arrayBase<pcg32_reference, std::array<size_t, N>> {
+public:
+    pcg32_soa_tensor() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item (accept default sequence initiator).
+     * The shape of the argument determines the shape of the generator array.
+     */
+    template <class T>
+    pcg32_soa_tensor(const T& initstate)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate);
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_soa_tensor(const T& initstate, const U& initseq)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate, initseq);
+    }
+};
+
+/**
+ * @brief Array of prrng::pcg32_index(), with structure-of-arrays storage
+ * (see prrng::pcg32_soa_array()).
+ * It can be used as generator array of prrng::pcg32_arrayBase_chunk() and
+ * prrng::pcg32_arrayBase_cumsum().
+ */
+class pcg32_index_soa_array
+    : public pcg32_soa_arrayBase<pcg32_index_reference, std::vector<size_t>> {
+public:
+    pcg32_index_soa_array() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_index_soa_array(const T& initstate, const U& initseq)
+    {
+        this->init(initstate, initseq);
+    }
+};
+
+/**
+ * Fixed rank version of pcg32_index_soa_array
+ */
+template <size_t N>
+class pcg32_index_soa_tensor
+    : public pcg32_soa_arrayBase<pcg32_index_reference, std::array<size_t, N>> {
+public:
+    pcg32_index_soa_tensor() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * The shape of these argument determines the shape of the generator array.
+     */
+    template <class T, class U>
+    pcg32_index_soa_tensor(const T& initstate, const U& initseq)
+    {
+        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
+        this->init(initstate, initseq);
+    }
+};
+
+namespace detail {
+
+template <class T, typename = void>
+struct auto_pcg32 {
+    static auto get(const T& initseq)
+    {
+        return pcg32_array(initseq);
+    }
+
+    template <class S>
+    static auto get(const T& initseq, const S& initstate)
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        for (size_t i = 0; i < ret.size(); ++i) {
-            ret.flat(i) = static_cast<double>(n.flat(i)) * scale;
-        }
-        return ret;
+        return pcg32_array(initseq, initstate);
     }
+};
 
-    /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a delta distribution,
-     * @param n Number of steps.
-     * @param scale Scale.
-     * @return Cumulative sum.
-     */
-    template <class R, class T>
-    R cumsum_delta(const T& n, double scale = 1)
+template <class T>
+struct auto_pcg32<T, typename std::enable_if_t<xt::has_fixed_rank_t<T>::value>> {
+    static auto get(const T& initseq)
     {
-        R ret = R::from_shape(m_shape);
-        for (size_t i = 0; i < ret.size(); ++i) {
-            ret.flat(i) = static_cast<double>(n.flat(i)) * scale;
-        }
-        return ret;
+        return pcg32_tensor<xt::get_rank<T>::value>(initseq);
     }
 
-    /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to an exponential distribution, see exponential_distribution(),
-     * @param n Number of steps.
-     * @param scale Scale.
-     * @return Cumulative sum.
-     */
-    template <class T>
-    auto cumsum_exponential(const T& n, double scale = 1) ->
-        typename detail::return_type<double, M>::type
+    template <class S>
+    static auto get(const T& initseq, const S& initstate)
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_exponential_impl(ret.data(), n.data(), scale);
-        return ret;
+        return pcg32_tensor<xt::get_rank<T>::value>(initseq, initstate);
     }
+};
 
-    /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to an exponential distribution, see exponential_distribution(),
-     * @param n Number of steps.
-     * @param scale Scale.
-     * @return Cumulative sum.
-     */
-    template <class R, class T>
-    R cumsum_exponential(const T& n, double scale = 1)
+template <class T>
+struct auto_pcg32<T, typename std::enable_if_t<std::is_integral<T>::value>> {
+    static auto get(const T& initseq)
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_exponential_impl(ret.data(), n.data(), scale);
-        return ret;
+        return pcg32(initseq);
     }
 
-    /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to an power distribution, see power_distribution(),
-     * @param n Number of steps.
-     * @param k Scale.
-     * @return Cumulative sum.
-     */
-    template <class T>
-    auto cumsum_power(const T& n, double k = 1) -> typename detail::return_type<double, M>::type
+    template <class S>
+    static auto get(const T& initseq, const S& initstate)
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_power_impl(ret.data(), n.data(), k);
-        return ret;
+        return pcg32(initseq, initstate);
     }
+};
+
+} // namespace detail
+
+/**
+ * Return a pcg32, a pcg32_array, or a pcg32_tensor based on input.
+ *
+ * @param initstate The sequence initiator.
+ * @return The allocated generator.
+ */
+template <class T>
+inline auto auto_pcg32(const T& initstate)
+{
+    return detail::auto_pcg32<T>::get(initstate);
+}
+
+/**
+ * Return a pcg32, a pcg32_array, or a pcg32_tensor based on input.
+ *
+ * @param initstate The sequence initiator.
+ * @param initseq The sequence initiator.
+ * @return The allocated generator.
+ */
+template <class T, class S>
+inline auto auto_pcg32(const T& initstate, const S& initseq)
+{
+    return detail::auto_pcg32<T>::get(initstate, initseq);
+}
+
+/**
+ * @brief Array of generators of which a chunk of random numbers is kept in memory.
+ *
+ * @tparam Generator Storage of the generator array, e.g. prrng::pcg32_tensor<N>.
+ * @tparam Data
+ *      Storage of the data, e.g. xt::xtensor<double, N + n>.
+ *      With value_type `float` the random numbers are drawn in double precision,
+ *      and are then stored (and summed, for the cumsum) in single precision.
+ * @tparam Index Storage of the index, e.g. xt::xtensor<ptrdiff_t, N>.
+ * @tparam is_cumsum Keep a chunk of the cumulative sum (`true`) or of the random numbers.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <
+    class Generator,
+    class Data,
+    class Index,
+    bool is_cumsum,
+    enum distribution Distribution = distribution::custom>
+class pcg32_arrayBase_chunkBase {
+    static_assert(std::is_signed<typename Index::value_type>::value, "Index must be signed");
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to an power distribution, see power_distribution(),
-     * @param n Number of steps.
-     * @param k Scale.
-     * @return Cumulative sum.
+     * Signal if the generators reuse their last jump, see detail::jump_to().
      */
-    template <class R, class T>
-    R cumsum_power(const T& n, double k = 1)
-    {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_power_impl(ret.data(), n.data(), k);
-        return ret;
-    }
+    static constexpr bool has_stride =
+        detail::has_stride<std::decay_t<decltype(std::declval<Generator&>()[0])>>::value;
+
+public:
+    using size_type = typename Data::size_type; ///< Size type of the data container.
+    using value_type = typename Data::value_type; ///< Value type of the data container.
+
+protected:
+    mutable Generator m_gen; ///< Array of generators (advanced by draw_deferred()).
+    mutable Data m_data; ///< Data container (materialised lazily if `alignment::slack > 0`).
+    mutable std::vector<value_type> m_buffer; ///< Storage of the chunks if `alignment::slack > 0`.
+    std::vector<ptrdiff_t> m_offset; ///< Start of each chunk in its part of #m_buffer.
+    size_t m_capacity; ///< Size of the storage of each chunk in #m_buffer.
+    mutable bool m_synced; ///< Signal if #m_data is up-to-date with #m_buffer.
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a gamma distribution, see gamma_distribution(),
-     * @param n Number of steps.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return Cumulative sum.
+     * @brief Signal if the drawing functions are specified, implying that the chunk can be changed.
      */
-    template <class T>
-    auto cumsum_gamma(const T& n, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, M>::type
+    bool m_extendible;
+
+    alignment m_align; ///< alignment settings, see prrng::alignment().
+    distribution m_distro; ///< Distribution name, see prrng::distribution().
+    std::array<double, 3> m_param; ///< Distribution parameters.
+    Index m_start; ///< Start index of the chunk.
+    Index m_i; ///< Last known index of `target` in align.
+    size_t m_n; ///< Size of the chunk.
+    mutable std::vector<chunk_statistics> m_stats; ///< Per generator (if statistics enabled).
+    std::vector<pcg32_stride> m_jump; ///< Per generator: last jump, see detail::jump_to().
+    adaptation m_adapt; ///< Adaptation settings, see set_adaptation().
+    double m_velocity = 0.0; ///< Average displacement of the targets, see velocity().
+    std::vector<ptrdiff_t> m_last; ///< Global index of each target at the last alignment.
+    mutable std::vector<char> m_pending; ///< Per generator: first chunk deferred (alignment::lazy).
+
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param shape Shape of the chunk to keep in memory per generator.
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * @copydoc default_parameters
+     * @param align Alignment parameters, see prrng::alignment().
+     */
+    template <class S, class T, class U>
+    void init(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+        PRRNG_ASSERT(Distribution == distribution::custom || distribution == Distribution);
+
+        m_align = align;
+        m_distro = distribution;
+        m_gen = Generator(initstate, initseq);
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_delta(distribution == distribution::delta);
+        }
+
+        std::vector<size_t> data_shape;
+        data_shape.resize(initstate.dimension() + shape.size());
+        std::copy(initstate.shape().begin(), initstate.shape().end(), data_shape.begin());
+        std::copy(shape.begin(), shape.end(), data_shape.begin() + initstate.dimension());
+        m_data = xt::empty<typename Data::value_type>(data_shape);
+        m_n = detail::size(shape);
+
+        m_start = xt::zeros<typename Index::value_type>(m_gen.shape());
+        m_i = m_n * xt::ones<typename Index::value_type>(m_gen.shape());
+
+        auto par = default_parameters(distribution, parameters);
+        std::copy(par.begin(), par.end(), m_param.begin());
+
+        this->auto_functions();
+        this->init_buffer();
+        m_pending.clear();
+
+        // if possible: draw the first chunk (or defer it to its first use)
+        if (m_extendible && m_align.lazy) {
+            m_pending.assign(m_gen.size(), 1);
+        }
+        else if (m_extendible) {
+            // the chunks are drawn in their storage: #m_data is synchronised on first read
+            this->touch();
+
+            PRRNG_PARALLEL_FOR(m_data.size())
+            for (size_t i = 0; i < m_gen.size(); ++i) {
+                this->draw_first(i);
+            }
+        }
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a gamma distribution, see gamma_distribution(),
-     * @param n Number of steps.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return Cumulative sum.
+     * @brief Draw the first chunk of one generator starting from its seed.
+     * Call touch() first.
+     * This is logically const: the chunk is the one that the constructor would have drawn
+     * (the generators and the storage of the chunks are mutable).
+     *
+     * @param i Flat index of the generator.
      */
-    template <class R, class T>
-    R cumsum_gamma(const T& n, double k = 1, double scale = 1)
+    void draw_first(size_t i) const
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_gamma_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        value_type* data = &m_data.flat(i * m_n);
+
+        if (!m_buffer.empty()) {
+            data = &m_buffer[i * m_capacity] + m_offset[i];
+        }
+
+        this->draw_chunk(i, data, m_n);
+        m_gen[i].drawn(m_n);
+        if constexpr (is_cumsum) {
+            std::partial_sum(data, data + m_n, data);
+        }
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a pareto distribution, see pareto_distribution(),
-     * @param n Number of steps.
-     * @param k Shape.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @brief Draw the first chunk of one generator if it was deferred, see alignment::lazy.
+     * Call touch() first.
+     *
+     * @param i Flat index of the generator.
      */
-    template <class T>
-    auto cumsum_pareto(const T& n, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, M>::type
+    void draw_deferred(size_t i) const
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_pareto_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        if (!m_pending.empty() && m_pending[i]) {
+            this->draw_first(i);
+            m_pending[i] = 0;
+        }
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a pareto distribution, see pareto_distribution(),
-     * @param n Number of steps.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return Cumulative sum.
+     * @brief Draw the first chunk of all generators for which it was deferred,
+     * see alignment::lazy.
+     * This is logically const: the chunks are those that the constructor would have drawn.
+     *
+     * @warning
+     *      As a consequence, const access (e.g. `data()` or `generators()`) of a lazy array
+     *      (or of one with slack, whose storage is synchronised on read) is not thread-safe:
+     *      do not share a single object between threads without drawing its chunks first
+     *      (e.g. by one call to `data()`).
      */
-    template <class R, class T>
-    R cumsum_pareto(const T& n, double k = 1, double scale = 1)
+    void draw_deferred() const
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_pareto_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        if (m_pending.empty()) {
+            return;
+        }
+
+        this->touch();
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            this->draw_deferred(i);
+        }
+
+        m_pending.clear();
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a weibull distribution, see weibull_distribution(),
-     * @param n Number of steps.
-     * @param k Shape.
-     * @param scale Scale.
-     * @return Cumulative sum.
+     * @brief Set draw function.
+     * The built-in distributions are drawn directly in the chunk, see draw_chunk().
      */
-    template <class T>
-    auto cumsum_weibull(const T& n, double k = 1, double scale = 1) ->
-        typename detail::return_type<double, M>::type
+    void auto_functions()
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_weibull_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        m_extendible = m_distro != custom;
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a weibull distribution, see weibull_distribution(),
-     * @param n Number of steps.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
-     * @return Cumulative sum.
+     * @brief Draw the next `n` random numbers of one generator starting from its current state.
+     * This does not allocate.
+     *
+     * @param i Flat index of the generator.
+     * @param data Pointer to the output (modified).
+     * @param n Number of random numbers.
      */
-    template <class R, class T>
-    R cumsum_weibull(const T& n, double k = 1, double scale = 1)
+    void draw_chunk(size_t i, value_type* data, size_t n) const
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_weibull_impl(ret.data(), n.data(), k, scale);
-        return ret;
+        PRRNG_STATISTICS(this->stats(i), drawn += n);
+
+        if constexpr (Distribution != distribution::custom) {
+            detail::draw_chunk<Distribution>(m_gen[i], m_param, data, n);
+        }
+        else {
+            detail::draw_chunk(m_gen[i], m_distro, m_param, data, n);
+        }
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a normal distribution, see normal_distribution(),
-     * @param n Number of steps.
-     * @param mu Mean.
-     * @param sigma Standard deviation.
+     * @brief Get the cumsum of the next `n` random numbers of one generator starting from its
+     * current state.
+     *
+     * @param i Flat index of the generator.
+     * @param n Number of random numbers.
      * @return Cumulative sum.
      */
-    template <class T>
-    auto cumsum_normal(const T& n, double mu = 0, double sigma = 1) ->
-        typename detail::return_type<double, M>::type
+    double draw_sum(size_t i, size_t n)
     {
-        using R = typename detail::return_type<double, M>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma);
-        return ret;
+        PRRNG_STATISTICS(this->stats(i), summed += n);
+        bool exact = !m_align.sample_skip;
+
+        if constexpr (Distribution != distribution::custom) {
+            return detail::draw_cumsum<Distribution>(m_gen[i], m_param, n, exact);
+        }
+        else {
+            return detail::draw_cumsum(m_gen[i], m_distro, m_param, n, exact);
+        }
     }
 
     /**
-     * @brief Per generator, return the result of the cumulative sum of `n` random numbers,
-     * distributed according to a normal distribution, see normal_distribution(),
-     * @param n Number of steps.
-     * @param mu Mean.
-     * @param sigma Standard deviation.
-     * @return Cumulative sum.
+     * @brief Allocate storage with slack if `alignment::slack > 0`, see detail::chunk_buffer.
      */
-    template <class R, class T>
-    R cumsum_normal(const T& n, double mu = 0, double sigma = 1)
+    void init_buffer()
     {
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->cumsum_normal_impl(ret.data(), n.data(), mu, sigma);
-        return ret;
+        m_offset.assign(m_gen.size(), 0);
+        m_capacity = m_n;
+        m_synced = true;
+        m_buffer.clear();
+
+        if (m_extendible && m_align.slack > 0) {
+            m_capacity = m_n + static_cast<size_t>(m_align.slack);
+            m_buffer.resize(m_gen.size() * m_capacity);
+        }
+
+        if constexpr (has_stride) {
+            m_jump.resize(m_gen.size());
+        }
+
+#ifdef PRRNG_ENABLE_STATISTICS
+        if (m_stats.size() != m_gen.size()) {
+            m_stats.assign(m_gen.size(), chunk_statistics());
+        }
+#endif
     }
 
     /**
-     * @brief Decide based on probability per generator.
-     * This is fully equivalent to `generators.random({}) <= p`, but avoids the
-     * memory allocation of `random``.
+     * @brief Statistics of the chunk of one generator (to be updated).
      *
-     * @param p Probability per generator [0, 1).
-     * @return Decision for each `p`.
+     * @param i Flat index of the generator.
+     * @return Pointer, `nullptr` if the statistics are not collected.
      */
-    template <class P>
-    auto decide(const P& p) -> typename detail::return_type<bool, P>::type
+    chunk_statistics* stats(size_t i) const
     {
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        using R = typename detail::return_type<bool, P>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->decide_impl(p.data(), ret.data());
-        return ret;
+        return m_stats.empty() ? nullptr : &m_stats[i];
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::decide(const P& p)
+     * @brief Last jump of the generator of one chunk, see detail::jump_to().
+     *
+     * @param i Flat index of the generator.
+     * @return Pointer, `nullptr` if the generator does not reuse jumps.
      */
-    template <class P, class R>
-    R decide(const P& p)
+    pcg32_stride* jump(size_t i)
     {
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->decide_impl(p.data(), ret.data());
-        return ret;
+        return m_jump.empty() ? nullptr : &m_jump[i];
     }
 
     /**
-     * @brief Decide based on probability per generator.
-     * This is fully equivalent to `generators.random({}) <= p`, but avoids the
-     * memory allocation of `random``.
+     * @brief The chunk of one generator in its storage.
+     * Call touch() before modifying the chunk.
      *
-     * @param p Probability per generator [0, 1).
-     * @param ret Decision for each ``p``.
+     * @param i Flat index of the generator.
+     * @return detail::chunk_buffer
      */
-    template <class P, class R>
-    void decide(const P& p, R& ret)
+    detail::chunk_buffer<value_type> chunk(size_t i)
     {
-        static_assert(
-            std::is_same<typename R::value_type, bool>::value, "Return value_type must be bool"
-        );
+        ptrdiff_t n = static_cast<ptrdiff_t>(m_n);
 
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
-        static_cast<Derived*>(this)->decide_impl(p.data(), ret.data());
+        if (m_buffer.empty()) {
+            return detail::chunk_buffer<value_type>(
+                &m_data.flat(i * m_n), n, &m_offset[i], n, this->stats(i), this->jump(i)
+            );
+        }
+
+        ptrdiff_t capacity = static_cast<ptrdiff_t>(m_capacity);
+        return detail::chunk_buffer<value_type>(
+            &m_buffer[i * m_capacity], capacity, &m_offset[i], n, this->stats(i), this->jump(i)
+        );
     }
 
     /**
-     * @brief Decide based on probability per generator.
-     * This is fully equivalent to `generators.random({}) <= p`,
-     * but avoids the memory allocation of `random`.
+     * @brief Pointer to the first entry of the chunk of one generator in its storage.
      *
-     * @param p Probability per generator [0, 1).
-     * @param mask Where `true` the decision is `false` (no random number is drawn there).
-     * @return Decision for each `p`.
+     * @param i Flat index of the generator.
+     * @return Pointer.
      */
-    template <class P, class T>
-    auto decide_masked(const P& p, const T& mask) -> typename detail::return_type<bool, P>::type
+    const value_type* chunk_data(size_t i) const
     {
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
-        using R = typename detail::return_type<bool, P>::type;
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->decide_masked_impl(p.data(), mask.data(), ret.data());
-        return ret;
+        if (m_buffer.empty()) {
+            return &m_data.flat(i * m_n);
+        }
+
+        return &m_buffer[i * m_capacity] + m_offset[i];
     }
 
     /**
-     * @copydoc prrng::GeneratorBase_array::decide_masked(const P&, const T&)
+     * @brief Signal that the chunks are about to be modified in their storage.
      */
-    template <class P, class T, class R>
-    R decide_masked(const P& p, const T& mask)
+    void touch() const
     {
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
-        R ret = R::from_shape(m_shape);
-        static_cast<Derived*>(this)->decide_masked_impl(p.data(), mask.data(), ret.data());
-        return ret;
+        m_synced = m_buffer.empty();
     }
 
     /**
-     * @brief Decide based on probability per generator.
-     * This is fully equivalent to `generators.random({}) <= p`,
-     * but avoids the memory allocation of `random`.
-     *
-     * @param p Probability per generator [0, 1).
-     * @param mask Where `true` the decision is `false` (no random number is drawn there).
-     * @param ret Decision for each ``p``.
+     * @brief Copy the chunks from their storage to #m_data (if needed).
      */
-    template <class P, class T, class R>
-    void decide_masked(const P& p, const T& mask, R& ret)
+    void pull() const
     {
-        static_assert(
-            std::is_same<typename R::value_type, bool>::value, "Return value_type must be bool"
-        );
+        if (m_synced) {
+            return;
+        }
 
-        PRRNG_ASSERT(xt::has_shape(p, m_shape));
-        PRRNG_ASSERT(xt::has_shape(p, mask.shape()));
-        PRRNG_ASSERT(xt::has_shape(p, ret.shape()));
-        static_cast<Derived*>(this)->decide_masked_impl(p.data(), mask.data(), ret.data());
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            std::copy(this->chunk_data(i), this->chunk_data(i) + m_n, &m_data.flat(i * m_n));
+        }
+
+        m_synced = true;
     }
 
-private:
-    template <class R, class S>
-    R positive_random_impl(const S& ishape)
+    /**
+     * @brief Copy #m_data to the storage of the chunks (if needed).
+     */
+    void push()
     {
-        static_assert(
-            std::is_same<typename R::value_type, double>::value, "Return value_type must be double"
-        );
+        if (m_buffer.empty()) {
+            return;
+        }
 
-        auto n = detail::size(ishape);
-        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
-        static_cast<Derived*>(this)->draw_list_positive_double(&ret.front(), n);
-        return ret;
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            std::copy(&m_data.flat(i * m_n), &m_data.flat(i * m_n) + m_n, this->chunk(i).data());
+        }
     }
 
-    template <class R, class S>
-    R random_impl(const S& ishape)
+    /**
+     * @brief Copy constructor.
+     * This function resets all internal pointers.
+     *
+     * @param other Object to copy.
+     */
+    void copy_from(const pcg32_arrayBase_chunkBase& other)
     {
-        static_assert(
-            std::is_same<typename R::value_type, double>::value, "Return value_type must be double"
-        );
-
-        auto n = detail::size(ishape);
-        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
-        static_cast<Derived*>(this)->draw_list_double(&ret.front(), n);
-        return ret;
+        m_gen = other.m_gen;
+        m_data = other.m_data;
+        m_buffer = other.m_buffer;
+        m_offset = other.m_offset;
+        m_capacity = other.m_capacity;
+        m_synced = other.m_synced;
+        m_align = other.m_align;
+        m_distro = other.m_distro;
+        m_param = other.m_param;
+        m_start = other.m_start;
+        m_i = other.m_i;
+        m_n = other.m_n;
+        m_stats = other.m_stats;
+        m_jump = other.m_jump;
+        m_adapt = other.m_adapt;
+        m_velocity = other.m_velocity;
+        m_last = other.m_last;
+        m_pending = other.m_pending;
+        this->auto_functions();
     }
 
-    template <class R, class S, typename T>
-    R randint_impl(const S& ishape, T high)
+    /**
+     * @brief Record the average displacement of the targets and resize all chunks if needed,
+     * see prrng::adaptation.
+     * @return `true` if the chunks were resized.
+     */
+    bool adapt()
     {
-        static_assert(
-            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<T>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        if (m_gen.size() == 0) {
+            return false;
+        }
 
-        static_assert(
-            std::numeric_limits<T>::max() <= std::numeric_limits<uint32_t>::max(), "Bound too large"
-        );
+        if (m_last.size() != m_gen.size()) {
+            m_last.resize(m_gen.size());
+            for (size_t i = 0; i < m_gen.size(); ++i) {
+                m_last[i] = m_start.flat(i) + m_i.flat(i);
+            }
+            return false;
+        }
 
-        auto n = detail::size(ishape);
-        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
-        std::vector<uint32_t> tmp(ret.size());
-        static_cast<Derived*>(this)->draw_list_uint32(&tmp.front(), static_cast<uint32_t>(high), n);
-        std::copy(tmp.begin(), tmp.end(), ret.begin());
-        return ret;
-    }
+        double displacement = 0.0;
 
-    template <class R, class S, typename T, typename U>
-    R randint_impl(const S& ishape, T low, U high)
-    {
-        static_assert(
-            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<T>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            ptrdiff_t index = m_start.flat(i) + m_i.flat(i);
+            displacement += std::abs(static_cast<double>(index - m_last[i]));
+            m_last[i] = index;
+        }
 
-        static_assert(
-            std::numeric_limits<typename R::value_type>::min() >= std::numeric_limits<T>::min(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        displacement /= static_cast<double>(m_gen.size());
+        size_t n = detail::adapt_chunk(m_adapt, displacement, &m_velocity, m_n, &m_align);
 
-        static_assert(
-            std::numeric_limits<typename R::value_type>::max() >= std::numeric_limits<U>::max(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        if (n == m_n) {
+            return false;
+        }
 
-        static_assert(
-            std::numeric_limits<typename R::value_type>::min() >= std::numeric_limits<U>::min(),
-            "Return value_type must must be able to accommodate the bound"
-        );
+        this->resize(n);
+        return true;
+    }
 
-        static_assert(
-            static_cast<uint32_t>(std::numeric_limits<T>::max()) <
-                std::numeric_limits<uint32_t>::max(),
-            "Bound too large"
-        );
+public:
+    pcg32_arrayBase_chunkBase() = default;
 
-        auto n = detail::size(ishape);
-        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
-        std::vector<uint32_t> tmp(ret.size());
-        static_cast<Derived*>(this)->draw_list_uint32(
-            &tmp.front(), static_cast<uint32_t>(high - low), n
-        );
-        std::copy(tmp.begin(), tmp.end(), ret.begin());
-        return ret + low;
+    /**
+     * @copydoc prrng::pcg32_arrayBase_chunkBase::copy_from(const prrng::pcg32_arrayBase_chunkBase&)
+     */
+    pcg32_arrayBase_chunkBase(const pcg32_arrayBase_chunkBase& other)
+    {
+        this->copy_from(other);
     }
 
-    template <class R, class S>
-    R delta_impl(const S& ishape, double scale)
+    /**
+     * @copydoc prrng::pcg32_arrayBase_chunkBase::copy_from(const prrng::pcg32_arrayBase_chunkBase&)
+     */
+    void operator=(const pcg32_arrayBase_chunkBase& other)
     {
-        R ret = R::from_shape(detail::concatenate<M, S>::two(m_shape, ishape));
-        ret.fill(scale);
-        return ret;
+        this->copy_from(other);
     }
 
-    template <class R, class S>
-    R exponential_impl(const S& ishape, double scale)
+    /**
+     * @brief Add values to each chunk.
+     * @param values Values to add.
+     */
+    template <class T>
+    pcg32_arrayBase_chunkBase& operator+=(const T& values)
     {
-        R r = this->random_impl<R>(ishape);
-        return exponential_distribution(scale).quantile(r);
+        this->draw_deferred();
+        this->pull();
+        xt::noalias(m_data) += values;
+        this->push();
+        return *this;
     }
 
-    template <class R, class S>
-    R power_impl(const S& ishape, double k)
+    /**
+     * @brief Subtract values from each chunk.
+     * @param values Values to subtract.
+     */
+    template <class T>
+    pcg32_arrayBase_chunkBase& operator-=(const T& values)
     {
-        R r = this->random_impl<R>(ishape);
-        return power_distribution(k).quantile(r);
+        this->draw_deferred();
+        this->pull();
+        xt::noalias(m_data) -= values;
+        this->push();
+        return *this;
     }
 
-    template <class R, class S>
-    R gamma_impl(const S& ishape, double k, double scale)
+    /**
+     * @brief `true` if the chunk is extendible.
+     * @return bool
+     */
+    bool is_extendible() const
     {
-        R r = this->random_impl<R>(ishape);
-        return gamma_distribution(k, scale).quantile(r);
+        return m_extendible;
     }
 
-    template <class R, class S>
-    R pareto_impl(const S& ishape, double k, double scale)
+    /**
+     * @brief Size of the chunk per generator.
+     * @return Unsigned integer.
+     */
+    size_type chunk_size() const
     {
-        R r = this->random_impl<R>(ishape);
-        return pareto_distribution(k, scale).quantile(r);
+        return static_cast<size_type>(m_n);
     }
 
-    template <class R, class S>
-    R weibull_impl(const S& ishape, double k, double scale)
+    /**
+     * @brief Reference to the underlying generators.
+     * @return Reference to generator array.
+     */
+    const Generator& generators() const
     {
-        R r = this->random_impl<R>(ishape);
-        return weibull_distribution(k, scale).quantile(r);
+        this->draw_deferred();
+        return m_gen;
     }
 
-    template <class R, class S>
-    R normal_impl(const S& ishape, double mu, double sigma)
+    /**
+     * @copydoc prrng::pcg32_cumsum::data()
+     */
+    const Data& data() const
     {
-        R r = this->positive_random_impl<R>(ishape);
-        return normal_distribution(mu, sigma).quantile(r);
+        this->draw_deferred();
+        this->pull();
+        return m_data;
     }
 
-protected:
-    size_type m_size = 0; ///< See size().
-    shape_type m_shape; ///< See shape().
-    shape_type m_strides; ///< The strides of the array of generators.
-};
-
-/**
- * Base class, see pcg32_array for description.
- */
-template <class Generator, class Shape>
-class pcg32_arrayBase : public GeneratorBase_array<pcg32_arrayBase<Generator, Shape>, Shape> {
-    friend GeneratorBase_array<pcg32_arrayBase<Generator, Shape>, Shape>;
-
-private:
-    using derived_type = pcg32_arrayBase<Generator, Shape>;
-
-public:
-    using size_type = typename Shape::value_type; ///< Size type
-    using shape_type = Shape; ///< Shape type
-
-protected:
     /**
-     * @brief Constructor alias.
-     *
-     * @param initstate State initiator for every item (accept default sequence initiator).
-     * The shape of the argument determines the shape of the generator array.
+     * @copydoc prrng::pcg32_cumsum::set_data(const Data&)
      */
-    template <class T>
-    void init(const T& initstate)
+    void set_data(const Data& data)
     {
-        std::copy(initstate.shape().cbegin(), initstate.shape().cend(), m_shape.begin());
-        std::copy(initstate.strides().cbegin(), initstate.strides().cend(), m_strides.begin());
-        m_size = initstate.size();
-        m_gen.reserve(m_size);
-
-        for (size_type i = 0; i < m_size; ++i) {
-            m_gen.push_back(Generator(initstate.flat(i)));
-        }
+        PRRNG_ASSERT(xt::has_shape(data, m_data.shape()));
+        this->draw_deferred();
+        xt::noalias(m_data) = data;
+        m_synced = true;
+        this->push();
     }
 
     /**
-     * @brief Constructor alias.
+     * @brief Change the size of the chunk of all generators, keeping their start
+     * (all chunks have the same size).
+     * Growing draws the entries directly after each chunk, shrinking drops the last entries:
+     * the values at all global indices are unchanged.
+     * Only for one-dimensional chunks (per generator).
      *
-     * @param initstate State initiator for every item (accept default sequence initiator).
-     * @param initseq Sequence initiator for every item.
-     * The shape of the argument determines the shape of the generator array.
+     * @param n New size of the chunk per generator.
      */
-    template <class T, class U>
-    void init(const T& initstate, const U& initseq)
+    void resize(size_t n)
     {
-        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+        PRRNG_ASSERT(m_data.dimension() == m_gen.shape().size() + 1);
+        PRRNG_ASSERT(n >= 2);
+        PRRNG_ASSERT(m_extendible || n <= m_n);
 
-        std::copy(initstate.shape().cbegin(), initstate.shape().cend(), m_shape.begin());
-        std::copy(initstate.strides().cbegin(), initstate.strides().cend(), m_strides.begin());
-        m_size = initstate.size();
-        m_gen.reserve(m_size);
+        size_t size = m_n;
 
-        for (size_type i = 0; i < m_size; ++i) {
-            m_gen.push_back(Generator(initstate.flat(i), initseq.flat(i)));
+        if (n == size) {
+            return;
         }
-    }
 
-public:
-    pcg32_arrayBase() = default;
+        this->draw_deferred();
+        this->pull();
+        Data data = m_data;
+        std::vector<size_t> shape(m_data.shape().cbegin(), m_data.shape().cend());
+        shape.back() = n;
+        m_data = xt::empty<value_type>(shape);
+        m_n = n;
+        ptrdiff_t nmax = static_cast<ptrdiff_t>(n);
 
-    /**
-     * Return a reference to one generator, using an array index.
-     *
-     * @param args Array index (number of arguments should correspond to the rank of the array).
-     * @return Reference to underlying generator.
-     */
-    template <class... Args>
-    Generator& operator()(Args... args)
-    {
-        return m_gen[this->get_item(0, 0, args...)];
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            const value_type* src = &data.flat(i * size);
+            value_type* dst = &m_data.flat(i * n);
+            std::copy(src, src + std::min(n, size), dst);
+
+            if (m_i.flat(i) > nmax) {
+                m_i.flat(i) = nmax;
+            }
+
+            if (n > size) {
+                m_gen[i].jump_to(m_start.flat(i) + static_cast<ptrdiff_t>(size));
+                this->draw_chunk(i, dst + size, n - size);
+                m_gen[i].drawn(n - size);
+                if constexpr (is_cumsum) {
+                    dst[size] += src[size - 1];
+                    std::partial_sum(dst + size, dst + n, dst + size);
+                }
+            }
+        }
+
+        this->init_buffer();
+        this->push();
     }
 
     /**
-     * Return a constant reference to one generator, using an array index.
-     *
-     * @param args Array index (number of arguments should correspond to the rank of the array).
-     * @return Reference to underlying generator.
+     * @copydoc prrng::pcg32_cumsum::alignment_settings()
      */
-    template <class... Args>
-    const Generator& operator()(Args... args) const
+    const alignment& alignment_settings() const
     {
-        return m_gen[this->get_item(0, 0, args...)];
+        return m_align;
     }
 
     /**
-     * Return a reference to one generator, using a flat index.
-     *
-     * @param i Flat index.
-     * @return Reference to underlying generator.
+     * @brief Statistics of the moves of all chunks (summed over generators) since construction
+     * or the last call of reset_statistics(). Only collected if #PRRNG_ENABLE_STATISTICS is
+     * defined.
+     * @return prrng::chunk_statistics
      */
-    Generator& operator[](size_t i)
+    chunk_statistics statistics() const
     {
-        PRRNG_DEBUG(i < m_size);
-        return m_gen[i];
+        chunk_statistics ret;
+        for (const auto& stats : m_stats) {
+            ret += stats;
+        }
+        return ret;
     }
 
     /**
-     * Return a constant reference to one generator, using a flat index.
-     *
-     * @param i Flat index.
-     * @return Reference to underlying generator.
+     * @brief Statistics of the moves of the chunk of one generator, see statistics().
+     * @param i Flat index of the generator.
+     * @return prrng::chunk_statistics
      */
-    const Generator& operator[](size_t i) const
+    chunk_statistics statistics(size_t i) const
     {
-        PRRNG_DEBUG(i < m_size);
-        return m_gen[i];
+        if (m_stats.empty()) {
+            return chunk_statistics();
+        }
+        return m_stats[i];
     }
 
     /**
-     * Return a reference to one generator, using a flat index.
-     *
-     * @param i Flat index.
-     * @return Reference to underlying generator.
+     * @copydoc prrng::pcg32_cumsum::reset_statistics()
      */
-    Generator& flat(size_t i)
+    void reset_statistics()
     {
-        PRRNG_DEBUG(i < m_size);
-        return m_gen[i];
+        std::fill(m_stats.begin(), m_stats.end(), chunk_statistics());
     }
 
     /**
-     * Return a constant reference to one generator, using a flat index.
-     *
-     * @param i Flat index.
-     * @return Reference to underlying generator.
+     * @copydoc prrng::pcg32_cumsum::start()
      */
-    const Generator& flat(size_t i) const
+    const Index& start() const
     {
-        PRRNG_DEBUG(i < m_size);
-        return m_gen[i];
+        return m_start;
     }
 
     /**
-     * Return the state of all generators.
-     * See pcg32::state().
-     *
-     * @return The state of each generator.
+     * @copydoc prrng::pcg32_cumsum::set_start(ptrdiff_t)
      */
-    auto state() -> typename detail::return_type<uint64_t, Shape>::type
+    void set_start(const Index& index)
     {
-        using R = typename detail::return_type<uint64_t, Shape>::type;
-        return this->state<R>();
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+        this->draw_deferred();
+        xt::noalias(m_start) = index;
     }
 
     /**
-     * @copydoc prrng::pcg32_arrayBase::state()
+     * @brief Serialize the generators and the chunks to a single binary blob,
+     * from which they can be restored using deserialize().
      *
-     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
-     * N>`
+     * The blob starts with prrng::pcg32_arrayBase::serialize() of the generators,
+     * followed by (in fields of 8 bytes):
+     *
+     *      flags, distribution, parameters[3], sizeof(value_type), rank, shape[rank],
+     *      start[size], chunk_index_at_align[size], (front[size]), (data[size * chunk_size])
+     *
+     * whereby `front` is the first entry of each chunk (only stored for a cumulative sum).
+     * Without the chunk data the blob is much smaller, but deserialize() has to redraw the
+     * chunks.
+     *
+     * @param with_data Include the chunk data.
+     * @return Binary blob.
      */
-    template <class R>
-    R state()
+    std::vector<char> serialize(bool with_data = true) const
     {
-        using value_type = typename R::value_type;
-        R ret = R::from_shape(m_shape);
+        this->draw_deferred();
+        std::vector<char> ret;
+        m_gen.serialize_to(ret);
 
-        for (size_type i = 0; i < m_size; ++i) {
-            ret.flat(i) = m_gen[i].template state<value_type>();
+        uint64_t flags = with_data ? detail::serial_data : uint64_t(0);
+        if constexpr (is_cumsum) {
+            flags |= detail::serial_cumsum;
+        }
+
+        detail::serial_writer out(ret);
+        out.put(flags);
+        out.put(static_cast<uint64_t>(m_distro));
+        out.put(m_param.data(), m_param.size());
+        out.put(static_cast<uint64_t>(sizeof(value_type)));
+        out.put(static_cast<uint64_t>(m_data.dimension()));
+
+        for (auto& n : m_data.shape()) {
+            out.put(static_cast<uint64_t>(n));
+        }
+
+        std::vector<int64_t> idx(m_gen.size());
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            idx[i] = static_cast<int64_t>(m_start.flat(i));
+        }
+        out.put(idx.data(), idx.size());
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            idx[i] = static_cast<int64_t>(m_i.flat(i));
+        }
+        out.put(idx.data(), idx.size());
+
+        if constexpr (is_cumsum) {
+            std::vector<value_type> front(m_gen.size());
+
+            for (size_t i = 0; i < m_gen.size(); ++i) {
+                front[i] = this->chunk_data(i)[0];
+            }
+            out.put(front.data(), front.size());
+        }
+
+        if (with_data) {
+            this->pull();
+            out.put(m_data.data(), m_data.size());
         }
 
         return ret;
     }
 
     /**
-     * Return the state initiator of all generators.
-     * See pcg32::initstate().
+     * @brief Restore the generators and the chunks from serialize().
+     * The object should have been constructed with the same shape and distribution.
+     * If the blob does not contain the chunk data, the chunks are redrawn.
      *
-     * @return The state initiator of each generator.
+     * @param buffer Pointer to the binary blob (e.g. a memory-mapped file).
+     * @param size Size of the binary blob (in bytes).
+     * @return Number of bytes read.
+     * @throw std::runtime_error if the blob is not compatible with this object
+     * (that is then not modified).
      */
-    auto initstate() -> typename detail::return_type<uint64_t, Shape>::type
+    size_t deserialize(const char* buffer, size_t size)
     {
-        using R = typename detail::return_type<uint64_t, Shape>::type;
-        return this->initstate<R>();
-    }
+        Generator gen;
+        size_t pos = gen.deserialize(buffer, size);
+        detail::serial_reader in(buffer + pos, size - pos);
 
-    /**
-     * @copydoc prrng::pcg32_arrayBase::initstate()
-     *
-     * @return The state initiator of each generator.
-     */
-    template <class R>
-    R initstate()
-    {
-        using value_type = typename R::value_type;
-        R ret = R::from_shape(m_shape);
+        uint64_t flags = in.get<uint64_t>();
+        bool has_data = (flags & detail::serial_data) != 0;
 
-        for (size_type i = 0; i < m_size; ++i) {
-            ret.flat(i) = m_gen[i].template initstate<value_type>();
+        if (((flags & detail::serial_cumsum) != 0) != is_cumsum) {
+            throw std::runtime_error("[prrng] Serialized data of a different chunk type");
+        }
+
+        std::array<double, 3> param;
+        uint64_t distro = in.get<uint64_t>();
+        in.get(param.data(), param.size());
+
+        if (distro != static_cast<uint64_t>(m_distro) || param != m_param) {
+            throw std::runtime_error("[prrng] Serialized data of a different distribution");
+        }
+
+        if (in.get<uint64_t>() != sizeof(value_type)) {
+            throw std::runtime_error("[prrng] Serialized data of a different precision");
+        }
+
+        bool compatible = in.get<uint64_t>() == m_data.dimension();
+
+        for (size_t d = 0; compatible && d < m_data.dimension(); ++d) {
+            compatible = in.get<uint64_t>() == m_data.shape(d);
+        }
+
+        if (!compatible || gen.size() != m_gen.size()) {
+            throw std::runtime_error("[prrng] Serialized data of a different shape");
+        }
+
+        if (!has_data && !m_extendible) {
+            throw std::runtime_error("[prrng] Serialized data without chunks cannot be redrawn");
+        }
+
+        std::vector<int64_t> start(m_gen.size());
+        std::vector<int64_t> index(m_gen.size());
+        std::vector<value_type> front;
+        in.get(start.data(), start.size());
+        in.get(index.data(), index.size());
+
+        if constexpr (is_cumsum) {
+            front.resize(m_gen.size());
+            in.get(front.data(), front.size());
+        }
+
+        if (has_data) {
+            in.get(m_data.data(), m_data.size());
+        }
+
+        m_gen = std::move(gen);
+        m_pending.clear();
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_delta(m_distro == distribution::delta);
+            m_start.flat(i) = static_cast<typename Index::value_type>(start[i]);
+            m_i.flat(i) = static_cast<typename Index::value_type>(index[i]);
+        }
+
+        this->init_buffer();
+
+        if (has_data) {
+            this->push();
+            return pos + in.pos;
+        }
+
+        this->touch();
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            uint64_t state = m_gen[i].state_at(m_start.flat(i));
+            m_gen[i].set_index(m_start.flat(i));
+            m_gen[i].restore(state);
+
+            value_type* chunk = this->chunk(i).data();
+            this->draw_chunk(i, chunk, m_n);
+            m_gen[i].drawn(m_n);
+
+            if constexpr (is_cumsum) {
+                chunk[0] = front[i];
+                std::partial_sum(chunk, chunk + m_n, chunk);
+            }
         }
 
-        return ret;
+        return pos + in.pos;
     }
 
     /**
-     * Return the sequence initiator of all generators.
-     * See pcg32::initseq().
+     * @brief Serialize one generator and its chunk to a compact binary blob,
+     * from which it can be restored using deserialize_row().
+     * This allows to checkpoint single generators, or to move them to another array
+     * (e.g. in a domain decomposition, see prrng::pcg32_array_partitioned_cumsum()),
+     * without redrawing the chunk.
      *
-     * @return The sequence initiator of each generator.
+     * The blob consists of fields of 8 bytes:
+     *
+     *      magic, version, flags, distribution, parameters[3], sizeof(value_type), chunk_size,
+     *      initstate, initseq, state, index, start, chunk_index_at_align, data[chunk_size]
+     *
+     * Its size is the same for all generators, see serialized_row_size().
+     *
+     * @param i Flat index of the generator.
+     * @return Binary blob.
      */
-    auto initseq() -> typename detail::return_type<uint64_t, Shape>::type
+    std::vector<char> serialize_row(size_t i) const
     {
-        using R = typename detail::return_type<uint64_t, Shape>::type;
-        return this->initseq<R>();
+        std::vector<char> ret;
+        this->serialize_row_to(i, ret);
+        return ret;
     }
 
     /**
-     * @copydoc prrng::pcg32_arrayBase::initseq()
-     *
-     * @tparam R The type of the return array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
-     * N>`
+     * @brief Append serialize_row() to a buffer.
+     * @param i Flat index of the generator.
+     * @param buffer Buffer (modified).
      */
-    template <class R>
-    R initseq()
+    void serialize_row_to(size_t i, std::vector<char>& buffer) const
     {
-        using value_type = typename R::value_type;
-        R ret = R::from_shape(m_shape);
+        PRRNG_ASSERT(i < m_gen.size());
 
-        for (size_type i = 0; i < m_size; ++i) {
-            ret.flat(i) = m_gen[i].template initseq<value_type>();
+        if (!m_pending.empty() && m_pending[i]) {
+            this->touch();
+            this->draw_deferred(i);
         }
 
-        return ret;
+        uint64_t flags = detail::serial_index | detail::serial_data;
+        if constexpr (is_cumsum) {
+            flags |= detail::serial_cumsum;
+        }
+
+        uint64_t state[3] = {m_gen[i].initstate(), m_gen[i].initseq(), m_gen[i].state()};
+        int64_t index[3] = {
+            static_cast<int64_t>(m_gen[i].index()),
+            static_cast<int64_t>(m_start.flat(i)),
+            static_cast<int64_t>(m_i.flat(i))
+        };
+
+        detail::serial_writer out(buffer);
+        out.put(detail::serial_magic);
+        out.put(detail::serial_version);
+        out.put(flags);
+        out.put(static_cast<uint64_t>(m_distro));
+        out.put(m_param.data(), m_param.size());
+        out.put(static_cast<uint64_t>(sizeof(value_type)));
+        out.put(static_cast<uint64_t>(m_n));
+        out.put(state, 3);
+        out.put(index, 3);
+        out.put(this->chunk_data(i), m_n);
     }
 
     /**
-     * Distance between two states.
-     * See pcg32::distance().
-     *
-     * @tparam T Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
-     * @param arg The state to which to compare.
+     * @brief Size of serialize_row() (in bytes).
+     * @return Unsigned integer.
      */
-    template <class T>
-    auto distance(const T& arg) -> typename detail::return_type<int64_t, Shape>::type
+    size_t serialized_row_size() const
     {
-        using R = typename detail::return_type<int64_t, Shape>::type;
-        return this->distance<R, T>(arg);
+        return 15 * 8 + ((m_n * sizeof(value_type) + 7) / 8) * 8;
     }
 
     /**
-     * Distance between two states.
-     * See pcg32::distance().
+     * @brief Restore one generator and its chunk from serialize_row(),
+     * e.g. of another array with the same distribution and chunk size.
      *
-     * @tparam R Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
-     * @tparam T Array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`.
-     * @param arg The state to which to compare.
+     * @param i Flat index of the generator to overwrite.
+     * @param buffer Pointer to the binary blob.
+     * @param size Size of the binary blob (in bytes).
+     * @return Number of bytes read.
+     * @throw std::runtime_error if the blob is not compatible with this object
+     * (that is then not modified).
      */
-    template <class R, class T>
-    R distance(const T& arg)
+    size_t deserialize_row(size_t i, const char* buffer, size_t size)
     {
-        using value_type = typename R::value_type;
-        R ret = R::from_shape(m_shape);
+        PRRNG_ASSERT(i < m_gen.size());
+        detail::serial_reader in(buffer, size);
 
-        for (size_type i = 0; i < m_size; ++i) {
-            ret.flat(i) = m_gen[i].template distance<value_type>(arg.flat(i));
+        if (in.get<uint64_t>() != detail::serial_magic) {
+            throw std::runtime_error("[prrng] Not serialized by prrng");
         }
 
-        return ret;
+        if (in.get<uint64_t>() != detail::serial_version) {
+            throw std::runtime_error("[prrng] Unsupported version of serialized data");
+        }
+
+        if (((in.get<uint64_t>() & detail::serial_cumsum) != 0) != is_cumsum) {
+            throw std::runtime_error("[prrng] Serialized data of a different chunk type");
+        }
+
+        std::array<double, 3> param;
+        uint64_t distro = in.get<uint64_t>();
+        in.get(param.data(), param.size());
+
+        if (distro != static_cast<uint64_t>(m_distro) || param != m_param) {
+            throw std::runtime_error("[prrng] Serialized data of a different distribution");
+        }
+
+        if (in.get<uint64_t>() != sizeof(value_type)) {
+            throw std::runtime_error("[prrng] Serialized data of a different precision");
+        }
+
+        if (in.get<uint64_t>() != m_n) {
+            throw std::runtime_error("[prrng] Serialized data of a different shape");
+        }
+
+        uint64_t state[3];
+        int64_t index[3];
+        in.get(state, 3);
+        in.get(index, 3);
+
+        // the size is checked before anything is copied
+        this->touch();
+        in.get(this->chunk(i).data(), m_n);
+
+        m_gen[i].seed(state[0], state[1]);
+        m_gen[i].set_index(static_cast<ptrdiff_t>(index[0]));
+        m_gen[i].restore(state[2]);
+        m_start.flat(i) = static_cast<typename Index::value_type>(index[1]);
+        m_i.flat(i) = static_cast<typename Index::value_type>(index[2]);
+
+        if (!m_pending.empty()) {
+            m_pending[i] = 0;
+        }
+
+        if (m_last.size() == m_gen.size()) {
+            m_last[i] = m_start.flat(i) + m_i.flat(i);
+        }
+
+        return in.pos;
     }
 
     /**
-     * Advance generators.
-     * See pcg32::advance().
+     * @brief Get the ``index`` random number, which ``index`` specified per generator.
      *
-     * @tparam T The type of the input array, e.g. `xt::array<int64_t>` or `xt::xtensor<int64_t, N>`
+     * @note `alignment::min_margin` and `alignment::strict` are not relevant: alignment is always
+     * exact.
      *
-     * @param arg The distance (positive or negative) by which to advance each generator.
+     * @tparam R Return type.
+     * @param index Index of the random number.
      */
-    template <class T>
-    void advance(const T& arg)
+    void align_at(const Index& index)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            m_gen[i].advance(arg.flat(i));
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+        this->touch();
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            this->draw_deferred(i);
+            auto get_chunk = [this, i](value_type* data, size_t n) {
+                this->draw_chunk(i, data, n);
+            };
+            if constexpr (!is_cumsum) {
+                detail::chunk_align_at(
+                    m_gen[i],
+                    get_chunk,
+                    m_align,
+                    this->chunk(i),
+                    &m_start.flat(i),
+                    index.flat(i)
+                );
+            }
+            else {
+                auto get_sum = [this, i](size_t n) { return this->draw_sum(i, n); };
+                detail::cumsum_align_at(
+                    m_gen[i],
+                    get_chunk,
+                    get_sum,
+                    m_align,
+                    this->chunk(i),
+                    &m_start.flat(i),
+                    index.flat(i)
+                );
+            }
         }
+
+        xt::noalias(m_i) = index - m_start;
+        m_pending.clear();
     }
 
     /**
-     * Restore generators from a state.
-     * See pcg32::restore().
-     *
-     * @tparam T The type of the input array, e.g. `xt::array<uint64_t>` or `xt::xtensor<uint64_t,
-     * N>`
-     *
-     * @param arg The state of each generator.
+     * @copydoc prrng::pcg32_cumsum::index_at_align()
      */
-    template <class T>
-    void restore(const T& arg)
+    Index index_at_align() const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            m_gen[i].restore(arg.flat(i));
-        }
+        return m_start + m_i;
     }
 
-protected:
     /**
-     * @brief For each `p` take a decision.
-     * @param p Array of probabilities.
-     * @param ret Outcome, same shape as `p`.
+     * @copydoc prrng::pcg32_cumsum::chunk_index_at_align()
      */
-    void decide_impl(const double* p, bool* ret)
+    const Index& chunk_index_at_align() const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].next_double() < p[i];
+        return m_i;
+    }
+
+    /**
+     * @copybrief prrng::pcg32_cumsum::left_of_align()
+     * @param ret Array to store the result in.
+     */
+    template <class R>
+    void left_of_align(R& ret) const
+    {
+        PRRNG_ASSERT(xt::has_shape(ret, m_gen.shape()));
+        using value_type = typename R::value_type;
+        this->draw_deferred();
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            ret.flat(i) = static_cast<value_type>(this->chunk_data(i)[m_i.flat(i)]);
         }
     }
 
     /**
-     * @brief For each `p` take a decision.
-     * @param p Array of probabilities.
-     * @param mask Mask entries of `p`.
-     * @param ret Outcome, same shape as `p`.
+     * @copybrief prrng::pcg32_cumsum::right_of_align()
+     * @param ret Array to store the result in.
      */
-    void decide_masked_impl(const double* p, const bool* mask, bool* ret)
+    template <class R>
+    void right_of_align(R& ret) const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            if (mask[i]) {
-                ret[i] = false;
-            }
-            else {
-                ret[i] = m_gen[i].next_double() < p[i];
-            }
+        PRRNG_ASSERT(xt::has_shape(ret, m_gen.shape()));
+        using value_type = typename R::value_type;
+        this->draw_deferred();
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            ret.flat(i) = static_cast<value_type>(this->chunk_data(i)[m_i.flat(i) + 1]);
         }
     }
 
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
+     * @copydoc prrng::pcg32_cumsum::left_of_align()
      */
-    void cumsum_random_impl(double* ret, const size_t* n)
+    template <class R>
+    R left_of_align() const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_random(n[i]);
+        R ret = R::from_shape(m_gen.shape());
+        this->left_of_align(ret);
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_cumsum::right_of_align()
+     */
+    template <class R>
+    R right_of_align() const
+    {
+        R ret = R::from_shape(m_gen.shape());
+        this->right_of_align(ret);
+        return ret;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_cumsum::state_at(ptrdiff_t)
+     */
+    template <class R, class T>
+    R state_at(const T& index)
+    {
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+
+        using value_type = typename R::value_type;
+        R ret = R::from_shape(m_gen.shape());
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            ret.flat(i) = static_cast<value_type>(m_gen[i].state_at(index.flat(i)));
         }
+
+        return ret;
     }
+};
+
+/**
+ * @copydoc prrng::pcg32_arrayBase_chunkBase
+ */
+template <
+    class Generator,
+    class Data,
+    class Index,
+    enum distribution Distribution = distribution::custom>
+class pcg32_arrayBase_chunk
+    : public pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution> {
+protected:
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_data;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_gen;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_n;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_i;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_start;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_align;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false, Distribution>::m_pending;
+
+public:
+    using size_type = typename Data::size_type; ///< Size type of the data container.
+    using value_type = typename Data::value_type; ///< Value type of the data container.
+
+    pcg32_arrayBase_chunk() = default;
 
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param scale Scale.
+     * @brief Restore the generator somewhere in the sequence.
+     *
+     * @param state The state at the beginning of the new chunk.
+     * @param index The index of the first entry of the new chunk.
      */
-    void cumsum_exponential_impl(double* ret, const size_t* n, double scale)
+    template <class S, class T>
+    void restore(const S& state, const T& index)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_exponential(n[i], scale);
+        PRRNG_ASSERT(xt::has_shape(state, m_gen.shape()));
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+        xt::noalias(m_start) = index;
+        this->touch();
+        m_pending.clear();
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_index(index.flat(i));
+            m_gen[i].restore(state.flat(i));
+            this->draw_chunk(i, this->chunk(i).data(), m_n);
+            m_gen[i].drawn(m_n);
         }
     }
+};
+
+/**
+ * TODO: copydoc
+ * @brief Array of generators of a random cumulative sum.
+ *
+ *      -   A chunk of the cumsum is kept in memory, from which to can move forward or backward.
+ *      -   All chunks are assembled to one big array.
+ *      -   The random number generated by the pcg32 algorithm.
+ *
+ * @tparam Generator Storage of the generator array, e.g. prrng::pcg32_tensor<N>.
+ * @tparam Data Storage of the data, e.g. xt::xtensor<double, N + n>.
+ * @tparam Index Storage of the index, e.g. xt::xtensor<ptrdiff_t, N>.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <
+    class Generator,
+    class Data,
+    class Index,
+    enum distribution Distribution = distribution::custom>
+class pcg32_arrayBase_cumsum
+    : public pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution> {
+protected:
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_adapt;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_align;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_data;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_extendible;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_gen;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_i;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_last;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_n;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_pending;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_start;
+    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true, Distribution>::m_velocity;
 
+public:
+    using size_type = typename Data::size_type; ///< Size type of the data container.
+    using value_type = typename Data::value_type; ///< Value type of the data container.
+
+    pcg32_arrayBase_cumsum() = default;
+
+protected:
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param k Scale.
+     * @brief Align the chunk of all generators (without adaptation).
+     * @param target Target for each generator.
      */
-    void cumsum_power_impl(double* ret, const size_t* n, double k)
+    template <class T>
+    void align_chunks(const T& target)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_power(n[i], k);
+        this->touch();
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            this->draw_deferred(i);
+            detail::align(
+                m_gen[i],
+                [this, i](value_type* data, size_t n) { this->draw_chunk(i, data, n); },
+                [this, i](size_t n) { return this->draw_sum(i, n); },
+                m_align,
+                this->chunk(i),
+                &m_start.flat(i),
+                &m_i.flat(i),
+                target.flat(i)
+            );
         }
+
+        m_pending.clear();
     }
 
+public:
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
+     * @brief Adapt the size of the chunks (and optionally the alignment) to the displacement
+     * of the targets in subsequent calls of align() (of all generators at once),
+     * see prrng::adaptation. The velocity is the average over all generators.
+     * The sequence is not changed.
+     *
+     * @param adapt Adaptation settings.
      */
-    void cumsum_gamma_impl(double* ret, const size_t* n, double k, double scale)
+    void set_adaptation(const adaptation& adapt)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_gamma(n[i], k, scale);
-        }
+        m_adapt = adapt;
+        m_velocity = 0.0;
+        m_last.clear();
     }
 
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
+     * @copydoc prrng::pcg32_cumsum::adaptation_settings()
      */
-    void cumsum_pareto_impl(double* ret, const size_t* n, double k, double scale)
+    const adaptation& adaptation_settings() const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_pareto(n[i], k, scale);
-        }
+        return m_adapt;
     }
 
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param k Shape parameter.
-     * @param scale Scale parameter.
+     * @copydoc prrng::pcg32_cumsum::velocity()
      */
-    void cumsum_weibull_impl(double* ret, const size_t* n, double k, double scale)
+    double velocity() const
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_weibull(n[i], k, scale);
-        }
+        return m_velocity;
     }
 
+    // TODO: rename align_at_value ?
     /**
-     * @brief Return the result of the cumulative sum of `n` random numbers.
-     * @param ret Output, per generator.
-     * @param n Number to draw, per generator.
-     * @param mu Mean.
-     * @param sigma Standard deviation.
+     * @copydoc prrng::pcg32_cumsum::align(double)
      */
-    void cumsum_normal_impl(double* ret, const size_t* n, double mu, double sigma)
+    template <class T>
+    void align(const T& target)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            ret[i] = m_gen[i].cumsum_normal(n[i], mu, sigma);
+        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
+
+        if (!m_extendible) {
+            PRRNG_ASSERT(this->contains(target));
+            inplace::lower_bound(m_data, target, m_i);
+            return;
         }
-    }
 
-    /**
-     * Draw `n` random numbers per array item, and write them to the correct position in `data`
-     * (assuming row-major storage!).
-     *
-     * @param data Pointer to the data (no bounds-check).
-     * @param n The number of random numbers per generator.
-     */
-    void draw_list_double(double* data, size_t n)
-    {
-        for (size_type i = 0; i < m_size; ++i) {
-            for (size_t j = 0; j < n; ++j) {
-                data[i * n + j] = m_gen[i].next_double();
-            }
+        this->align_chunks(target);
+
+        // after resizing a target may be (at the edge of, or) outside the new chunk
+        if (m_adapt.max_size > 0 && this->adapt()) {
+            this->align_chunks(target);
         }
     }
 
     /**
-     * Draw `n` random numbers per array item, and write them to the correct position in `data`
-     * (assuming row-major storage!).
+     * @brief Align a subset of items, each with its own target.
+     * Only the listed items are touched, such that the cost scales with the size of the subset
+     * (and not with the total number of items).
      *
-     * @param data Pointer to the data (no bounds-check).
-     * @param n The number of random numbers per generator.
+     * @param index Flat indices of the items to align (each item should appear at most once).
+     * @param target Target for each listed item (same size as `index`).
      */
-    void draw_list_positive_double(double* data, size_t n)
+    template <class I, class T, std::enable_if_t<!std::is_integral<I>::value, bool> = true>
+    void align(const I& index, const T& target)
     {
-        for (size_type i = 0; i < m_size; ++i) {
-            for (size_t j = 0; j < n; ++j) {
-                data[i * n + j] = m_gen[i].next_positive_double();
-            }
+        PRRNG_ASSERT(index.size() == target.size());
+
+#ifdef PRRNG_ENABLE_ASSERT
+        for (size_t k = 0; k < index.size(); ++k) {
+            PRRNG_ASSERT(static_cast<size_t>(index.flat(k)) < m_gen.size());
         }
-    }
+#endif
 
-    /**
-     * Draw `n` random numbers per array item, and write them to the correct position in `data`
-     * (assuming row-major storage!).
-     *
-     * @param data Pointer to the data (no bounds-check).
-     * @param bound The upper bound of the random numbers.
-     * @param n The number of random numbers per generator.
-     */
-    void draw_list_uint32(uint32_t* data, uint32_t bound, size_t n)
-    {
-        for (size_type i = 0; i < m_size; ++i) {
-            for (size_t j = 0; j < n; ++j) {
-                data[i * n + j] = m_gen[i].next_uint32(bound);
+        if (!m_extendible) {
+            for (size_t k = 0; k < index.size(); ++k) {
+                size_t i = static_cast<size_t>(index.flat(k));
+                PRRNG_ASSERT(
+                    target.flat(k) >= m_data.flat(i * m_n) &&
+                    target.flat(k) <= m_data.flat((i + 1) * m_n - 1)
+                );
+                m_i.flat(i) = iterator::lower_bound(
+                    &m_data.flat(i * m_n), &m_data.flat(i * m_n) + m_n, target.flat(k), m_i.flat(i)
+                );
             }
+            return;
+        }
+
+        this->touch();
+
+        PRRNG_PARALLEL_FOR(index.size() * m_n)
+        for (size_t k = 0; k < index.size(); ++k) {
+            size_t i = static_cast<size_t>(index.flat(k));
+            this->draw_deferred(i);
+            detail::align(
+                m_gen[i],
+                [this, i](value_type* data, size_t n) { this->draw_chunk(i, data, n); },
+                [this, i](size_t n) { return this->draw_sum(i, n); },
+                m_align,
+                this->chunk(i),
+                &m_start.flat(i),
+                &m_i.flat(i),
+                target.flat(k)
+            );
         }
     }
 
-private:
     /**
-     * implementation of `operator()`.
-     * (Last call in recursion).
+     * @copydoc prrng::pcg32_cumsum::align(double)
+     * @param i Flat index of the item to align.
      */
-    template <class T>
-    size_t get_item(size_t sum, size_t d, T arg)
+    void align(size_t i, double target)
     {
-        return sum + arg * m_strides[d];
+        if (!m_extendible) {
+            PRRNG_ASSERT(
+                target >= m_data.flat(i * m_n) && target <= m_data.flat((i + 1) * m_n - 1)
+            );
+            m_i.flat(i) = iterator::lower_bound(
+                &m_data.flat(i * m_n), &m_data.flat(i * m_n) + m_n, target, m_i.flat(i)
+            );
+            return;
+        }
+
+        this->touch();
+        this->draw_deferred(i);
+        detail::align(
+            m_gen[i],
+            [this, i](value_type* data, size_t n) { this->draw_chunk(i, data, n); },
+            [this, i](size_t n) { return this->draw_sum(i, n); },
+            m_align,
+            this->chunk(i),
+            &m_start.flat(i),
+            &m_i.flat(i),
+            target
+        );
     }
 
     /**
-     * implementation of `operator()`.
-     * (Called recursively).
+     * @copydoc prrng::pcg32_cumsum::restore(uint64_t, double, ptrdiff_t)
      */
-    template <class T, class... Args>
-    size_t get_item(size_t sum, size_t d, T arg, Args... args)
+    template <class S, class V, class T>
+    void restore(const S& state, const V& value, const T& index)
     {
-        return get_item(sum + arg * m_strides[d], d + 1, args...);
-    }
-
-protected:
-    std::vector<Generator> m_gen; ///< Underlying storage: one generator per array item
-    using GeneratorBase_array<derived_type, Shape>::m_size;
-    using GeneratorBase_array<derived_type, Shape>::m_shape;
-    using GeneratorBase_array<derived_type, Shape>::m_strides;
-};
-
-/**
- * Array of independent generators.
- * The idea is that each array-entry has its own random sequence, initiated by its own seed.
- * An array of random numbers can then be generated whose shape if composed of the #shape,
- * the shape of the array of generators, followed by the desired shape of the random sequence
- * draw per generator.
- * Let us consider an example. Suppose that we have a list of n = 5 generators,
- * and we want to generate i = 8 random numbers for each generator.
- * Then the output will be collected in a matrix of shape [n, i] = [5, 8] where each row
- * corresponds to a generator and the columns for that row are the random sequence generated
- * by that generator.
- * Since this class is general, you can also imagine an array of [m, n, o, p] generators with
- * a random sequence reshaped in a (row-major) array of shape [a, b, c, d, e].
- * The output is then collected in an array of shape [m, n, o, p, a, b, c, d, e].
- *
- * Note that a reference to each generator can be obtained using the `[]` and `()` operators,
- * e.g. `generators[flat_index]` and `generators(i, j, k, ...)`. All functions of pcg32()
- * can be used for each reference.
- * In addition, convenience functions state(), initstate(), initseq(), restore() are provided
- * here to store/restore the state of the entire array of generators.
- */
-class pcg32_array : public pcg32_arrayBase<pcg32, std::vector<size_t>> {
-private:
-    using derived_type = pcg32_arrayBase<pcg32, std::vector<size_t>>;
+        PRRNG_ASSERT(xt::has_shape(state, m_gen.shape()));
+        PRRNG_ASSERT(xt::has_shape(value, m_gen.shape()));
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+        xt::noalias(m_start) = index;
+        this->touch();
+        m_pending.clear();
 
-public:
-    using size_type = size_t; ///< Size type
-    using shape_type = std::vector<size_t>; ///< Shape type
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_index(index.flat(i));
+            m_gen[i].restore(state.flat(i));
 
-    pcg32_array() = default;
+            value_type* data = this->chunk(i).data();
+            this->draw_chunk(i, data, m_n);
+            m_gen[i].drawn(m_n);
+            data[0] += value.flat(i) - data[0];
+            std::partial_sum(data, data + m_n, data);
+        }
+    }
 
     /**
-     * Constructor.
-     *
-     * @param initstate State initiator for every item (accept default sequence initiator).
-     * The shape of the argument determines the shape of the generator array.
+     * @copydoc prrng::pcg32_cumsum::contains(double) const
      */
     template <class T>
-    pcg32_array(const T& initstate)
+    bool contains(const T& target) const
     {
-        m_shape.resize(initstate.dimension());
-        m_strides.resize(initstate.dimension());
-        this->init(initstate);
-    }
+        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
+        this->draw_deferred();
 
-    /**
-     * Constructor.
-     *
-     * @param initstate State initiator for every item.
-     * @param initseq Sequence initiator for every item.
-     * The shape of these argument determines the shape of the generator array.
-     */
-    template <class T, class U>
-    pcg32_array(const T& initstate, const U& initseq)
-    {
-        m_shape.resize(initstate.dimension());
-        m_strides.resize(initstate.dimension());
-        this->init(initstate, initseq);
-    }
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            if (target.flat(i) < this->chunk_data(i)[0] ||
+                target.flat(i) > this->chunk_data(i)[m_n - 1]) {
+                return false;
+            }
+        }
 
-protected:
-    using pcg32_arrayBase<pcg32, shape_type>::m_gen;
-    using GeneratorBase_array<derived_type, shape_type>::m_size;
-    using GeneratorBase_array<derived_type, shape_type>::m_shape;
-    using GeneratorBase_array<derived_type, shape_type>::m_strides;
+        return true;
+    }
 };
 
 /**
- * Fixed rank version of pcg32_array
+ * @brief Array of generators of which a chunk of the random sequence is kept in memory.
+ * @copydetails pcg32_array_chunk
  */
-template <size_t N>
-class pcg32_tensor : public pcg32_arrayBase<pcg32, std::array<size_t, N>> {
-private:
-    using derived_type = pcg32_arrayBase<pcg32, std::array<size_t, N>>;
-
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class pcg32_array_chunk
+    : public pcg32_arrayBase_chunk<pcg32_index_array, Data, Index, Distribution> {
 public:
-    using size_type = size_t; ///< Size type
-    using shape_type = std::array<size_t, N>; ///< Shape type
-
-    pcg32_tensor() = default;
-
-    /**
-     * Constructor.
-     *
-     * @param initstate State initiator for every item (accept default sequence initiator).
-     * The shape of the argument determines the shape of the generator array.
-     */
-    template <class T>
-    pcg32_tensor(const T& initstate)
-    {
-        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
-        this->init(initstate);
-    }
+    pcg32_array_chunk() = default;
 
     /**
-     * Constructor.
-     *
-     * @param initstate State initiator for every item.
-     * @param initseq Sequence initiator for every item.
-     * The shape of these argument determines the shape of the generator array.
+     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
      */
-    template <class T, class U>
-    pcg32_tensor(const T& initstate, const U& initseq)
+    template <class S, class T, class U>
+    pcg32_array_chunk(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
-        this->init(initstate, initseq);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
-
-protected:
-    using pcg32_arrayBase<pcg32, shape_type>::m_gen;
-    using GeneratorBase_array<derived_type, shape_type>::m_size;
-    using GeneratorBase_array<derived_type, shape_type>::m_shape;
-    using GeneratorBase_array<derived_type, shape_type>::m_strides;
 };
 
 /**
- * @brief Array of prrng::pcg32_index().
+ * @brief Array of generators of which a chunk of the random sequence is kept in memory.
+ * @copydetails pcg32_tensor_chunk
  */
-class pcg32_index_array : public pcg32_arrayBase<pcg32_index, std::vector<size_t>> {
-private:
-    using derived_type = pcg32_arrayBase<pcg32_index, std::vector<size_t>>;
-
+template <class Data, class Index, size_t N, enum distribution Distribution = distribution::custom>
+class pcg32_tensor_chunk
+    : public pcg32_arrayBase_chunk<pcg32_index_tensor<N>, Data, Index, Distribution> {
 public:
-    pcg32_index_array() = default;
+    pcg32_tensor_chunk() = default;
 
     /**
-     * Constructor.
-     *
-     * @param initstate State initiator for every item.
-     * @param initseq Sequence initiator for every item.
-     * The shape of these argument determines the shape of the generator array.
+     * @copydoc prrng::pcg32_tensor_cumsum::pcg32_tensor_cumsum
      */
-    template <class T, class U>
-    pcg32_index_array(const T& initstate, const U& initseq)
+    template <class S, class T, class U>
+    pcg32_tensor_chunk(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        m_shape.resize(initstate.dimension());
-        m_strides.resize(initstate.dimension());
-        this->init(initstate, initseq);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
-
-protected:
-    using pcg32_arrayBase<pcg32_index, std::vector<size_t>>::m_gen;
-    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_size;
-    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_shape;
-    using GeneratorBase_array<derived_type, std::vector<size_t>>::m_strides;
 };
 
 /**
- * Fixed rank version of pcg32_index_array
+ * @brief Array of generators of a random cumulative sum, see prrng::pcg32_cumsum().
+ *
+ * @details
+ * A chunk is kept in memory for each generator, whereby all chunks are assembled to one big array.
+ * For example, if `initstate.shape == [a, b, c]` generators are used, and the shape of the chunk
+ * `shape = [m, n]`, the shape of the chunk kept in memory `[a, b, c, m, n]`.
+ * The random number generated by the pcg32 algorithm.
+ *
+ * @tparam Data Storage of the chunk ('data'), e.g. `xt::xarray<double>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xarray<ptrdiff_t>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
  */
-template <size_t N>
-class pcg32_index_tensor : public pcg32_arrayBase<pcg32_index, std::array<size_t, N>> {
-private:
-    using derived_type = pcg32_arrayBase<pcg32_index, std::array<size_t, N>>;
-
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class pcg32_array_cumsum
+    : public pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution> {
 public:
-    pcg32_index_tensor() = default;
+    pcg32_array_cumsum() = default;
 
     /**
-     * Constructor.
-     *
+     * @param shape Shape of the chunk to keep in memory per generator.
      * @param initstate State initiator for every item.
      * @param initseq Sequence initiator for every item.
-     * The shape of these argument determines the shape of the generator array.
+     * @copydoc default_parameters
+     * @param align Alignment parameters, see prrng::alignment().
      */
-    template <class T, class U>
-    pcg32_index_tensor(const T& initstate, const U& initseq)
+    template <class S, class T, class U>
+    pcg32_array_cumsum(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        static_assert(detail::check_fixed_rank<N, T>::value, "Ranks to not match");
-        this->init(initstate, initseq);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
-
-protected:
-    using pcg32_arrayBase<pcg32_index, std::array<size_t, N>>::m_gen;
-    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_size;
-    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_shape;
-    using GeneratorBase_array<derived_type, std::array<size_t, N>>::m_strides;
 };
 
-namespace detail {
-
-template <class T, typename = void>
-struct auto_pcg32 {
-    static auto get(const T& initseq)
-    {
-        return pcg32_array(initseq);
-    }
+/**
+ * @brief Array of generators of a random cumulative sum, see prrng::pcg32_cumsum().
+ *
+ * @details
+ * A chunk is kept in memory for each generator, whereby all chunks are assembled to one big array.
+ * For example, if `initstate.shape == [a, b, c]` generators are used, and the shape of the chunk
+ * `shape = [m, n]`, the shape of the chunk kept in memory `[a, b, c, m, n]`.
+ * The random number generated by the pcg32 algorithm.
+ *
+ * @tparam Data Storage of the data, e.g. `xt::tensor<double, N + n>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::tensor<ptrdiff_t, N>`.
+ * @tparam N Rank of the array of generators.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <class Data, class Index, size_t N, enum distribution Distribution = distribution::custom>
+class pcg32_tensor_cumsum
+    : public pcg32_arrayBase_cumsum<pcg32_index_tensor<N>, Data, Index, Distribution> {
+public:
+    pcg32_tensor_cumsum() = default;
 
-    template <class S>
-    static auto get(const T& initseq, const S& initstate)
+    /**
+     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
+     */
+    template <class S, class T, class U>
+    pcg32_tensor_cumsum(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        return pcg32_array(initseq, initstate);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
 };
 
-template <class T>
-struct auto_pcg32<T, typename std::enable_if_t<xt::has_fixed_rank_t<T>::value>> {
-    static auto get(const T& initseq)
-    {
-        return pcg32_tensor<xt::get_rank<T>::value>(initseq);
-    }
+/**
+ * @brief Array of prrng::philox() generators of which a chunk of the random sequence is kept in
+ * memory, see prrng::pcg32_array_chunk().
+ * Because the generator is counter-based, moving the chunk to any index is of constant cost.
+ *
+ * @tparam Data Storage of the chunk ('data'), e.g. `xt::xarray<double>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xarray<ptrdiff_t>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class philox_array_chunk
+    : public pcg32_arrayBase_chunk<philox_index_array, Data, Index, Distribution> {
+public:
+    philox_array_chunk() = default;
 
-    template <class S>
-    static auto get(const T& initseq, const S& initstate)
+    /**
+     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
+     */
+    template <class S, class T, class U>
+    philox_array_chunk(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        return pcg32_tensor<xt::get_rank<T>::value>(initseq, initstate);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
 };
 
-template <class T>
-struct auto_pcg32<T, typename std::enable_if_t<std::is_integral<T>::value>> {
-    static auto get(const T& initseq)
-    {
-        return pcg32(initseq);
-    }
+/**
+ * @brief Array of prrng::philox() generators of a random cumulative sum,
+ * see prrng::pcg32_array_cumsum().
+ * Because the generator is counter-based, moving the chunk to any index is of constant cost.
+ *
+ * @tparam Data Storage of the chunk ('data'), e.g. `xt::xarray<double>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xarray<ptrdiff_t>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class philox_array_cumsum
+    : public pcg32_arrayBase_cumsum<philox_index_array, Data, Index, Distribution> {
+public:
+    philox_array_cumsum() = default;
 
-    template <class S>
-    static auto get(const T& initseq, const S& initstate)
+    /**
+     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
+     */
+    template <class S, class T, class U>
+    philox_array_cumsum(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        return pcg32(initseq, initstate);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
     }
 };
 
-} // namespace detail
-
 /**
- * Return a pcg32, a pcg32_array, or a pcg32_tensor based on input.
+ * @brief Partition of an array of generators of a random cumulative sum,
+ * e.g. the rows owned by one process of a domain decomposition.
  *
- * @param initstate The sequence initiator.
- * @return The allocated generator.
- */
-template <class T>
-inline auto auto_pcg32(const T& initstate)
-{
-    return detail::auto_pcg32<T>::get(initstate);
-}
-
-/**
- * Return a pcg32, a pcg32_array, or a pcg32_tensor based on input.
+ * @details
+ * Only the owned rows (generators) are kept in memory, as a one-dimensional
+ * prrng::pcg32_array_cumsum(), together with the global index of each row (in ascending order).
+ * Row `r` of the global array is seeded with `initstate[r]` and `initseq[r]`:
+ * a partition is constructed with the slice of `initstate` and `initseq` from a global offset.
  *
- * @param initstate The sequence initiator.
- * @param initseq The sequence initiator.
- * @return The allocated generator.
- */
-template <class T, class S>
-inline auto auto_pcg32(const T& initstate, const S& initseq)
-{
-    return detail::auto_pcg32<T>::get(initstate, initseq);
-}
-
-/**
- * @brief Array of generators of which a chunk of random numbers is kept in memory.
+ * Rows are copied using their compact binary form (state, index, and chunk),
+ * see prrng::pcg32_arrayBase_chunkBase::serialize_row().
+ * Migrating rows between partitions (dynamic load balancing), or checkpointing,
+ * is therefore a byte copy and does not redraw any chunk:
  *
- * @tparam Generator Storage of the generator array, e.g. prrng::pcg32_tensor<N>.
- * @tparam Data Storage of the data, e.g. xt::xtensor<double, N + n>.
- * @tparam Index Storage of the index, e.g. xt::xtensor<ptrdiff_t, N>.
+ *      std::vector<char> blob = a.serialize_rows(rows); // send to the new owner
+ *      a.erase_rows(rows);
+ *      b.insert_rows(blob.data(), blob.size()); // on the new owner
+ *
+ * All partitions should use the same distribution and chunk size.
+ *
+ * @tparam Data Storage of the chunks, e.g. `xt::xtensor<double, 2>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xtensor<ptrdiff_t, 1>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
  */
-template <class Generator, class Data, class Index, bool is_cumsum>
-class pcg32_arrayBase_chunkBase {
-    static_assert(std::is_signed<typename Index::value_type>::value, "Index must be signed");
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class pcg32_array_partitioned_cumsum
+    : public pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution> {
+protected:
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_align;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_buffer;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_capacity;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_data;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_distro;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_gen;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_i;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_jump;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_last;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_n;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_offset;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_pending;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_start;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_stats;
+    using pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index, Distribution>::m_synced;
+
+    std::vector<size_t> m_rows; ///< Global index of each owned row (ascending).
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max(); ///< Added row.
 
 public:
-    using size_type = typename Data::size_type; ///< Size type of the data container.
+    using value_type = typename Data::value_type; ///< Value type of the data container.
 
-protected:
-    Generator m_gen; ///< Array of generators
-    Data m_data; ///< Data container
+    pcg32_array_partitioned_cumsum() = default;
+
+    /**
+     * @param shape Shape of the chunk to keep in memory per generator (one-dimensional).
+     * @param initstate State initiator for every owned row (one-dimensional).
+     * @param initseq Sequence initiator for every owned row (one-dimensional).
+     * @param offset Global index of the first owned row.
+     * @copydoc default_parameters
+     * @param align Alignment parameters, see prrng::alignment().
+     */
+    template <class S, class T, class U>
+    pcg32_array_partitioned_cumsum(
+        const S& shape,
+        const T& initstate,
+        const U& initseq,
+        size_t offset,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
+    {
+        PRRNG_ASSERT(shape.size() == 1);
+        PRRNG_ASSERT(initstate.dimension() == 1);
+        this->init(shape, initstate, initseq, distribution, parameters, align);
+        m_rows.resize(initstate.size());
+        std::iota(m_rows.begin(), m_rows.end(), offset);
+    }
 
     /**
-     * @brief Function to draw the next chunk of `n` random numbers starting from the curent state
-     * of the generator.
-     * The functions of all generators are collected in a vector (flat storage).
+     * @brief Global index of each owned row (ascending).
+     * The chunk of `rows()[i]` is `data()[i]`.
+     * @return List of global indices.
      */
-    std::vector<std::function<xt::xtensor<double, 1>(size_t)>> m_draw;
+    const std::vector<size_t>& rows() const
+    {
+        return m_rows;
+    }
 
     /**
-     * @brief Function to get the cumsum of `n` random numbers starting from the curent state
-     * of the generator (used to skip allocating an list of size `n`).
-     * The functions of all generators are collected in a vector (flat storage).
+     * @brief Check if a row is owned by this partition.
+     * @param row Global index of the row.
+     * @return bool
      */
-    std::vector<std::function<double(size_t)>> m_sum;
+    bool owns(size_t row) const
+    {
+        return std::binary_search(m_rows.cbegin(), m_rows.cend(), row);
+    }
 
     /**
-     * @brief Signal if the drawing functions are specified, implying that the chunk can be changed.
+     * @brief Local index of an owned row.
+     * @param row Global index of the row.
+     * @return Local (flat) index of the row, e.g. to use in `align(index, target)`.
+     * @throw std::runtime_error if the row is not owned.
      */
-    bool m_extendible;
+    size_t local_index(size_t row) const
+    {
+        auto it = std::lower_bound(m_rows.cbegin(), m_rows.cend(), row);
 
-    alignment m_align; ///< alignment settings, see prrng::alignment().
-    distribution m_distro; ///< Distribution name, see prrng::distribution().
-    std::array<double, 3> m_param; ///< Distribution parameters.
-    Index m_start; ///< Start index of the chunk.
-    Index m_i; ///< Last known index of `target` in align.
-    size_t m_n; ///< Size of the chunk.
+        if (it == m_rows.cend() || *it != row) {
+            throw std::runtime_error("[prrng] Row is not owned");
+        }
+
+        return static_cast<size_t>(it - m_rows.cbegin());
+    }
 
-protected:
     /**
-     * @brief Constructor.
+     * @brief Serialize owned rows to a single binary blob, from which they can be added to
+     * a partition using insert_rows().
+     * The blob consists of fields of 8 bytes:
      *
-     * @param shape Shape of the chunk to keep in memory per generator.
-     * @param initstate State initiator for every item.
-     * @param initseq Sequence initiator for every item.
-     * @copydoc default_parameters
-     * @param align Alignment parameters, see prrng::alignment().
+     *      nrows, (row, serialize_row())[nrows]
+     *
+     * whereby `row` is the global index.
+     * Serializing rows() gives a checkpoint, which can be restored in a partition without rows.
+     *
+     * @param rows Global indices of the rows (e.g. `std::vector<size_t>`).
+     * @return Binary blob.
+     * @throw std::runtime_error if a row is not owned.
      */
-    template <class S, class T, class U>
-    void init(
-        const S& shape,
-        const T& initstate,
-        const U& initseq,
-        enum distribution distribution,
-        const std::vector<double>& parameters,
-        const alignment& align = alignment()
-    )
+    template <class R>
+    std::vector<char> serialize_rows(const R& rows) const
     {
-        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
-
-        m_align = align;
-        m_distro = distribution;
-        m_gen = Generator(initstate, initseq);
+        std::vector<char> ret;
+        detail::serial_writer out(ret);
+        out.put(static_cast<uint64_t>(std::distance(rows.begin(), rows.end())));
 
-        for (size_t i = 0; i < m_gen.size(); ++i) {
-            m_gen[i].set_delta(distribution == distribution::delta);
+        for (auto row : rows) {
+            out.put(static_cast<uint64_t>(row));
+            this->serialize_row_to(this->local_index(static_cast<size_t>(row)), ret);
         }
 
-        std::vector<size_t> data_shape;
-        data_shape.resize(initstate.dimension() + shape.size());
-        std::copy(initstate.shape().begin(), initstate.shape().end(), data_shape.begin());
-        std::copy(shape.begin(), shape.end(), data_shape.begin() + initstate.dimension());
-        m_data = xt::empty<typename Data::value_type>(data_shape);
-        m_n = m_data.size() / initstate.size();
+        return ret;
+    }
 
-        m_start = xt::zeros<typename Index::value_type>(m_gen.shape());
-        m_i = m_n * xt::ones<typename Index::value_type>(m_gen.shape());
+    /**
+     * @brief Add the rows of serialize_rows() (of this or of another partition).
+     * The owned rows are kept in place, only the added rows are restored.
+     *
+     * @param buffer Pointer to the binary blob.
+     * @param size Size of the binary blob (in bytes).
+     * @return Number of bytes read.
+     * @throw std::runtime_error if the blob is not compatible with this partition,
+     * or contains a row that is already owned (the partition is then not modified).
+     */
+    size_t insert_rows(const char* buffer, size_t size)
+    {
+        detail::serial_reader in(buffer, size);
+        size_t nrows = static_cast<size_t>(in.get<uint64_t>());
+        size_t bytes = this->serialized_row_size();
+        in.require(nrows, sizeof(uint64_t) + bytes);
+        std::vector<std::pair<size_t, const char*>> items;
+        items.reserve(nrows);
+
+        for (size_t k = 0; k < nrows; ++k) {
+            size_t row = static_cast<size_t>(in.get<uint64_t>());
+
+            if (bytes > size - in.pos) {
+                throw std::runtime_error("[prrng] Serialized data is truncated");
+            }
 
-        auto par = default_parameters(distribution, parameters);
-        std::copy(par.begin(), par.end(), m_param.begin());
+            items.emplace_back(row, buffer + in.pos);
+            in.pos += bytes;
+        }
 
-        this->auto_functions();
+        std::sort(items.begin(), items.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
 
-        using E = decltype(m_draw[size_t{}](size_t{}));
+        for (size_t k = 0; k < items.size(); ++k) {
+            if (this->owns(items[k].first) || (k > 0 && items[k].first == items[k - 1].first)) {
+                throw std::runtime_error("[prrng] Row is already owned");
+            }
+        }
 
-        // if possible: draw the first chunk
-        if (m_extendible) {
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                E extra = m_draw[i](m_n);
-                m_gen[i].drawn(m_n);
-                if constexpr (is_cumsum) {
-                    std::partial_sum(extra.begin(), extra.end(), &m_data.flat(i * m_n));
-                }
-                else {
-                    std::copy(extra.begin(), extra.end(), &m_data.flat(i * m_n));
+        // merge the added rows (sorted) with the owned rows (sorted)
+        size_t n = m_rows.size() + items.size();
+        std::vector<size_t> rows(n);
+        std::vector<size_t> from(n);
+        std::vector<size_t> undo(m_rows.size());
+
+        for (size_t k = 0, i = 0, j = 0; k < n; ++k) {
+            if (j == items.size() || (i < m_rows.size() && m_rows[i] < items[j].first)) {
+                rows[k] = m_rows[i];
+                from[k] = i;
+                undo[i] = k;
+                ++i;
+            }
+            else {
+                rows[k] = items[j].first;
+                from[k] = npos;
+                ++j;
+            }
+        }
+
+        this->gather_rows(from, std::move(rows));
+
+        try {
+            for (size_t k = 0, j = 0; k < n; ++k) {
+                if (from[k] == npos) {
+                    this->deserialize_row(k, items[j].second, bytes);
+                    ++j;
                 }
             }
         }
+        catch (...) {
+            std::vector<size_t> kept(undo.size());
+            for (size_t i = 0; i < undo.size(); ++i) {
+                kept[i] = m_rows[undo[i]];
+            }
+            this->gather_rows(undo, std::move(kept));
+            throw;
+        }
+
+        return in.pos;
     }
 
     /**
-     * @brief Set draw function.
+     * @brief Remove owned rows.
+     * The other rows are kept in place.
+     *
+     * @param rows Global indices of the rows (e.g. `std::vector<size_t>`).
+     * @throw std::runtime_error if a row is not owned (the partition is then not modified).
      */
-    void auto_functions()
+    template <class R>
+    void erase_rows(const R& rows)
     {
-        using R = decltype(m_draw[size_t{}](size_t{}));
-        m_extendible = true;
+        std::vector<bool> keep(m_rows.size(), true);
 
-        if (m_distro != distribution::custom) {
-            m_draw.resize(m_gen.size());
-            if constexpr (is_cumsum) {
-                m_sum.resize(m_gen.size());
-            }
+        for (auto row : rows) {
+            keep[this->local_index(static_cast<size_t>(row))] = false;
         }
 
-        switch (m_distro) {
-        case random:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template random<R>(std::array<size_t, 1>{n}) * m_param[0] +
-                           m_param[1];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_random(n) * m_param[0] +
-                               static_cast<double>(n) * m_param[1];
-                    };
-                }
+        std::vector<size_t> from;
+        std::vector<size_t> kept;
+
+        for (size_t i = 0; i < m_rows.size(); ++i) {
+            if (keep[i]) {
+                from.push_back(i);
+                kept.push_back(m_rows[i]);
             }
-            return;
-        case delta:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template delta<R>(std::array<size_t, 1>{n}, m_param[0]) +
-                           m_param[1];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_delta(n, m_param[0]) +
-                               static_cast<double>(n) * m_param[1];
-                    };
-                }
+        }
+
+        this->gather_rows(from, std::move(kept));
+    }
+
+private:
+    /**
+     * @brief Reorder the owned rows: new (local) row `k` is current row `from[k]`.
+     * The rows are either only erased (`from[k] >= k`), or only added (`from[k] <= k`),
+     * whereby an added row has `from[k] == npos` and should be restored using
+     * deserialize_row().
+     * The generators and chunks are moved, nothing is drawn or serialized.
+     *
+     * @param from Per new row: the current row, or `npos`.
+     * @param rows Global index of each new row (ascending).
+     */
+    void gather_rows(const std::vector<size_t>& from, std::vector<size_t>&& rows)
+    {
+        size_t n = from.size();
+        bool grow = n > m_rows.size();
+
+        // move the row in its storage (without allocating if possible)
+        auto relocate = [&](auto& vec, size_t stride) {
+            if (grow) {
+                vec.resize(n * stride);
             }
-            return;
-        case exponential:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template exponential<R>(std::array<size_t, 1>{n}, m_param[0]) +
-                           m_param[1];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_exponential(n, m_param[0]) +
-                               static_cast<double>(n) * m_param[1];
-                    };
+
+            auto step = [&](size_t k) {
+                if (from[k] != npos && from[k] != k) {
+                    auto first = vec.begin() + from[k] * stride;
+                    std::copy(first, first + stride, vec.begin() + k * stride);
                 }
-            }
-            return;
-        case power:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template power<R>(std::array<size_t, 1>{n}, m_param[0]) +
-                           m_param[1];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_power(n, m_param[0]) +
-                               static_cast<double>(n) * m_param[1];
-                    };
+            };
+
+            if (grow) {
+                for (size_t k = n; k-- > 0;) {
+                    step(k);
                 }
             }
-            return;
-        case gamma:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template gamma<R>(
-                               std::array<size_t, 1>{n}, m_param[0], m_param[1]
-                           ) +
-                           m_param[2];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_gamma(n, m_param[0], m_param[1]) +
-                               static_cast<double>(n) * m_param[2];
-                    };
+            else {
+                for (size_t k = 0; k < n; ++k) {
+                    step(k);
                 }
             }
-            return;
-        case pareto:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template pareto<R>(
-                               std::array<size_t, 1>{n}, m_param[0], m_param[1]
-                           ) +
-                           m_param[2];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_pareto(n, m_param[0], m_param[1]) +
-                               static_cast<double>(n) * m_param[2];
-                    };
+
+            vec.resize(n * stride);
+        };
+
+        // chunks: stored with slack in #m_buffer, or in #m_data
+        if (m_capacity > m_n) {
+            relocate(m_buffer, m_capacity);
+            m_data = xt::empty<value_type>(std::array<size_t, 2>{n, m_n});
+            m_synced = false;
+        }
+        else {
+            Data data = xt::empty<value_type>(std::array<size_t, 2>{n, m_n});
+            for (size_t k = 0; k < n; ++k) {
+                if (from[k] != npos) {
+                    const value_type* first = m_data.data() + from[k] * m_n;
+                    std::copy(first, first + m_n, data.data() + k * m_n);
                 }
             }
-            return;
-        case weibull:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template weibull<R>(
-                               std::array<size_t, 1>{n}, m_param[0], m_param[1]
-                           ) +
-                           m_param[2];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_weibull(n, m_param[0], m_param[1]) +
-                               static_cast<double>(n) * m_param[2];
-                    };
-                }
+            m_data = std::move(data);
+        }
+
+        relocate(m_offset, 1);
+        relocate(m_jump, 1);
+
+        if (!m_pending.empty()) {
+            relocate(m_pending, 1);
+        }
+
+        if (!m_last.empty()) {
+            relocate(m_last, 1);
+        }
+
+#ifdef PRRNG_ENABLE_STATISTICS
+        relocate(m_stats, 1);
+#endif
+
+        xt::xtensor<uint64_t, 1> seed = xt::zeros<uint64_t>({n});
+        pcg32_index_array gen(seed, seed);
+        Index start = xt::zeros<typename Index::value_type>({n});
+        Index i = xt::zeros<typename Index::value_type>({n});
+
+        for (size_t k = 0; k < n; ++k) {
+            if (from[k] != npos) {
+                gen[k] = m_gen[from[k]];
+                start(k) = m_start(from[k]);
+                i(k) = m_i(from[k]);
             }
-            return;
-        case normal:
-            for (size_t i = 0; i < m_gen.size(); ++i) {
-                m_draw[i] = [this, i](size_t n) -> R {
-                    return m_gen[i].template normal<R>(
-                               std::array<size_t, 1>{n}, m_param[0], m_param[1]
-                           ) +
-                           m_param[2];
-                };
-                if constexpr (is_cumsum) {
-                    m_sum[i] = [this, i](size_t n) -> double {
-                        return m_gen[i].cumsum_normal(n, m_param[0], m_param[1]) +
-                               static_cast<double>(n) * m_param[2];
-                    };
-                }
+            else {
+                gen[k].set_delta(m_distro == distribution::delta);
+                m_offset[k] = 0;
+#ifdef PRRNG_ENABLE_STATISTICS
+                m_stats[k] = chunk_statistics();
+#endif
             }
-            return;
-        case custom:
-            m_extendible = false;
-            return;
         }
-    }
 
-    /**
-     * @brief Copy constructor.
-     * This function resets all internal pointers.
-     *
-     * @param other Object to copy.
-     */
-    void copy_from(const pcg32_arrayBase_chunkBase& other)
-    {
-        m_gen = other.m_gen;
-        m_data = other.m_data;
-        m_align = other.m_align;
-        m_distro = other.m_distro;
-        m_param = other.m_param;
-        m_start = other.m_start;
-        m_i = other.m_i;
-        m_n = other.m_n;
-        this->auto_functions();
+        m_gen = std::move(gen);
+        m_start = std::move(start);
+        m_i = std::move(i);
+        m_rows = std::move(rows);
     }
+};
+
+/**
+ * @brief Array of generators of a random cumulative sum, see prrng::pcg32_cumsum(),
+ * whereby each generator has its own chunk size.
+ *
+ * @details
+ * The chunks are stored in one contiguous pool in compressed (CSR) form:
+ * the chunk of generator `i` (flat index) is `data()[offsets()[i]:offsets()[i + 1]]`.
+ * This avoids sizing all chunks for the largest chunk, as e.g. prrng::pcg32_array_cumsum() does.
+ * `alignment::slack` is not used.
+ *
+ * @tparam Data Storage of the pool of chunks, e.g. `xt::xtensor<double, 1>`.
+ * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xarray<ptrdiff_t>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
+ */
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class pcg32_array_ragged_cumsum {
+    static_assert(std::is_signed<typename Index::value_type>::value, "Index must be signed");
 
 public:
-    pcg32_arrayBase_chunkBase() = default;
+    using size_type = typename Data::size_type; ///< Size type of the data container.
+    using value_type = typename Data::value_type; ///< Value type of the data container.
+
+private:
+    pcg32_index_array m_gen; ///< Array of generators.
+    Data m_data; ///< Pool of chunks.
+    std::vector<size_t> m_offsets; ///< Start of the chunk of each generator in #m_data.
+    std::vector<ptrdiff_t> m_window; ///< Start of each chunk in its storage (zero: no slack).
+    std::vector<pcg32_stride> m_jump; ///< Per generator: last jump, see detail::jump_to().
+    alignment m_align; ///< alignment settings, see prrng::alignment().
+    distribution m_distro; ///< Distribution name, see prrng::distribution().
+    std::array<double, 3> m_param; ///< Distribution parameters.
+    Index m_start; ///< Start index of the chunk.
+    Index m_i; ///< Last known index of `target` in align.
+    std::vector<chunk_statistics> m_stats; ///< Per generator (if #PRRNG_ENABLE_STATISTICS).
 
     /**
-     * @copydoc prrng::pcg32_arrayBase_chunkBase::copy_from(const prrng::pcg32_arrayBase_chunkBase&)
+     * @brief Draw the next `n` random numbers of one generator starting from its current state.
+     *
+     * @param i Flat index of the generator.
+     * @param data Pointer to the output (modified).
+     * @param n Number of random numbers.
      */
-    pcg32_arrayBase_chunkBase(const pcg32_arrayBase_chunkBase& other)
+    void draw_chunk(size_t i, value_type* data, size_t n)
     {
-        this->copy_from(other);
+        PRRNG_STATISTICS(this->stats(i), drawn += n);
+
+        if constexpr (Distribution != distribution::custom) {
+            detail::draw_chunk<Distribution>(m_gen[i], m_param, data, n);
+        }
+        else {
+            detail::draw_chunk(m_gen[i], m_distro, m_param, data, n);
+        }
     }
 
     /**
-     * @copydoc prrng::pcg32_arrayBase_chunkBase::copy_from(const prrng::pcg32_arrayBase_chunkBase&)
+     * @brief Get the cumsum of the next `n` random numbers of one generator starting from its
+     * current state.
+     *
+     * @param i Flat index of the generator.
+     * @param n Number of random numbers.
+     * @return Cumulative sum.
      */
-    void operator=(const pcg32_arrayBase_chunkBase& other)
+    double draw_sum(size_t i, size_t n)
     {
-        this->copy_from(other);
+        PRRNG_STATISTICS(this->stats(i), summed += n);
+        bool exact = !m_align.sample_skip;
+
+        if constexpr (Distribution != distribution::custom) {
+            return detail::draw_cumsum<Distribution>(m_gen[i], m_param, n, exact);
+        }
+        else {
+            return detail::draw_cumsum(m_gen[i], m_distro, m_param, n, exact);
+        }
     }
 
     /**
-     * @brief Add values to each chunk.
-     * @param values Values to add.
+     * @brief Statistics of the chunk of one generator (to be updated).
+     *
+     * @param i Flat index of the generator.
+     * @return Pointer, `nullptr` if the statistics are not collected.
      */
-    template <class T>
-    pcg32_arrayBase_chunkBase& operator+=(const T& values)
+    chunk_statistics* stats(size_t i)
     {
-        xt::noalias(m_data) += values;
-        return *this;
+        return m_stats.empty() ? nullptr : &m_stats[i];
     }
 
     /**
-     * @brief Subtract values from each chunk.
-     * @param values Values to subtract.
+     * @brief The chunk of one generator in the pool.
+     *
+     * @param i Flat index of the generator.
+     * @return detail::chunk_buffer
      */
-    template <class T>
-    pcg32_arrayBase_chunkBase& operator-=(const T& values)
+    detail::chunk_buffer<value_type> chunk(size_t i)
     {
-        xt::noalias(m_data) -= values;
-        return *this;
+        ptrdiff_t n = static_cast<ptrdiff_t>(m_offsets[i + 1] - m_offsets[i]);
+        return detail::chunk_buffer<value_type>(
+            m_data.data() + m_offsets[i], n, &m_window[i], n, this->stats(i), &m_jump[i]
+        );
     }
 
     /**
-     * @brief `true` if the chunk is extendible.
-     * @return bool
+     * @brief Pointer to the first entry of the chunk of one generator.
+     *
+     * @param i Flat index of the generator.
+     * @return Pointer.
      */
-    bool is_extendible() const
+    const value_type* chunk_data(size_t i) const
     {
-        return m_extendible;
+        return m_data.data() + m_offsets[i];
     }
 
+public:
+    pcg32_array_ragged_cumsum() = default;
+
     /**
-     * @brief Size of the chunk per generator.
-     * @return Unsigned integer.
+     * @param sizes Size of the chunk of each generator (same shape as `initstate`).
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * @copydoc default_parameters
+     * @param align Alignment parameters, see prrng::alignment().
      */
-    size_type chunk_size() const
+    template <class S, class T, class U>
+    pcg32_array_ragged_cumsum(
+        const S& sizes,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
     {
-        return static_cast<size_type>(m_n);
+        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+        PRRNG_ASSERT(xt::has_shape(sizes, initstate.shape()));
+        PRRNG_ASSERT(distribution != distribution::custom);
+        PRRNG_ASSERT(Distribution == distribution::custom || distribution == Distribution);
+
+        m_align = align;
+        m_distro = distribution;
+        m_gen = pcg32_index_array(initstate, initseq);
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_delta(distribution == distribution::delta);
+        }
+
+        m_offsets.resize(m_gen.size() + 1);
+        m_offsets[0] = 0;
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            PRRNG_ASSERT(sizes.flat(i) >= 2);
+            m_offsets[i + 1] = m_offsets[i] + static_cast<size_t>(sizes.flat(i));
+        }
+
+        m_data = xt::empty<value_type>(std::array<size_t, 1>{m_offsets.back()});
+        m_window.assign(m_gen.size(), 0);
+        m_jump.assign(m_gen.size(), pcg32_stride());
+        m_start = xt::zeros<typename Index::value_type>(m_gen.shape());
+        m_i = xt::zeros<typename Index::value_type>(m_gen.shape());
+
+        auto par = default_parameters(distribution, parameters);
+        std::copy(par.begin(), par.end(), m_param.begin());
+
+#ifdef PRRNG_ENABLE_STATISTICS
+        m_stats.assign(m_gen.size(), chunk_statistics());
+#endif
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            size_t n = this->chunk_size(i);
+            value_type* data = this->chunk(i).data();
+            this->draw_chunk(i, data, n);
+            m_gen[i].drawn(n);
+            std::partial_sum(data, data + n, data);
+            m_i.flat(i) = static_cast<typename Index::value_type>(n);
+        }
     }
 
     /**
      * @brief Reference to the underlying generators.
      * @return Reference to generator array.
      */
-    const Generator& generators() const
+    const pcg32_index_array& generators() const
     {
         return m_gen;
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::data()
+     * @brief Size of the chunk of one generator.
+     * @param i Flat index of the generator.
+     * @return Unsigned integer.
      */
-    const Data& data() const
+    size_t chunk_size(size_t i) const
     {
-        return m_data;
+        return m_offsets[i + 1] - m_offsets[i];
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::set_data(const Data&)
+     * @brief Start of the chunk of each generator in data(), followed by the size of data().
+     * @return `std::vector<size_t>` of size `number of generators + 1`.
      */
-    void set_data(const Data& data)
+    const std::vector<size_t>& offsets() const
     {
-        PRRNG_ASSERT(xt::has_shape(data, m_data.shape()));
-        xt::noalias(m_data) = data;
+        return m_offsets;
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::start()
+     * @brief Pool of all chunks, see offsets().
+     * @return Reference to the pool.
      */
-    const Index& start() const
+    const Data& data() const
     {
-        return m_start;
+        return m_data;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_arrayBase_chunkBase::statistics()
+     */
+    chunk_statistics statistics() const
+    {
+        chunk_statistics ret;
+        for (const auto& stats : m_stats) {
+            ret += stats;
+        }
+        return ret;
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::set_start(ptrdiff_t)
+     * @copydoc prrng::pcg32_cumsum::reset_statistics()
      */
-    void set_start(const Index& index)
+    void reset_statistics()
     {
-        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
-        xt::noalias(m_start) = index;
+        std::fill(m_stats.begin(), m_stats.end(), chunk_statistics());
     }
 
     /**
-     * @brief Get the ``index`` random number, which ``index`` specified per generator.
-     *
-     * @note `alignment::min_margin` and `alignment::strict` are not relevant: alignment is always
-     * exact.
-     *
-     * @tparam R Return type.
-     * @param index Index of the random number.
+     * @copydoc prrng::pcg32_cumsum::start()
      */
-    void align_at(const Index& index)
+    const Index& start() const
     {
-        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
-
-        for (size_t i = 0; i < m_gen.size(); ++i) {
-            if constexpr (!is_cumsum) {
-                detail::chunk_align_at(
-                    m_gen[i],
-                    m_draw[i],
-                    m_align,
-                    &m_data.flat(i * m_n),
-                    m_n,
-                    &m_start.flat(i),
-                    index.flat(i)
-                );
-            }
-            else {
-                detail::cumsum_align_at(
-                    m_gen[i],
-                    m_draw[i],
-                    m_sum[i],
-                    m_align,
-                    &m_data.flat(i * m_n),
-                    m_n,
-                    &m_start.flat(i),
-                    index.flat(i)
-                );
-            }
-        }
-
-        xt::noalias(m_i) = index - m_start;
+        return m_start;
     }
 
     /**
@@ -6219,10 +15778,10 @@ public:
     void left_of_align(R& ret) const
     {
         PRRNG_ASSERT(xt::has_shape(ret, m_gen.shape()));
-        using value_type = typename R::value_type;
+        using ret_type = typename R::value_type;
 
         for (size_t i = 0; i < m_gen.size(); ++i) {
-            ret.flat(i) = static_cast<value_type>(m_data.flat(i * m_n + m_i.flat(i)));
+            ret.flat(i) = static_cast<ret_type>(this->chunk_data(i)[m_i.flat(i)]);
         }
     }
 
@@ -6234,10 +15793,10 @@ public:
     void right_of_align(R& ret) const
     {
         PRRNG_ASSERT(xt::has_shape(ret, m_gen.shape()));
-        using value_type = typename R::value_type;
+        using ret_type = typename R::value_type;
 
         for (size_t i = 0; i < m_gen.size(); ++i) {
-            ret.flat(i) = static_cast<value_type>(m_data.flat(i * m_n + m_i.flat(i) + 1));
+            ret.flat(i) = static_cast<ret_type>(this->chunk_data(i)[m_i.flat(i) + 1]);
         }
     }
 
@@ -6264,324 +15823,715 @@ public:
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::state_at(ptrdiff_t)
+     * @copydoc prrng::pcg32_cumsum::contains(double) const
      */
-    template <class R, class T>
-    R state_at(const T& index)
+    template <class T>
+    bool contains(const T& target) const
     {
-        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
 
-        using value_type = typename R::value_type;
-        R ret = R::from_shape(m_gen.shape());
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            if (target.flat(i) < this->chunk_data(i)[0] ||
+                target.flat(i) > this->chunk_data(i)[this->chunk_size(i) - 1]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @copydoc prrng::pcg32_cumsum::align(double)
+     */
+    template <class T>
+    void align(const T& target)
+    {
+        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
 
+        PRRNG_PARALLEL_FOR(m_data.size())
         for (size_t i = 0; i < m_gen.size(); ++i) {
-            ret.flat(i) = static_cast<value_type>(m_gen[i].state_at(index.flat(i)));
+            detail::align(
+                m_gen[i],
+                [this, i](value_type* data, size_t n) { this->draw_chunk(i, data, n); },
+                [this, i](size_t n) { return this->draw_sum(i, n); },
+                m_align,
+                this->chunk(i),
+                &m_start.flat(i),
+                &m_i.flat(i),
+                target.flat(i)
+            );
         }
+    }
 
-        return ret;
+    /**
+     * @copydoc prrng::pcg32_arrayBase_chunkBase::align_at(const Index&)
+     */
+    void align_at(const Index& index)
+    {
+        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            detail::cumsum_align_at(
+                m_gen[i],
+                [this, i](value_type* data, size_t n) { this->draw_chunk(i, data, n); },
+                [this, i](size_t n) { return this->draw_sum(i, n); },
+                m_align,
+                this->chunk(i),
+                &m_start.flat(i),
+                index.flat(i)
+            );
+        }
+
+        xt::noalias(m_i) = index - m_start;
     }
 };
 
 /**
- * @copydoc prrng::pcg32_arrayBase_chunkBase
+ * @brief Array of generators of which each generator drives the random cumulative sums of
+ * several channels (e.g. several quantities per site), see prrng::pcg32_array_cumsum().
+ *
+ * @details
+ * The random numbers of a generator are distributed over the channels in turn:
+ * entry `j` of channel `c` is the cumulative sum of the random numbers
+ * `c, K + c, ..., j * K + c`, with `K` the number of channels.
+ * The chunks of all channels of a generator share one window of the sequence
+ * (the same start()), and are stored interleaved: the chunk has shape `[size, K]`,
+ * such that rows of the chunk are drawn in the order of the sequence.
+ * The data therefore has shape `initstate.shape + [size, K]`,
+ * the targets and indices have shape `initstate.shape + [K]`.
+ * Because the window is shared, the targets of all channels of a generator must fit in one chunk,
+ * and the alignment parameters apply to the channel with the smallest index.
+ * Skipped random numbers are always drawn (`alignment::sample_skip` and `alignment::slack`
+ * are not used).
+ *
+ * @tparam Data Storage of the chunks, e.g. `xt::xtensor<double, N + 2>`.
+ * @tparam Index Storage of a 'column' index per channel, e.g. `xt::xtensor<ptrdiff_t, N + 1>`.
+ * @tparam Distribution Distribution known at compile time, see prrng::pcg32_cumsum.
  */
-template <class Generator, class Data, class Index>
-class pcg32_arrayBase_chunk : public pcg32_arrayBase_chunkBase<Generator, Data, Index, false> {
-protected:
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_data;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_draw;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_gen;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_n;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_i;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_start;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, false>::m_align;
+template <class Data, class Index, enum distribution Distribution = distribution::custom>
+class pcg32_array_multi_cumsum {
+    static_assert(std::is_signed<typename Index::value_type>::value, "Index must be signed");
 
 public:
     using size_type = typename Data::size_type; ///< Size type of the data container.
     using value_type = typename Data::value_type; ///< Value type of the data container.
 
-    pcg32_arrayBase_chunk() = default;
+private:
+    pcg32_index_array m_gen; ///< Array of generators.
+    Data m_data; ///< Chunks (channels interleaved).
+    ptrdiff_t m_size = 0; ///< Number of rows of each chunk.
+    ptrdiff_t m_channels = 0; ///< Number of channels.
+    alignment m_align; ///< alignment settings, see prrng::alignment().
+    distribution m_distro; ///< Distribution name, see prrng::distribution().
+    std::array<double, 3> m_param; ///< Distribution parameters.
+    Index m_start; ///< Start row of the chunk (the same for all channels of a generator).
+    Index m_i; ///< Last known row of `target` in align.
+    std::vector<chunk_statistics> m_stats; ///< Per generator (if #PRRNG_ENABLE_STATISTICS).
 
     /**
-     * @brief Restore the generator somewhere in the sequence.
+     * @brief Draw the next `n` rows of one generator starting from its current state.
      *
-     * @param state The state at the beginning of the new chunk.
-     * @param index The index of the first entry of the new chunk.
+     * @param i Flat index of the generator.
+     * @param data Pointer to the output (modified).
+     * @param n Number of rows.
      */
-    template <class S, class T>
-    void restore(const S& state, const T& index)
+    void draw_rows(size_t i, value_type* data, ptrdiff_t n)
     {
-        PRRNG_ASSERT(xt::has_shape(state, m_gen.shape()));
-        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
-        xt::noalias(m_start) = index;
+        size_t m = static_cast<size_t>(n * m_channels);
+
+        if constexpr (Distribution != distribution::custom) {
+            detail::draw_chunk<Distribution>(m_gen[i], m_param, data, m);
+        }
+        else {
+            detail::draw_chunk(m_gen[i], m_distro, m_param, data, m);
+        }
+
+        m_gen[i].drawn(static_cast<ptrdiff_t>(m));
+    }
+
+    /**
+     * @brief Add (or subtract) the sum per channel of the next `n` rows of one generator.
+     * The rows are drawn in blocks of at most `size - 1` rows.
+     *
+     * @param i Flat index of the generator.
+     * @param scratch Pointer to storage of `size - 1` rows (overwritten).
+     * @param row Pointer to the row to which to add the sums (modified).
+     * @param n Number of rows.
+     * @param subtract If `true` the sums are subtracted.
+     */
+    void skip_rows(size_t i, value_type* scratch, value_type* row, ptrdiff_t n, bool subtract)
+    {
+        while (n > 0) {
+            ptrdiff_t m = std::min(n, m_size - 1);
+            this->draw_rows(i, scratch, m);
+            PRRNG_STATISTICS(this->stats(i), summed += static_cast<size_t>(m * m_channels));
+
+            for (ptrdiff_t r = 0; r < m; ++r) {
+                for (ptrdiff_t c = 0; c < m_channels; ++c) {
+                    if (subtract) {
+                        row[c] -= scratch[r * m_channels + c];
+                    }
+                    else {
+                        row[c] += scratch[r * m_channels + c];
+                    }
+                }
+            }
+
+            n -= m;
+        }
+    }
+
+    /**
+     * @brief Move the generator to the first random number of a row.
+     *
+     * @param i Flat index of the generator.
+     * @param row Row (global).
+     */
+    void jump_to(size_t i, ptrdiff_t row)
+    {
+        ptrdiff_t index = row * m_channels;
+        PRRNG_STATISTICS(this->stats(i), jump(m_gen[i].index(), index));
+        m_gen[i].jump_to(index);
+    }
+
+    /**
+     * @brief Move the chunk of one generator by a number of rows.
+     *
+     * @param i Flat index of the generator.
+     * @param m Number of rows (positive: move right, negative: move left).
+     */
+    void shift(size_t i, ptrdiff_t m)
+    {
+        ptrdiff_t n = m_size;
+        ptrdiff_t k = m_channels;
+        ptrdiff_t start = m_start.flat(i * static_cast<size_t>(k));
+        value_type* data = this->chunk_data(i);
+        PRRNG_STATISTICS(this->stats(i), shifts++);
+
+        if (m > 0) {
+            ptrdiff_t first = n - m;
+            this->jump_to(i, start + n);
+
+            if (m < n) {
+                std::copy(data + m * k, data + n * k, data);
+            }
+            else {
+                // the first row accumulates the skipped rows, up to the new first row
+                std::copy(data + (n - 1) * k, data + n * k, data);
+                this->skip_rows(i, data + k, data, m - n + 1, false);
+                first = 1;
+            }
+
+            this->draw_rows(i, data + first * k, n - first);
+            PRRNG_STATISTICS(this->stats(i), drawn += static_cast<size_t>((n - first) * k));
+
+            for (ptrdiff_t r = first; r < n; ++r) {
+                for (ptrdiff_t c = 0; c < k; ++c) {
+                    data[r * k + c] += data[(r - 1) * k + c];
+                }
+            }
+        }
+        else if (m < 0) {
+            ptrdiff_t last = -m;
+
+            if (-m < n) {
+                std::copy_backward(data, data + (n + m) * k, data + n * k);
+            }
+            else {
+                // the last row subtracts the skipped rows, down to the new last row
+                std::copy(data, data + k, data + (n - 1) * k);
+                this->jump_to(i, start + m + n);
+                this->skip_rows(i, data, data + (n - 1) * k, -m - n + 1, true);
+                last = n - 1;
+            }
+
+            // row `r` is drawn from the random numbers of the next row: the cumsum runs backward
+            this->jump_to(i, start + m + 1);
+            this->draw_rows(i, data, last);
+            PRRNG_STATISTICS(this->stats(i), drawn += static_cast<size_t>(last * k));
+
+            for (ptrdiff_t r = last - 1; r >= 0; --r) {
+                for (ptrdiff_t c = 0; c < k; ++c) {
+                    data[r * k + c] = data[(r + 1) * k + c] - data[r * k + c];
+                }
+            }
+        }
+
+        for (ptrdiff_t c = 0; c < k; ++c) {
+            m_start.flat(i * static_cast<size_t>(k) + static_cast<size_t>(c)) += m;
+        }
+    }
+
+    /**
+     * @brief Last row of a chunk for which the channel is smaller than the target.
+     *
+     * @param data Pointer to the chunk.
+     * @param c Channel.
+     * @param target Target value.
+     * @param lo First row to search.
+     * @param n Number of rows to search.
+     * @return Row.
+     */
+    ptrdiff_t search(const value_type* data, ptrdiff_t c, double target, ptrdiff_t lo, ptrdiff_t n)
+        const
+    {
+        while (n > 0) {
+            ptrdiff_t half = n / 2;
+            if (data[(lo + half) * m_channels + c] < target) {
+                lo += half + 1;
+                n -= half + 1;
+            }
+            else {
+                n = half;
+            }
+        }
+
+        return lo - 1;
+    }
+
+    /**
+     * @brief Last row of a chunk for which the channel is smaller than the target,
+     * searching around a guess (as iterator::gallop_lower_bound()).
+     * Call only if the target is in the chunk: `data[c] < target <= data[(n - 1) * k + c]`.
+     *
+     * @param data Pointer to the chunk.
+     * @param c Channel.
+     * @param target Target value.
+     * @param guess Guess of the row, in `[0, n - 1)`.
+     * @return Row.
+     */
+    ptrdiff_t gallop(const value_type* data, ptrdiff_t c, double target, ptrdiff_t guess) const
+    {
+        ptrdiff_t n = m_size;
+        ptrdiff_t k = m_channels;
+        ptrdiff_t lo;
+        ptrdiff_t hi;
+        ptrdiff_t step = 1;
+
+        if (data[guess * k + c] < target) {
+            // search right: the first row not smaller than the target is in [lo, hi]
+            lo = guess + 1;
+            hi = lo;
+            while (hi < n && data[hi * k + c] < target) {
+                lo = hi + 1;
+                hi = lo + step;
+                step *= 2;
+            }
+            hi = std::min(hi, n);
+        }
+        else {
+            // search left: the first row not smaller than the target is in [lo, hi]
+            hi = guess;
+            lo = guess - 1;
+            while (lo >= 0 && !(data[lo * k + c] < target)) {
+                hi = lo;
+                lo = hi - step;
+                step *= 2;
+            }
+            lo = std::max(lo + 1, ptrdiff_t(0));
+        }
+
+        return this->search(data, c, target, lo, hi - lo);
+    }
+
+    /**
+     * @brief Align the chunk of one generator such that it contains the targets of all channels.
+     *
+     * @param i Flat index of the generator.
+     * @param target Targets, see align().
+     * @return `false` if the targets do not fit in one chunk.
+     */
+    template <class T>
+    bool align_chunk(size_t i, const T& target)
+    {
+        ptrdiff_t n = m_size;
+        ptrdiff_t k = m_channels;
+        size_t o = i * static_cast<size_t>(k);
+        PRRNG_STATISTICS(this->stats(i), aligns++);
+
+        bool backward = false;
+
+        for (bool recursive = false;; recursive = true) {
+            const value_type* data = this->chunk_data(i);
+            const value_type* back = data + (n - 1) * k;
+            bool below = false;
+            bool above = false;
+            ptrdiff_t jmin = n;
+            ptrdiff_t jmax = -1;
+            double ahead = std::numeric_limits<double>::max(); // rows to the nearest target
+            PRRNG_STATISTICS(this->stats(i), recursions += recursive);
+
+            for (ptrdiff_t c = 0; c < k; ++c) {
+                double t = static_cast<double>(target.flat(o + static_cast<size_t>(c)));
+                if (t <= data[c]) {
+                    below = true;
+                }
+                else if (t > back[c]) {
+                    double delta = (back[c] - data[c]) / static_cast<double>(n - 1);
+                    above = true;
+                    ahead = std::min(ahead, (t - back[c]) / delta);
+                }
+                else {
+                    ptrdiff_t guess = static_cast<ptrdiff_t>(m_i.flat(o + static_cast<size_t>(c)));
+                    ptrdiff_t j;
+                    if (recursive || guess < 0 || guess >= n - 1) {
+                        j = this->search(data, c, t, 0, n);
+                        PRRNG_STATISTICS(this->stats(i), search_misses++);
+                    }
+                    else if (data[guess * k + c] < t && t <= data[(guess + 1) * k + c]) {
+                        j = guess;
+                        PRRNG_STATISTICS(this->stats(i), search_hits++);
+                    }
+                    else {
+                        j = this->gallop(data, c, t, guess);
+                        PRRNG_STATISTICS(this->stats(i), search_misses++);
+                    }
+                    m_i.flat(o + static_cast<size_t>(c)) = j;
+                    jmin = std::min(jmin, j);
+                    jmax = std::max(jmax, j);
+                }
+            }
+
+            if (below && above) {
+                return false;
+            }
+
+            if (below) {
+                this->shift(i, -n);
+                backward = true;
+                continue;
+            }
+
+            if (above) {
+                ptrdiff_t m;
+                if (jmax >= 0) {
+                    m = jmin > m_align.margin ? jmin - m_align.margin : jmin;
+                    if (m == 0) {
+                        return false;
+                    }
+                }
+                else {
+                    // skip rows unless moved backward before (the next chunk can not overshoot)
+                    m = static_cast<ptrdiff_t>(ahead) - m_align.margin;
+                    m = m > n && !backward ? m - 1 : n - 1 - m_align.margin;
+                }
+                this->shift(i, m);
+                continue;
+            }
+
+            if (jmin == m_align.margin) {
+                return true;
+            }
+            if (!recursive && m_align.buffer > 0 && jmin >= m_align.buffer &&
+                jmax + m_align.buffer < n) {
+                return true;
+            }
+
+            ptrdiff_t m = jmin - m_align.margin;
+
+            if (m < 0) {
+                if (!m_align.strict && jmin >= m_align.min_margin) {
+                    return true;
+                }
+                // do not move any channel out of the chunk
+                m = std::max(m, jmax - n + 2);
+                if (m >= 0) {
+                    return true;
+                }
+            }
+
+            this->shift(i, m);
+
+            for (ptrdiff_t c = 0; c < k; ++c) {
+                m_i.flat(o + static_cast<size_t>(c)) -= m;
+            }
+
+            return true;
+        }
+    }
+
+    /**
+     * @brief Statistics of the chunk of one generator (to be updated).
+     *
+     * @param i Flat index of the generator.
+     * @return Pointer, `nullptr` if the statistics are not collected.
+     */
+    chunk_statistics* stats(size_t i)
+    {
+        return m_stats.empty() ? nullptr : &m_stats[i];
+    }
+
+    /**
+     * @brief Pointer to the first entry of the chunk of one generator.
+     *
+     * @param i Flat index of the generator.
+     * @return Pointer.
+     */
+    value_type* chunk_data(size_t i)
+    {
+        return m_data.data() + i * static_cast<size_t>(m_size * m_channels);
+    }
+
+    /**
+     * @copydoc chunk_data(size_t)
+     */
+    const value_type* chunk_data(size_t i) const
+    {
+        return m_data.data() + i * static_cast<size_t>(m_size * m_channels);
+    }
+
+public:
+    pcg32_array_multi_cumsum() = default;
+
+    /**
+     * @param size Number of rows of the chunk of each generator (shared by all channels).
+     * @param channels Number of channels per generator.
+     * @param initstate State initiator for every item.
+     * @param initseq Sequence initiator for every item.
+     * @copydoc default_parameters
+     * @param align Alignment parameters, see prrng::alignment().
+     */
+    template <class T, class U>
+    pcg32_array_multi_cumsum(
+        size_t size,
+        size_t channels,
+        const T& initstate,
+        const U& initseq,
+        enum distribution distribution,
+        const std::vector<double>& parameters,
+        const alignment& align = alignment()
+    )
+    {
+        PRRNG_ASSERT(xt::has_shape(initstate, initseq.shape()));
+        PRRNG_ASSERT(distribution != distribution::custom);
+        PRRNG_ASSERT(Distribution == distribution::custom || distribution == Distribution);
+        PRRNG_ASSERT(size >= 2);
+        PRRNG_ASSERT(channels >= 1);
+        PRRNG_ASSERT(align.margin < static_cast<ptrdiff_t>(size) - 1);
+
+        m_size = static_cast<ptrdiff_t>(size);
+        m_channels = static_cast<ptrdiff_t>(channels);
+        m_align = align;
+        m_distro = distribution;
+        m_gen = pcg32_index_array(initstate, initseq);
+
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            m_gen[i].set_delta(distribution == distribution::delta);
+        }
+
+        std::vector<size_t> shape(m_gen.shape().cbegin(), m_gen.shape().cend());
+        shape.push_back(channels);
+        m_start = Index::from_shape(shape);
+        m_start.fill(0);
+        m_i = Index::from_shape(shape);
+        m_i.fill(static_cast<typename Index::value_type>(size));
+        shape.back() = size;
+        shape.push_back(channels);
+        m_data = Data::from_shape(shape);
+
+        auto par = default_parameters(distribution, parameters);
+        std::copy(par.begin(), par.end(), m_param.begin());
+
+#ifdef PRRNG_ENABLE_STATISTICS
+        m_stats.assign(m_gen.size(), chunk_statistics());
+#endif
 
+        PRRNG_PARALLEL_FOR(m_data.size())
         for (size_t i = 0; i < m_gen.size(); ++i) {
-            m_gen[i].set_index(index.flat(i));
-            m_gen[i].restore(state.flat(i));
-
-            using E = decltype(m_draw[i](size_t{}));
-            E extra = m_draw[i](m_n);
-            m_gen[i].drawn(m_n);
-            std::copy(extra.begin(), extra.end(), &m_data.flat(i * m_n));
+            value_type* data = this->chunk_data(i);
+            this->draw_rows(i, data, m_size);
+            PRRNG_STATISTICS(this->stats(i), drawn += static_cast<size_t>(m_size * m_channels));
+            for (ptrdiff_t r = 1; r < m_size; ++r) {
+                for (ptrdiff_t c = 0; c < m_channels; ++c) {
+                    data[r * m_channels + c] += data[(r - 1) * m_channels + c];
+                }
+            }
         }
     }
-};
-
-/**
- * TODO: copydoc
- * @brief Array of generators of a random cumulative sum.
- *
- *      -   A chunk of the cumsum is kept in memory, from which to can move forward or backward.
- *      -   All chunks are assembled to one big array.
- *      -   The random number generated by the pcg32 algorithm.
- *
- * @tparam Generator Storage of the generator array, e.g. prrng::pcg32_tensor<N>.
- * @tparam Data Storage of the data, e.g. xt::xtensor<double, N + n>.
- * @tparam Index Storage of the index, e.g. xt::xtensor<ptrdiff_t, N>.
- */
-template <class Generator, class Data, class Index>
-class pcg32_arrayBase_cumsum : public pcg32_arrayBase_chunkBase<Generator, Data, Index, true> {
-protected:
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_align;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_data;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_draw;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_extendible;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_gen;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_i;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_n;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_start;
-    using pcg32_arrayBase_chunkBase<Generator, Data, Index, true>::m_sum;
 
-public:
-    using size_type = typename Data::size_type; ///< Size type of the data container.
+    /**
+     * @brief Reference to the underlying generators.
+     * @return Reference to generator array.
+     */
+    const pcg32_index_array& generators() const
+    {
+        return m_gen;
+    }
 
-    pcg32_arrayBase_cumsum() = default;
+    /**
+     * @brief Number of rows of the chunk of each generator.
+     * @return Unsigned integer.
+     */
+    size_t size() const
+    {
+        return static_cast<size_t>(m_size);
+    }
 
-    // TODO: rename align_at_value ?
     /**
-     * @copydoc prrng::pcg32_cumsum::align(double)
+     * @brief Number of channels per generator.
+     * @return Unsigned integer.
      */
-    template <class T>
-    void align(const T& target)
+    size_t channels() const
     {
-        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
+        return static_cast<size_t>(m_channels);
+    }
 
-        if (!m_extendible) {
-            PRRNG_ASSERT(this->contains(target));
-            inplace::lower_bound(m_data, target, m_i);
-            return;
-        }
+    /**
+     * @brief The chunks, shape `generators().shape() + [size(), channels()]`.
+     * @return Reference to the data.
+     */
+    const Data& data() const
+    {
+        return m_data;
+    }
 
-        for (size_t i = 0; i < m_gen.size(); ++i) {
-            detail::align(
-                m_gen[i],
-                m_draw[i],
-                m_sum[i],
-                m_align,
-                &m_data.flat(i * m_n),
-                m_n,
-                &m_start.flat(i),
-                &m_i.flat(i),
-                target.flat(i)
-            );
+    /**
+     * @copydoc prrng::pcg32_arrayBase_chunkBase::statistics()
+     */
+    chunk_statistics statistics() const
+    {
+        chunk_statistics ret;
+        for (const auto& stats : m_stats) {
+            ret += stats;
         }
+        return ret;
     }
 
-    // todo: overload with array index
+    /**
+     * @copydoc prrng::pcg32_cumsum::reset_statistics()
+     */
+    void reset_statistics()
+    {
+        std::fill(m_stats.begin(), m_stats.end(), chunk_statistics());
+    }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::align(double)
-     * @param i Flat index of the item to align.
+     * @brief Start row of the chunk (identical for all channels of a generator).
+     * @return Array of shape `generators().shape() + [channels()]`.
      */
-    void align(size_t i, double target)
+    const Index& start() const
     {
-        if (!m_extendible) {
-            PRRNG_ASSERT(
-                target >= m_data.flat(i * m_n) && target <= m_data.flat((i + 1) * m_n - 1)
-            );
-            m_i.flat(i) = iterator::lower_bound(
-                &m_data.flat(i * m_n), &m_data.flat(i * m_n) + m_n, target, m_i.flat(i)
-            );
-            return;
-        }
+        return m_start;
+    }
 
-        detail::align(
-            m_gen[i],
-            m_draw[i],
-            m_sum[i],
-            m_align,
-            &m_data.flat(i * m_n),
-            m_n,
-            &m_start.flat(i),
-            &m_i.flat(i),
-            target
-        );
+    /**
+     * @brief Row (global) of the last target of each channel, see align().
+     * @return Array of shape `generators().shape() + [channels()]`.
+     */
+    Index index_at_align() const
+    {
+        return m_start + m_i;
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::restore(uint64_t, double, ptrdiff_t)
+     * @brief Row in the chunk of the last target of each channel, see align().
+     * @return Array of shape `generators().shape() + [channels()]`.
      */
-    template <class S, class V, class T>
-    void restore(const S& state, const V& value, const T& index)
+    const Index& chunk_index_at_align() const
     {
-        PRRNG_ASSERT(xt::has_shape(state, m_gen.shape()));
-        PRRNG_ASSERT(xt::has_shape(value, m_gen.shape()));
-        PRRNG_ASSERT(xt::has_shape(index, m_gen.shape()));
-        xt::noalias(m_start) = index;
+        return m_i;
+    }
 
-        for (size_t i = 0; i < m_gen.size(); ++i) {
-            m_gen[i].set_index(index.flat(i));
-            m_gen[i].restore(state.flat(i));
+    /**
+     * @copybrief prrng::pcg32_cumsum::left_of_align()
+     * @param ret Array to store the result in (shape `generators().shape() + [channels()]`).
+     */
+    template <class R>
+    void left_of_align(R& ret) const
+    {
+        PRRNG_ASSERT(xt::has_shape(ret, m_i.shape()));
+        using ret_type = typename R::value_type;
 
-            using E = decltype(m_draw[i](size_t{}));
-            E extra = m_draw[i](m_n);
-            m_gen[i].drawn(m_n);
-            extra.front() += value.flat(i) - extra.front();
-            std::partial_sum(extra.begin(), extra.end(), &m_data.flat(i * m_n));
+        for (size_t i = 0; i < ret.size(); ++i) {
+            size_t c = i % static_cast<size_t>(m_channels);
+            const value_type* data = this->chunk_data(i / static_cast<size_t>(m_channels));
+            ret.flat(i) = static_cast<ret_type>(data[m_i.flat(i) * m_channels + c]);
         }
     }
 
     /**
-     * @copydoc prrng::pcg32_cumsum::contains(double) const
+     * @copybrief prrng::pcg32_cumsum::right_of_align()
+     * @param ret Array to store the result in (shape `generators().shape() + [channels()]`).
      */
-    template <class T>
-    bool contains(const T& target) const
+    template <class R>
+    void right_of_align(R& ret) const
     {
-        PRRNG_ASSERT(xt::has_shape(target, m_gen.shape()));
+        PRRNG_ASSERT(xt::has_shape(ret, m_i.shape()));
+        using ret_type = typename R::value_type;
 
-        for (size_t i = 0; i < m_gen.size(); ++i) {
-            if (target.flat(i) < m_data.flat(i * m_n) ||
-                target.flat(i) > m_data.flat((i + 1) * m_n - 1)) {
-                return false;
-            }
+        for (size_t i = 0; i < ret.size(); ++i) {
+            size_t c = i % static_cast<size_t>(m_channels);
+            const value_type* data = this->chunk_data(i / static_cast<size_t>(m_channels));
+            ret.flat(i) = static_cast<ret_type>(data[(m_i.flat(i) + 1) * m_channels + c]);
         }
-
-        return true;
     }
-};
-
-/**
- * @brief Array of generators of which a chunk of the random sequence is kept in memory.
- * @copydetails pcg32_array_chunk
- */
-template <class Data, class Index>
-class pcg32_array_chunk : public pcg32_arrayBase_chunk<pcg32_index_array, Data, Index> {
-public:
-    pcg32_array_chunk() = default;
 
     /**
-     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
+     * @copydoc prrng::pcg32_cumsum::left_of_align()
      */
-    template <class S, class T, class U>
-    pcg32_array_chunk(
-        const S& shape,
-        const T& initstate,
-        const U& initseq,
-        enum distribution distribution,
-        const std::vector<double>& parameters,
-        const alignment& align = alignment()
-    )
+    template <class R>
+    R left_of_align() const
     {
-        this->init(shape, initstate, initseq, distribution, parameters, align);
+        R ret = R::from_shape(m_i.shape());
+        this->left_of_align(ret);
+        return ret;
     }
-};
-
-/**
- * @brief Array of generators of which a chunk of the random sequence is kept in memory.
- * @copydetails pcg32_tensor_chunk
- */
-template <class Data, class Index, size_t N>
-class pcg32_tensor_chunk : public pcg32_arrayBase_chunk<pcg32_index_tensor<N>, Data, Index> {
-public:
-    pcg32_tensor_chunk() = default;
 
     /**
-     * @copydoc prrng::pcg32_tensor_cumsum::pcg32_tensor_cumsum
+     * @copydoc prrng::pcg32_cumsum::right_of_align()
      */
-    template <class S, class T, class U>
-    pcg32_tensor_chunk(
-        const S& shape,
-        const T& initstate,
-        const U& initseq,
-        enum distribution distribution,
-        const std::vector<double>& parameters,
-        const alignment& align = alignment()
-    )
+    template <class R>
+    R right_of_align() const
     {
-        this->init(shape, initstate, initseq, distribution, parameters, align);
+        R ret = R::from_shape(m_i.shape());
+        this->right_of_align(ret);
+        return ret;
     }
-};
-
-/**
- * @brief Array of generators of a random cumulative sum, see prrng::pcg32_cumsum().
- *
- * @details
- * A chunk is kept in memory for each generator, whereby all chunks are assembled to one big array.
- * For example, if `initstate.shape == [a, b, c]` generators are used, and the shape of the chunk
- * `shape = [m, n]`, the shape of the chunk kept in memory `[a, b, c, m, n]`.
- * The random number generated by the pcg32 algorithm.
- *
- * @tparam Data Storage of the chunk ('data'), e.g. `xt::xarray<double>`.
- * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::xarray<ptrdiff_t>`.
- */
-template <class Data, class Index>
-class pcg32_array_cumsum : public pcg32_arrayBase_cumsum<pcg32_index_array, Data, Index> {
-public:
-    pcg32_array_cumsum() = default;
 
     /**
-     * @param shape Shape of the chunk to keep in memory per generator.
-     * @param initstate State initiator for every item.
-     * @param initseq Sequence initiator for every item.
-     * @copydoc default_parameters
-     * @param align Alignment parameters, see prrng::alignment().
+     * @brief Check if the targets of all channels are contained in the chunks.
+     * @param target Target values, shape `generators().shape() + [channels()]`.
+     * @return `true` if all targets are in the chunks.
      */
-    template <class S, class T, class U>
-    pcg32_array_cumsum(
-        const S& shape,
-        const T& initstate,
-        const U& initseq,
-        enum distribution distribution,
-        const std::vector<double>& parameters,
-        const alignment& align = alignment()
-    )
+    template <class T>
+    bool contains(const T& target) const
     {
-        this->init(shape, initstate, initseq, distribution, parameters, align);
-    }
-};
+        PRRNG_ASSERT(xt::has_shape(target, m_i.shape()));
+        size_t k = static_cast<size_t>(m_channels);
 
-/**
- * @brief Array of generators of a random cumulative sum, see prrng::pcg32_cumsum().
- *
- * @details
- * A chunk is kept in memory for each generator, whereby all chunks are assembled to one big array.
- * For example, if `initstate.shape == [a, b, c]` generators are used, and the shape of the chunk
- * `shape = [m, n]`, the shape of the chunk kept in memory `[a, b, c, m, n]`.
- * The random number generated by the pcg32 algorithm.
- *
- * @tparam Data Storage of the data, e.g. `xt::tensor<double, N + n>`.
- * @tparam Index Storage of a 'column' index in the chunk, e.g. `xt::tensor<ptrdiff_t, N>`.
- * @tparam N Rank of the array of generators.
- */
-template <class Data, class Index, size_t N>
-class pcg32_tensor_cumsum : public pcg32_arrayBase_cumsum<pcg32_index_tensor<N>, Data, Index> {
-public:
-    pcg32_tensor_cumsum() = default;
+        for (size_t i = 0; i < target.size(); ++i) {
+            const value_type* data = this->chunk_data(i / k);
+            const value_type* back = data + (m_size - 1) * m_channels;
+            if (target.flat(i) < data[i % k] || target.flat(i) > back[i % k]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
 
     /**
-     * @copydoc prrng::pcg32_array_cumsum::pcg32_array_cumsum
+     * @brief Align the chunks such that they contain the targets of all channels.
+     * Per generator, the chunk is moved only once for all channels.
+     *
+     * @param target Target values, shape `generators().shape() + [channels()]`.
+     * @throw std::runtime_error if the targets of a generator do not fit in one chunk.
      */
-    template <class S, class T, class U>
-    pcg32_tensor_cumsum(
-        const S& shape,
-        const T& initstate,
-        const U& initseq,
-        enum distribution distribution,
-        const std::vector<double>& parameters,
-        const alignment& align = alignment()
-    )
+    template <class T>
+    void align(const T& target)
     {
-        this->init(shape, initstate, initseq, distribution, parameters, align);
+        PRRNG_ASSERT(xt::has_shape(target, m_i.shape()));
+        std::vector<char> fits(m_gen.size());
+
+        PRRNG_PARALLEL_FOR(m_data.size())
+        for (size_t i = 0; i < m_gen.size(); ++i) {
+            fits[i] = this->align_chunk(i, target);
+        }
+
+        if (std::find(fits.begin(), fits.end(), 0) != fits.end()) {
+            throw std::runtime_error("[prrng] Targets of all channels do not fit in the chunk");
+        }
     }
 };
 
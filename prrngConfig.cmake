@@ -15,6 +15,8 @@
 #   prrng::compiler_warnings - enable compiler warnings
 #   prrng::assert - enable prrng assertions
 #   prrng::debug - enable all assertions (slow)
+#   prrng::statistics - collect statistics of the moves of chunks
+#   prrng::openmp - split loops over arrays of generators over threads (OpenMP)
 
 include(CMakeFindDependencyMacro)
 
@@ -29,6 +31,7 @@ endif()
 
 find_dependency(xtensor REQUIRED)
 find_dependency(Boost REQUIRED)
+find_dependency(Threads REQUIRED)
 
 # Define support target "prrng::compiler_warnings"
 
@@ -68,3 +71,30 @@ if(NOT TARGET prrng::debug)
         PRRNG_ENABLE_ASSERT
         PRRNG_ENABLE_DEBUG)
 endif()
+
+# Define support target "prrng::statistics"
+
+if(NOT TARGET prrng::statistics)
+    add_library(prrng::statistics INTERFACE IMPORTED)
+    set_property(
+        TARGET prrng::statistics
+        PROPERTY INTERFACE_COMPILE_DEFINITIONS
+        PRRNG_ENABLE_STATISTICS)
+endif()
+
+# Define support target "prrng::openmp"
+
+if(NOT TARGET prrng::openmp)
+    find_package(OpenMP QUIET)
+    if(OpenMP_CXX_FOUND)
+        add_library(prrng::openmp INTERFACE IMPORTED)
+        set_property(
+            TARGET prrng::openmp
+            PROPERTY INTERFACE_COMPILE_DEFINITIONS
+            PRRNG_USE_OPENMP=1)
+        set_property(
+            TARGET prrng::openmp
+            PROPERTY INTERFACE_LINK_LIBRARIES
+            OpenMP::OpenMP_CXX)
+    endif()
+endif()
@@ -13,6 +13,12 @@
 
 namespace py = pybind11;
 
+/**
+ * Output array, see e.g. `out=` of `random`.
+ * It is written linearly, NumPy arrays that are not C-contiguous are therefore rejected.
+ */
+using pyarray_out = xt::pyarray<double, xt::layout_type::row_major>;
+
 /**
  * Overrides the `__name__` of a module.
  * Classes defined by pybind11 use the `__name__` of the module as of the time they are defined,
@@ -35,6 +41,54 @@ private:
     py::object original_name_;
 };
 
+/**
+ * Shape of the output of an array of generators: [shape, ishape].
+ * The output is allocated while holding the GIL, the GIL is released while drawing.
+ */
+template <class Parent>
+std::vector<size_t> outer_shape(const Parent& self, const std::vector<size_t>& ishape)
+{
+    std::vector<size_t> ret(self.shape().cbegin(), self.shape().cend());
+    ret.insert(ret.end(), ishape.cbegin(), ishape.cend());
+    return ret;
+}
+
+/**
+ * Bytes of a binary blob (e.g. ``bytes`` or a ``numpy.memmap``), see e.g. `deserialize`.
+ * The buffer is read linearly: it must be C-contiguous and of 1-byte items.
+ */
+class blob_view {
+public:
+    explicit blob_view(const py::buffer& buffer) : m_info(buffer.request())
+    {
+        if (m_info.itemsize != 1) {
+            throw std::runtime_error("[prrng] Blob must be a buffer of bytes");
+        }
+
+        py::ssize_t stride = 1;
+
+        for (py::ssize_t i = m_info.ndim; i-- > 0;) {
+            if (m_info.shape[i] > 1 && m_info.strides[i] != stride) {
+                throw std::runtime_error("[prrng] Blob must be C-contiguous");
+            }
+            stride *= m_info.shape[i];
+        }
+    }
+
+    const char* data() const
+    {
+        return static_cast<const char*>(m_info.ptr);
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(m_info.size);
+    }
+
+private:
+    py::buffer_info m_info;
+};
+
 template <class C, class Parent>
 void init_GeneratorBase_array(C& cls)
 {
@@ -75,7 +129,8 @@ void init_GeneratorBase_array(C& cls)
         "ndarray of decision. "
         "See :cpp:func:`prrng::GeneratorBase_array::decide`.",
         py::arg("p"),
-        py::arg("ret")
+        py::arg("ret"),
+        py::call_guard<py::gil_scoped_release>()
     );
 
     cls.def(
@@ -105,18 +160,96 @@ void init_GeneratorBase_array(C& cls)
         "See :cpp:func:`prrng::GeneratorBase_array::decide_masked`.",
         py::arg("p"),
         py::arg("mask"),
-        py::arg("ret")
+        py::arg("ret"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "decide_packed",
+        [](Parent& self, const xt::pyarray<double>& p) {
+            std::array<size_t, 1> shape = {static_cast<size_t>((self.size() + 7) / 8)};
+            xt::pytensor<uint8_t, 1> ret = xt::pytensor<uint8_t, 1>::from_shape(shape);
+            {
+                py::gil_scoped_release release;
+                self.decide_packed(p, ret);
+            }
+            return ret;
+        },
+        "Bit-packed decisions "
+        "(unpack: ``numpy.unpackbits(ret, count=size, bitorder='little')``). "
+        "See :cpp:func:`prrng::GeneratorBase_array::decide_packed`.",
+        py::arg("p")
+    );
+
+    cls.def(
+        "decide_masked_packed",
+        [](Parent& self, const xt::pyarray<double>& p, const xt::pyarray<bool>& mask) {
+            std::array<size_t, 1> shape = {static_cast<size_t>((self.size() + 7) / 8)};
+            xt::pytensor<uint8_t, 1> ret = xt::pytensor<uint8_t, 1>::from_shape(shape);
+            {
+                py::gil_scoped_release release;
+                self.decide_masked_packed(p, mask, ret);
+            }
+            return ret;
+        },
+        "Bit-packed decisions "
+        "(unpack: ``numpy.unpackbits(ret, count=size, bitorder='little')``). "
+        "See :cpp:func:`prrng::GeneratorBase_array::decide_masked_packed`.",
+        py::arg("p"),
+        py::arg("mask")
+    );
+
+    cls.def(
+        "decide_indices",
+        [](Parent& self, const xt::pyarray<double>& p) {
+            py::gil_scoped_release release;
+            return self.decide_indices(p);
+        },
+        "Flat indices of accepted generators. "
+        "See :cpp:func:`prrng::GeneratorBase_array::decide_indices`.",
+        py::arg("p")
+    );
+
+    cls.def(
+        "decide_masked_indices",
+        [](Parent& self, const xt::pyarray<double>& p, const xt::pyarray<bool>& mask) {
+            py::gil_scoped_release release;
+            return self.decide_masked_indices(p, mask);
+        },
+        "Flat indices of accepted generators. "
+        "See :cpp:func:`prrng::GeneratorBase_array::decide_masked_indices`.",
+        py::arg("p"),
+        py::arg("mask")
     );
 
     cls.def(
         "random",
-        py::overload_cast<const std::vector<
-            size_t>&>(&Parent::template random<xt::pyarray<double>, std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.random(ishape, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::random`.",
         py::arg("ishape")
     );
 
+    cls.def(
+        "random",
+        py::overload_cast<const std::vector<size_t>&, pyarray_out&>(
+            &Parent::template random<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::random`.",
+        py::arg("ishape"),
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "randint",
         py::overload_cast<const std::vector<size_t>&, uint32_t>(&Parent::template randint<
@@ -143,44 +276,134 @@ void init_GeneratorBase_array(C& cls)
         py::arg("high")
     );
 
+    cls.def(
+        "fast_randint",
+        py::overload_cast<const std::vector<size_t>&, uint64_t>(&Parent::template fast_randint<
+                                                                xt::pyarray<uint64_t>,
+                                                                std::vector<size_t>,
+                                                                uint64_t>),
+        "ndarray of random integers (multiply-shift method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_randint`.",
+        py::arg("ishape"),
+        py::arg("high")
+    );
+
+    cls.def(
+        "fast_randint",
+        py::overload_cast<const std::vector<size_t>&, int64_t, int64_t>(
+            &Parent::template fast_randint<
+                xt::pyarray<int64_t>,
+                std::vector<size_t>,
+                int64_t,
+                int64_t>
+        ),
+        "ndarray of random integers (multiply-shift method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_randint`.",
+        py::arg("ishape"),
+        py::arg("low"),
+        py::arg("high")
+    );
+
     cls.def(
         "delta",
-        py::overload_cast<
-            const std::vector<size_t>&,
-            double>(&Parent::template delta<xt::pyarray<double>, std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.delta(ishape, scale, ret);
+            }
+            return ret;
+        },
         "ndarray equal to mean. This is not a random distribution!. "
         "See :cpp:func:`prrng::GeneratorBase_array::delta`.",
         py::arg("ishape"),
         py::arg("mean") = 1.0
     );
 
+    cls.def(
+        "delta",
+        py::overload_cast<const std::vector<size_t>&, double, pyarray_out&>(
+            &Parent::template delta<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray equal to mean. This is not a random distribution!. "
+        "See :cpp:func:`prrng::GeneratorBase_array::delta`.",
+        py::arg("ishape"),
+        py::arg("mean") = 1.0,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "exponential",
-        py::overload_cast<
-            const std::vector<size_t>&,
-            double>(&Parent::template exponential<xt::pyarray<double>, std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.exponential(ishape, scale, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a exponential distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::exponential`.",
         py::arg("ishape"),
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "exponential",
+        py::overload_cast<const std::vector<size_t>&, double, pyarray_out&>(
+            &Parent::template exponential<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a exponential distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::exponential`.",
+        py::arg("ishape"),
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "power",
-        py::overload_cast<
-            const std::vector<size_t>&,
-            double>(&Parent::template power<xt::pyarray<double>, std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double k) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.power(ishape, k, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a power distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::power`.",
         py::arg("ishape"),
         py::arg("k") = 1
     );
 
+    cls.def(
+        "power",
+        py::overload_cast<const std::vector<size_t>&, double, pyarray_out&>(
+            &Parent::template power<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a power distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::power`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "gamma",
-        py::overload_cast<const std::vector<size_t>&, double, double>(&Parent::template gamma<
-                                                                      xt::pyarray<double>,
-                                                                      std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.gamma(ishape, k, scale, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a gamma distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::gamma`.",
         py::arg("ishape"),
@@ -188,11 +411,31 @@ void init_GeneratorBase_array(C& cls)
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "gamma",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template gamma<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a gamma distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::gamma`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "pareto",
-        py::overload_cast<const std::vector<size_t>&, double, double>(&Parent::template pareto<
-                                                                      xt::pyarray<double>,
-                                                                      std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.pareto(ishape, k, scale, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a pareto distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::pareto`.",
         py::arg("ishape"),
@@ -200,11 +443,31 @@ void init_GeneratorBase_array(C& cls)
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "pareto",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template pareto<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a pareto distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::pareto`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "weibull",
-        py::overload_cast<const std::vector<size_t>&, double, double>(&Parent::template weibull<
-                                                                      xt::pyarray<double>,
-                                                                      std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.weibull(ishape, k, scale, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a weibull distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::weibull`.",
         py::arg("ishape"),
@@ -212,11 +475,31 @@ void init_GeneratorBase_array(C& cls)
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "weibull",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template weibull<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a weibull distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::weibull`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "normal",
-        py::overload_cast<const std::vector<size_t>&, double, double>(&Parent::template normal<
-                                                                      xt::pyarray<double>,
-                                                                      std::vector<size_t>>),
+        [](Parent& self, const std::vector<size_t>& ishape, double mu, double sigma) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.normal(ishape, mu, sigma, ret);
+            }
+            return ret;
+        },
         "ndarray of random numbers, distributed according to a normal distribution. "
         "See :cpp:func:`prrng::GeneratorBase_array::normal`.",
         py::arg("ishape"),
@@ -224,14 +507,249 @@ void init_GeneratorBase_array(C& cls)
         py::arg("sigma") = 1
     );
 
+    cls.def(
+        "normal",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template normal<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a normal distribution. "
+        "See :cpp:func:`prrng::GeneratorBase_array::normal`.",
+        py::arg("ishape"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_normal",
+        [](Parent& self, const std::vector<size_t>& ishape, double mu, double sigma) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_normal(ishape, mu, sigma, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to a normal distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_normal`.",
+        py::arg("ishape"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1
+    );
+
+    cls.def(
+        "fast_normal",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template fast_normal<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a normal distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_normal`.",
+        py::arg("ishape"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_exponential",
+        [](Parent& self, const std::vector<size_t>& ishape, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_exponential(ishape, scale, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to an exponential distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_exponential`.",
+        py::arg("ishape"),
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_exponential",
+        py::overload_cast<const std::vector<size_t>&, double, pyarray_out&>(
+            &Parent::template fast_exponential<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to an exponential distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_exponential`.",
+        py::arg("ishape"),
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_gamma",
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_gamma(ishape, k, scale, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to a gamma distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_gamma`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_gamma",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template fast_gamma<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a gamma distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_gamma`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_power",
+        [](Parent& self, const std::vector<size_t>& ishape, double k) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_power(ishape, k, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to a power distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_power`.",
+        py::arg("ishape"),
+        py::arg("k") = 1
+    );
+
+    cls.def(
+        "fast_power",
+        py::overload_cast<const std::vector<size_t>&, double, pyarray_out&>(
+            &Parent::template fast_power<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a power distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_power`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_pareto",
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_pareto(ishape, k, scale, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to a Pareto distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_pareto`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_pareto",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template fast_pareto<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a Pareto distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_pareto`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "fast_weibull",
+        [](Parent& self, const std::vector<size_t>& ishape, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(outer_shape(self, ishape));
+            {
+                py::gil_scoped_release release;
+                self.fast_weibull(ishape, k, scale, ret);
+            }
+            return ret;
+        },
+        "ndarray of random numbers, distributed according to a Weibull distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_weibull`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_weibull",
+        py::overload_cast<const std::vector<size_t>&, double, double, pyarray_out&>(
+            &Parent::template fast_weibull<std::vector<size_t>, pyarray_out>
+        ),
+        "ndarray of random numbers, distributed according to a Weibull distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase_array::fast_weibull`.",
+        py::arg("ishape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "cumsum_random",
-        &Parent::template cumsum_random<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_random(n, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_random`.",
         py::arg("n")
     );
 
+    cls.def(
+        "cumsum_random",
+        py::overload_cast<const xt::pyarray<size_t>&, pyarray_out&>(
+            &Parent::template cumsum_random<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_random`.",
+        py::arg("n"),
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "cumsum_delta",
         &Parent::template cumsum_delta<xt::pyarray<double>, xt::pyarray<size_t>>,
@@ -243,35 +761,110 @@ void init_GeneratorBase_array(C& cls)
 
     cls.def(
         "cumsum_exponential",
-        &Parent::template cumsum_exponential<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double scale, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_exponential(n, scale, exact, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_exponential`.",
         py::arg("n"),
-        py::arg("scale") = 1
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_exponential",
+        py::overload_cast<const xt::pyarray<size_t>&, double, bool, pyarray_out&>(
+            &Parent::template cumsum_exponential<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_exponential`.",
+        py::arg("n"),
+        py::arg("scale") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
     );
 
     cls.def(
         "cumsum_power",
-        &Parent::template cumsum_power<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double k) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_power(n, k, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_power`.",
         py::arg("n"),
         py::arg("k") = 1
     );
 
+    cls.def(
+        "cumsum_power",
+        py::overload_cast<const xt::pyarray<size_t>&, double, pyarray_out&>(
+            &Parent::template cumsum_power<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_power`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "cumsum_gamma",
-        &Parent::template cumsum_gamma<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_gamma(n, k, scale, exact, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_gamma`.",
         py::arg("n"),
         py::arg("k") = 1,
-        py::arg("scale") = 1
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_gamma",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, bool, pyarray_out&>(
+            &Parent::template cumsum_gamma<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_gamma`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
     );
 
     cls.def(
         "cumsum_pareto",
-        &Parent::template cumsum_pareto<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_pareto(n, k, scale, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_pareto`.",
         py::arg("n"),
@@ -279,9 +872,31 @@ void init_GeneratorBase_array(C& cls)
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "cumsum_pareto",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, pyarray_out&>(
+            &Parent::template cumsum_pareto<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_pareto`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "cumsum_weibull",
-        &Parent::template cumsum_weibull<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_weibull(n, k, scale, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_weibull`.",
         py::arg("n"),
@@ -289,14 +904,247 @@ void init_GeneratorBase_array(C& cls)
         py::arg("scale") = 1
     );
 
+    cls.def(
+        "cumsum_weibull",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, pyarray_out&>(
+            &Parent::template cumsum_weibull<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_weibull`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "cumsum_normal",
-        &Parent::template cumsum_normal<xt::pyarray<double>, xt::pyarray<size_t>>,
+        [](Parent& self, const xt::pyarray<size_t>& n, double mu, double sigma, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_normal(n, mu, sigma, exact, ret);
+            }
+            return ret;
+        },
         "Cumsum of ``n`` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase_array::cumsum_normal`.",
         py::arg("n"),
         py::arg("mu") = 0,
-        py::arg("sigma") = 1
+        py::arg("sigma") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_normal",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, bool, pyarray_out&>(
+            &Parent::template cumsum_normal<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_normal`.",
+        py::arg("n"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_normal",
+        [](Parent& self, const xt::pyarray<size_t>& n, double mu, double sigma, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_normal(n, mu, sigma, exact, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_normal`.",
+        py::arg("n"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_normal",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, bool, pyarray_out&>(
+            &Parent::template cumsum_fast_normal<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_normal`.",
+        py::arg("n"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_exponential",
+        [](Parent& self, const xt::pyarray<size_t>& n, double scale, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_exponential(n, scale, exact, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_exponential`.",
+        py::arg("n"),
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_exponential",
+        py::overload_cast<const xt::pyarray<size_t>&, double, bool, pyarray_out&>(
+            &Parent::template cumsum_fast_exponential<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_exponential`.",
+        py::arg("n"),
+        py::arg("scale") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_gamma",
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale, bool exact) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_gamma(n, k, scale, exact, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_gamma`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_gamma",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, bool, pyarray_out&>(
+            &Parent::template cumsum_fast_gamma<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_gamma`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::arg("exact") = true,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_power",
+        [](Parent& self, const xt::pyarray<size_t>& n, double k) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_power(n, k, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_power`.",
+        py::arg("n"),
+        py::arg("k") = 1
+    );
+
+    cls.def(
+        "cumsum_fast_power",
+        py::overload_cast<const xt::pyarray<size_t>&, double, pyarray_out&>(
+            &Parent::template cumsum_fast_power<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_power`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_pareto",
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_pareto(n, k, scale, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_pareto`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "cumsum_fast_pareto",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, pyarray_out&>(
+            &Parent::template cumsum_fast_pareto<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_pareto`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "cumsum_fast_weibull",
+        [](Parent& self, const xt::pyarray<size_t>& n, double k, double scale) {
+            xt::pyarray<double> ret = xt::pyarray<double>::from_shape(self.shape());
+            {
+                py::gil_scoped_release release;
+                self.cumsum_fast_weibull(n, k, scale, ret);
+            }
+            return ret;
+        },
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_weibull`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "cumsum_fast_weibull",
+        py::overload_cast<const xt::pyarray<size_t>&, double, double, pyarray_out&>(
+            &Parent::template cumsum_fast_weibull<xt::pyarray<size_t>, pyarray_out>
+        ),
+        "Cumsum of ``n`` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase_array::cumsum_fast_weibull`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::kw_only(),
+        py::arg("out").noconvert(),
+        py::call_guard<py::gil_scoped_release>()
     );
 }
 
@@ -361,12 +1209,22 @@ void init_pcg32_arrayBase(C& cls)
         py::arg("arg")
     );
 
+    cls.def(
+        "advance",
+        &Parent::template advance<int64_t>,
+        "Advance all generators by the same distance. "
+        "See :cpp:func:`prrng::pcg32_arrayBase::advance`.",
+        py::arg("distance"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "advance",
         &Parent::template advance<xt::pyarray<uint64_t>>,
         "Advance generators. "
         "See :cpp:func:`prrng::pcg32_arrayBase::advance`.",
-        py::arg("distance")
+        py::arg("distance"),
+        py::call_guard<py::gil_scoped_release>()
     );
 
     cls.def(
@@ -374,13 +1232,57 @@ void init_pcg32_arrayBase(C& cls)
         &Parent::template restore<xt::pyarray<uint64_t>>,
         "Restore state. "
         "See :cpp:func:`prrng::pcg32_arrayBase::restore`.",
-        py::arg("state")
+        py::arg("state"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "serialize",
+        [](const Parent& self) {
+            std::vector<char> ret = self.serialize();
+            return py::bytes(ret.data(), ret.size());
+        },
+        "Serialize to a binary blob. "
+        "See :cpp:func:`prrng::pcg32_arrayBase::serialize`."
+    );
+
+    cls.def(
+        "deserialize",
+        [](Parent& self, const py::buffer& buffer) {
+            blob_view blob(buffer);
+            return self.deserialize(blob.data(), blob.size());
+        },
+        "Restore from a binary blob (e.g. ``bytes`` or a ``numpy.memmap``). "
+        "See :cpp:func:`prrng::pcg32_arrayBase::deserialize`.",
+        py::arg("buffer")
     );
 }
 
 template <class C, class Parent, class Data, class State, class Value, class Index>
 void init_pcg32_arrayBase_chunkBase(C& cls)
 {
+    cls.def(
+        "statistics",
+        static_cast<prrng::chunk_statistics (Parent::*)() const>(&Parent::statistics),
+        "Statistics of the moves of all chunks. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::statistics`."
+    );
+
+    cls.def(
+        "statistics",
+        static_cast<prrng::chunk_statistics (Parent::*)(size_t) const>(&Parent::statistics),
+        "Statistics of the moves of the chunk of one generator. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::statistics`.",
+        py::arg("index")
+    );
+
+    cls.def(
+        "reset_statistics",
+        &Parent::reset_statistics,
+        "Reset the statistics. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::reset_statistics`."
+    );
+
     cls.def(
         "__iadd__",
         [](Parent& a, const Data& b) -> Parent& {
@@ -420,6 +1322,7 @@ void init_pcg32_arrayBase_chunkBase(C& cls)
     cls.def_property_readonly("generators", &Parent::generators);
     cls.def_property_readonly("is_extendible", &Parent::is_extendible);
     cls.def_property_readonly("chunk_size", &Parent::chunk_size);
+    cls.def_property_readonly("alignment_settings", &Parent::alignment_settings);
     cls.def_property("data", &Parent::data, &Parent::set_data);
     cls.def_property("start", &Parent::start, &Parent::set_start);
     cls.def_property_readonly("index_at_align", &Parent::index_at_align);
@@ -433,7 +1336,65 @@ void init_pcg32_arrayBase_chunkBase(C& cls)
         py::arg("index")
     );
 
-    cls.def("align_at", &Parent::align_at, py::arg("index"));
+    cls.def(
+        "align_at",
+        &Parent::align_at,
+        py::arg("index"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    cls.def(
+        "resize",
+        &Parent::resize,
+        "Change the chunk size, keeping the start. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::resize`.",
+        py::arg("n")
+    );
+
+    cls.def(
+        "serialize",
+        [](const Parent& self, bool with_data) {
+            std::vector<char> ret = self.serialize(with_data);
+            return py::bytes(ret.data(), ret.size());
+        },
+        "Serialize to a binary blob. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::serialize`.",
+        py::arg("with_data") = true
+    );
+
+    cls.def(
+        "deserialize",
+        [](Parent& self, const py::buffer& buffer) {
+            blob_view blob(buffer);
+            return self.deserialize(blob.data(), blob.size());
+        },
+        "Restore from a binary blob (e.g. ``bytes`` or a ``numpy.memmap``). "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::deserialize`.",
+        py::arg("buffer")
+    );
+
+    cls.def(
+        "serialize_row",
+        [](const Parent& self, size_t i) {
+            std::vector<char> ret = self.serialize_row(i);
+            return py::bytes(ret.data(), ret.size());
+        },
+        "Serialize one generator and its chunk to a binary blob. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::serialize_row`.",
+        py::arg("i")
+    );
+
+    cls.def(
+        "deserialize_row",
+        [](Parent& self, size_t i, const py::buffer& buffer) {
+            blob_view blob(buffer);
+            return self.deserialize_row(i, blob.data(), blob.size());
+        },
+        "Restore one generator and its chunk from a binary blob. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::deserialize_row`.",
+        py::arg("i"),
+        py::arg("buffer")
+    );
 
     cls.def_property_readonly(
         "left_of_align", py::overload_cast<>(&Parent::template left_of_align<Value>, py::const_)
@@ -451,7 +1412,8 @@ void init_pcg32_arrayBase_chunk(C& cls)
         &Parent::template restore<State, Index>,
         "Restore state.",
         py::arg("state"),
-        py::arg("index")
+        py::arg("index"),
+        py::call_guard<py::gil_scoped_release>()
     );
 }
 
@@ -464,22 +1426,51 @@ void init_pcg32_arrayBase_cumsum(C& cls)
         "Restore state.",
         py::arg("state"),
         py::arg("value"),
-        py::arg("index")
+        py::arg("index"),
+        py::call_guard<py::gil_scoped_release>()
     );
 
+    // resizing (by adaptation) allocates the chunk: the GIL is only released without adaptation
     cls.def(
         "align",
-        py::overload_cast<const Value&>(&Parent::template align<Value>),
+        [](Parent& self, const Value& target) {
+            if (self.adaptation_settings().max_size > 0) {
+                self.align(target);
+                return;
+            }
+            py::gil_scoped_release release;
+            self.align(target);
+        },
         "Align chunk with target.",
         py::arg("target")
     );
 
+    cls.def(
+        "align",
+        &Parent::template align<xt::pytensor<size_t, 1>, xt::pytensor<double, 1>>,
+        "Align a subset of chunks (flat indices) with their targets.",
+        py::arg("index"),
+        py::arg("target"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     cls.def(
         "contains",
         &Parent::template contains<Value>,
         "Check is target is contained in the chunk.",
         py::arg("target")
     );
+
+    cls.def(
+        "set_adaptation",
+        &Parent::set_adaptation,
+        "Adapt the chunk size to the displacement of the targets. "
+        "See :cpp:func:`prrng::pcg32_arrayBase_cumsum::set_adaptation`.",
+        py::arg("adapt")
+    );
+
+    cls.def_property_readonly("adaptation_settings", &Parent::adaptation_settings);
+    cls.def_property_readonly("velocity", &Parent::velocity);
 }
 
 template <class C, class Parent>
@@ -508,7 +1499,8 @@ void init_GeneratorBase(C& cls)
         "The result of the cumsum of `n` random numbers. "
         "See :cpp:func:`prrng::GeneratorBase::cumsum_exponential`.",
         py::arg("n"),
-        py::arg("scale") = 1
+        py::arg("scale") = 1,
+        py::arg("exact") = true
     );
 
     cls.def(
@@ -524,40 +1516,103 @@ void init_GeneratorBase(C& cls)
         "cumsum_gamma",
         &Parent::cumsum_gamma,
         "The result of the cumsum of `n` random numbers. "
-        "See :cpp:func:`prrng::GeneratorBase::cumsum_gamma`.",
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_gamma`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_pareto",
+        &Parent::cumsum_pareto,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_pareto`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "cumsum_weibull",
+        &Parent::cumsum_weibull,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_weibull`.",
+        py::arg("n"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "cumsum_normal",
+        &Parent::cumsum_normal,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_normal`.",
+        py::arg("n"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_normal",
+        &Parent::cumsum_fast_normal,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_normal`.",
+        py::arg("n"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_exponential",
+        &Parent::cumsum_fast_exponential,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_exponential`.",
+        py::arg("n"),
+        py::arg("scale") = 1,
+        py::arg("exact") = true
+    );
+
+    cls.def(
+        "cumsum_fast_gamma",
+        &Parent::cumsum_fast_gamma,
+        "The result of the cumsum of `n` random numbers. "
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_gamma`.",
         py::arg("n"),
         py::arg("k") = 1,
-        py::arg("scale") = 1
+        py::arg("scale") = 1,
+        py::arg("exact") = true
     );
 
     cls.def(
-        "cumsum_pareto",
-        &Parent::cumsum_pareto,
+        "cumsum_fast_power",
+        &Parent::cumsum_fast_power,
         "The result of the cumsum of `n` random numbers. "
-        "See :cpp:func:`prrng::GeneratorBase::cumsum_pareto`.",
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_power`.",
         py::arg("n"),
-        py::arg("k") = 1,
-        py::arg("scale") = 1
+        py::arg("k") = 1
     );
 
     cls.def(
-        "cumsum_weibull",
-        &Parent::cumsum_weibull,
+        "cumsum_fast_pareto",
+        &Parent::cumsum_fast_pareto,
         "The result of the cumsum of `n` random numbers. "
-        "See :cpp:func:`prrng::GeneratorBase::cumsum_weibull`.",
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_pareto`.",
         py::arg("n"),
         py::arg("k") = 1,
         py::arg("scale") = 1
     );
 
     cls.def(
-        "cumsum_normal",
-        &Parent::cumsum_normal,
+        "cumsum_fast_weibull",
+        &Parent::cumsum_fast_weibull,
         "The result of the cumsum of `n` random numbers. "
-        "See :cpp:func:`prrng::GeneratorBase::cumsum_normal`.",
+        "See :cpp:func:`prrng::GeneratorBase::cumsum_fast_weibull`.",
         py::arg("n"),
-        py::arg("mu") = 0,
-        py::arg("sigma") = 1
+        py::arg("k") = 1,
+        py::arg("scale") = 1
     );
 
     cls.def(
@@ -645,6 +1700,34 @@ void init_GeneratorBase(C& cls)
         py::arg("high")
     );
 
+    cls.def(
+        "fast_randint",
+        py::overload_cast<const std::vector<size_t>&, uint64_t>(&Parent::template fast_randint<
+                                                                xt::pyarray<uint64_t>,
+                                                                std::vector<size_t>,
+                                                                uint64_t>),
+        "ndarray of random integers (multiply-shift method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_randint`.",
+        py::arg("shape"),
+        py::arg("high")
+    );
+
+    cls.def(
+        "fast_randint",
+        py::overload_cast<const std::vector<size_t>&, int64_t, int64_t>(
+            &Parent::template fast_randint<
+                xt::pyarray<int64_t>,
+                std::vector<size_t>,
+                int64_t,
+                int64_t>
+        ),
+        "ndarray of random integers (multiply-shift method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_randint`.",
+        py::arg("shape"),
+        py::arg("low"),
+        py::arg("high")
+    );
+
     cls.def(
         "delta",
         py::overload_cast<
@@ -726,6 +1809,86 @@ void init_GeneratorBase(C& cls)
         py::arg("sigma") = 1
     );
 
+    cls.def(
+        "fast_normal",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double,
+            double>(&Parent::template fast_normal<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to a normal distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_normal`.",
+        py::arg("shape"),
+        py::arg("mu") = 0,
+        py::arg("sigma") = 1
+    );
+
+    cls.def(
+        "fast_exponential",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double>(&Parent::template fast_exponential<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to an exponential distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_exponential`.",
+        py::arg("shape"),
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_gamma",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double,
+            double>(&Parent::template fast_gamma<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to a gamma distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_gamma`.",
+        py::arg("shape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_power",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double>(&Parent::template fast_power<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to a power distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_power`.",
+        py::arg("shape"),
+        py::arg("k") = 1
+    );
+
+    cls.def(
+        "fast_pareto",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double,
+            double>(&Parent::template fast_pareto<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to a Pareto distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_pareto`.",
+        py::arg("shape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
+    cls.def(
+        "fast_weibull",
+        py::overload_cast<
+            const std::vector<size_t>&,
+            double,
+            double>(&Parent::template fast_weibull<xt::pyarray<double>, std::vector<size_t>>),
+        "ndarray of random numbers, distributed according to a Weibull distribution "
+        "(fast method). "
+        "See :cpp:func:`prrng::GeneratorBase::fast_weibull`.",
+        py::arg("shape"),
+        py::arg("k") = 1,
+        py::arg("scale") = 1
+    );
+
     cls.def(
         "draw",
         static_cast<double (Parent::*)(enum prrng::distribution, std::vector<double>, bool)>(
@@ -862,22 +2025,73 @@ PYBIND11_MODULE(_prrng, m)
     py::class_<prrng::alignment>(m, "alignment")
 
         .def(
-            py::init<ptrdiff_t, ptrdiff_t, ptrdiff_t, bool>(),
+            py::init<ptrdiff_t, ptrdiff_t, ptrdiff_t, bool, bool, ptrdiff_t, bool>(),
             "Default alignment settings. "
             "See :cpp:class:`prrng::alignment`.",
             py::arg("buffer") = 0,
             py::arg("margin") = 0,
             py::arg("min_margin") = 0,
-            py::arg("strict") = false
+            py::arg("strict") = false,
+            py::arg("sample_skip") = false,
+            py::arg("slack") = 0,
+            py::arg("lazy") = false
         )
 
         .def_readwrite("buffer", &prrng::alignment::buffer)
         .def_readwrite("margin", &prrng::alignment::margin)
         .def_readwrite("min_margin", &prrng::alignment::min_margin)
         .def_readwrite("strict", &prrng::alignment::strict)
+        .def_readwrite("sample_skip", &prrng::alignment::sample_skip)
+        .def_readwrite("slack", &prrng::alignment::slack)
+        .def_readwrite("lazy", &prrng::alignment::lazy)
 
         .def("__repr__", [](const prrng::alignment&) { return "<prrng.alignment>"; });
 
+    py::class_<prrng::adaptation>(m, "adaptation")
+
+        .def(
+            py::init<size_t, size_t, double, double, double, bool>(),
+            "Default adaptation settings (no adaptation). "
+            "See :cpp:class:`prrng::adaptation`.",
+            py::arg("min_size") = 0,
+            py::arg("max_size") = 0,
+            py::arg("grow") = 0.5,
+            py::arg("shrink") = 0.05,
+            py::arg("smoothing") = 0.2,
+            py::arg("tune_alignment") = false
+        )
+
+        .def_readwrite("min_size", &prrng::adaptation::min_size)
+        .def_readwrite("max_size", &prrng::adaptation::max_size)
+        .def_readwrite("grow", &prrng::adaptation::grow)
+        .def_readwrite("shrink", &prrng::adaptation::shrink)
+        .def_readwrite("smoothing", &prrng::adaptation::smoothing)
+        .def_readwrite("tune_alignment", &prrng::adaptation::tune_alignment)
+
+        .def("__repr__", [](const prrng::adaptation&) { return "<prrng.adaptation>"; });
+
+    py::class_<prrng::chunk_statistics>(m, "chunk_statistics")
+
+        .def(py::init<>(), "See :cpp:class:`prrng::chunk_statistics`.")
+
+        .def_readonly("drawn", &prrng::chunk_statistics::drawn)
+        .def_readonly("summed", &prrng::chunk_statistics::summed)
+        .def_readonly("jumps", &prrng::chunk_statistics::jumps)
+        .def_readonly("advanced", &prrng::chunk_statistics::advanced)
+        .def_readonly("shifts", &prrng::chunk_statistics::shifts)
+        .def_readonly("aligns", &prrng::chunk_statistics::aligns)
+        .def_readonly("recursions", &prrng::chunk_statistics::recursions)
+        .def_readonly("depth", &prrng::chunk_statistics::depth)
+        .def_readonly("max_depth", &prrng::chunk_statistics::max_depth)
+        .def_readonly("search_hits", &prrng::chunk_statistics::search_hits)
+        .def_readonly("search_misses", &prrng::chunk_statistics::search_misses)
+        .def_readonly("prefetched", &prrng::chunk_statistics::prefetched)
+
+        .def(
+            "__repr__",
+            [](const prrng::chunk_statistics&) { return "<prrng.chunk_statistics>"; }
+        );
+
     py::enum_<prrng::distribution>(m, "distribution")
         .value("random", prrng::distribution::random)
         .value("delta", prrng::distribution::delta)
@@ -887,6 +2101,12 @@ PYBIND11_MODULE(_prrng, m)
         .value("pareto", prrng::distribution::pareto)
         .value("weibull", prrng::distribution::weibull)
         .value("normal", prrng::distribution::normal)
+        .value("fast_normal", prrng::distribution::fast_normal)
+        .value("fast_exponential", prrng::distribution::fast_exponential)
+        .value("fast_gamma", prrng::distribution::fast_gamma)
+        .value("fast_power", prrng::distribution::fast_power)
+        .value("fast_pareto", prrng::distribution::fast_pareto)
+        .value("fast_weibull", prrng::distribution::fast_weibull)
         .value("custom", prrng::distribution::custom)
         .export_values();
 
@@ -1360,6 +2580,20 @@ PYBIND11_MODULE(_prrng, m)
             "Value of the cumsum just right of ``target`` (last time ``align`` was called)."
         )
 
+        .def(
+            "statistics",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::statistics,
+            "Statistics of the moves of the chunk. "
+            "See :cpp:func:`prrng::pcg32_cumsum::statistics`."
+        )
+
+        .def(
+            "reset_statistics",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::reset_statistics,
+            "Reset the statistics. "
+            "See :cpp:func:`prrng::pcg32_cumsum::reset_statistics`."
+        )
+
         .def(
             "state_at",
             &prrng::pcg32_cumsum<xt::pyarray<double>>::state_at,
@@ -1369,15 +2603,97 @@ PYBIND11_MODULE(_prrng, m)
 
         .def(
             "restore",
-            &prrng::pcg32_cumsum<xt::pyarray<double>>::restore,
+            [](prrng::pcg32_cumsum<xt::pyarray<double>>& self, uint64_t state, double value,
+               ptrdiff_t index) {
+                if (self.has_functions()) {
+                    self.restore(state, value, index);
+                    return;
+                }
+                py::gil_scoped_release release;
+                self.restore(state, value, index);
+            },
             py::arg("state"),
             py::arg("value"),
             py::arg("index")
         )
 
-        .def("prev", &prrng::pcg32_cumsum<xt::pyarray<double>>::prev, py::arg("margin") = 0)
-        .def("next", &prrng::pcg32_cumsum<xt::pyarray<double>>::next, py::arg("margin") = 0)
-        .def("align", &prrng::pcg32_cumsum<xt::pyarray<double>>::align, py::arg("target"))
+        .def(
+            "prev",
+            [](prrng::pcg32_cumsum<xt::pyarray<double>>& self, size_t margin) {
+                if (self.has_functions()) {
+                    self.prev(margin);
+                    return;
+                }
+                py::gil_scoped_release release;
+                self.prev(margin);
+            },
+            py::arg("margin") = 0
+        )
+
+        .def(
+            "next",
+            [](prrng::pcg32_cumsum<xt::pyarray<double>>& self, size_t margin) {
+                if (self.has_functions()) {
+                    self.next(margin);
+                    return;
+                }
+                py::gil_scoped_release release;
+                self.next(margin);
+            },
+            py::arg("margin") = 0
+        )
+
+        .def(
+            "align",
+            [](prrng::pcg32_cumsum<xt::pyarray<double>>& self, double target) {
+                if (self.adaptation_settings().max_size > 0 || self.has_functions()) {
+                    self.align(target);
+                    return;
+                }
+                py::gil_scoped_release release;
+                self.align(target);
+            },
+            py::arg("target")
+        )
+
+        .def(
+            "resize",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::resize,
+            "Change the chunk size, keeping the start. "
+            "See :cpp:func:`prrng::pcg32_cumsum::resize`.",
+            py::arg("n")
+        )
+
+        .def(
+            "set_adaptation",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::set_adaptation,
+            "Adapt the chunk size to the displacement of the target. "
+            "See :cpp:func:`prrng::pcg32_cumsum::set_adaptation`.",
+            py::arg("adapt")
+        )
+
+        .def(
+            "set_prefetch",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::set_prefetch,
+            "Prefetch the next chunk on a background thread. "
+            "See :cpp:func:`prrng::pcg32_cumsum::set_prefetch`.",
+            py::arg("prefetch")
+        )
+
+        .def_property_readonly("prefetch", &prrng::pcg32_cumsum<xt::pyarray<double>>::prefetch)
+
+        .def_property_readonly(
+            "adaptation_settings",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::adaptation_settings
+        )
+
+        .def_property_readonly(
+            "alignment_settings",
+            &prrng::pcg32_cumsum<xt::pyarray<double>>::alignment_settings
+        )
+
+        .def_property_readonly("velocity", &prrng::pcg32_cumsum<xt::pyarray<double>>::velocity)
+
         .def("contains", &prrng::pcg32_cumsum<xt::pyarray<double>>::contains, py::arg("target"))
 
         .def("__repr__", [](const prrng::pcg32_cumsum<xt::pyarray<double>>&) {
@@ -1611,6 +2927,78 @@ PYBIND11_MODULE(_prrng, m)
         cls.def("__repr__", [](const Parent&) { return "<prrng.pcg32_array_cumsum>"; });
     }
 
+    {
+        using Data = xt::pytensor<double, 2>;
+        using Index = xt::pytensor<ptrdiff_t, 1>;
+        using Parent = prrng::pcg32_array_partitioned_cumsum<Data, Index>;
+        using State = xt::pytensor<uint64_t, 1>;
+        using Value = xt::pytensor<double, 1>;
+        using Class = py::class_<Parent>;
+
+        Class cls(m, "pcg32_array_partitioned_cumsum");
+
+        cls.def(
+            py::init<
+                const std::vector<size_t>&,
+                const State&,
+                const State&,
+                size_t,
+                prrng::distribution,
+                const std::vector<double>&,
+                const prrng::alignment&>(),
+            "Partition (owned rows) of an array of random number generators. "
+            "See :cpp:class:`prrng::pcg32_array_partitioned_cumsum`.",
+            py::arg("shape"),
+            py::arg("initstate"),
+            py::arg("initseq"),
+            py::arg("offset"),
+            py::arg("distribution"),
+            py::arg("parameters"),
+            py::arg("align") = prrng::alignment()
+        );
+
+        init_pcg32_arrayBase_chunkBase<Class, Parent, Data, State, Value, Index>(cls);
+        init_pcg32_arrayBase_cumsum<Class, Parent, Data, State, Value, Index>(cls);
+
+        cls.def_property_readonly("rows", &Parent::rows);
+        cls.def("owns", &Parent::owns, "Check if a row is owned.", py::arg("row"));
+        cls.def(
+            "local_index", &Parent::local_index, "Local index of an owned row.", py::arg("row")
+        );
+
+        cls.def(
+            "serialize_rows",
+            [](const Parent& self, const std::vector<size_t>& rows) {
+                std::vector<char> ret = self.serialize_rows(rows);
+                return py::bytes(ret.data(), ret.size());
+            },
+            "Serialize owned rows to a binary blob. "
+            "See :cpp:func:`prrng::pcg32_array_partitioned_cumsum::serialize_rows`.",
+            py::arg("rows")
+        );
+
+        cls.def(
+            "insert_rows",
+            [](Parent& self, const py::buffer& buffer) {
+                blob_view blob(buffer);
+                return self.insert_rows(blob.data(), blob.size());
+            },
+            "Add the rows of a binary blob. "
+            "See :cpp:func:`prrng::pcg32_array_partitioned_cumsum::insert_rows`.",
+            py::arg("buffer")
+        );
+
+        cls.def(
+            "erase_rows",
+            &Parent::template erase_rows<std::vector<size_t>>,
+            "Remove owned rows. "
+            "See :cpp:func:`prrng::pcg32_array_partitioned_cumsum::erase_rows`.",
+            py::arg("rows")
+        );
+
+        cls.def("__repr__", [](const Parent&) { return "<prrng.pcg32_array_partitioned_cumsum>"; });
+    }
+
     {
         using Data = xt::pytensor<double, 2>;
         using Index = xt::pytensor<ptrdiff_t, 1>;
@@ -1683,4 +3071,173 @@ PYBIND11_MODULE(_prrng, m)
         cls.def("__repr__", [](const Parent&) { return "<prrng.pcg32_tensor_cumsum_2_1>"; });
     }
 
+    {
+        using Data = xt::pytensor<double, 1>;
+        using Index = xt::pyarray<ptrdiff_t>;
+        using Parent = prrng::pcg32_array_ragged_cumsum<Data, Index>;
+        using State = xt::pyarray<uint64_t>;
+        using Value = xt::pyarray<double>;
+        using Class = py::class_<Parent>;
+
+        Class cls(m, "pcg32_array_ragged_cumsum");
+
+        cls.def(
+            py::init<
+                const xt::pyarray<size_t>&,
+                const State&,
+                const State&,
+                prrng::distribution,
+                const std::vector<double>&,
+                const prrng::alignment&>(),
+            "Cumulative sum of an array of random number generators, "
+            "with a chunk of a different size per generator. "
+            "See :cpp:class:`prrng::pcg32_array_ragged_cumsum`.",
+            py::arg("sizes"),
+            py::arg("initstate"),
+            py::arg("initseq"),
+            py::arg("distribution"),
+            py::arg("parameters"),
+            py::arg("align") = prrng::alignment()
+        );
+
+        cls.def_property_readonly("generators", &Parent::generators);
+        cls.def_property_readonly("offsets", &Parent::offsets);
+        cls.def_property_readonly("data", &Parent::data);
+        cls.def_property_readonly("start", &Parent::start);
+        cls.def_property_readonly("index_at_align", &Parent::index_at_align);
+        cls.def_property_readonly("chunk_index_at_align", &Parent::chunk_index_at_align);
+        cls.def_property_readonly(
+            "left_of_align", py::overload_cast<>(&Parent::template left_of_align<Value>, py::const_)
+        );
+        cls.def_property_readonly(
+            "right_of_align",
+            py::overload_cast<>(&Parent::template right_of_align<Value>, py::const_)
+        );
+
+        cls.def(
+            "chunk_size",
+            &Parent::chunk_size,
+            "Size of the chunk of one generator (flat index).",
+            py::arg("index")
+        );
+
+        cls.def(
+            "chunk",
+            [](const Parent& self, size_t i) {
+                const auto& offsets = self.offsets();
+                auto chunk = xt::view(self.data(), xt::range(offsets[i], offsets[i + 1]));
+                return xt::pytensor<double, 1>(chunk);
+            },
+            "Copy of the chunk of one generator (flat index).",
+            py::arg("index")
+        );
+
+        cls.def(
+            "statistics",
+            &Parent::statistics,
+            "Statistics of the moves of all chunks. "
+            "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::statistics`."
+        );
+
+        cls.def("reset_statistics", &Parent::reset_statistics, "Reset the statistics.");
+
+        cls.def(
+            "align",
+            &Parent::template align<Value>,
+            "Align chunk with target.",
+            py::arg("target"),
+            py::call_guard<py::gil_scoped_release>()
+        );
+
+        cls.def(
+            "align_at",
+            &Parent::align_at,
+            "Align chunk with index.",
+            py::arg("index"),
+            py::call_guard<py::gil_scoped_release>()
+        );
+
+        cls.def(
+            "contains",
+            &Parent::template contains<Value>,
+            "Check is target is contained in the chunk.",
+            py::arg("target")
+        );
+
+        cls.def("__repr__", [](const Parent&) { return "<prrng.pcg32_array_ragged_cumsum>"; });
+    }
+
+    {
+        using Data = xt::pyarray<double>;
+        using Index = xt::pyarray<ptrdiff_t>;
+        using Parent = prrng::pcg32_array_multi_cumsum<Data, Index>;
+        using State = xt::pyarray<uint64_t>;
+        using Value = xt::pyarray<double>;
+        using Class = py::class_<Parent>;
+
+        Class cls(m, "pcg32_array_multi_cumsum");
+
+        cls.def(
+            py::init<
+                size_t,
+                size_t,
+                const State&,
+                const State&,
+                prrng::distribution,
+                const std::vector<double>&,
+                const prrng::alignment&>(),
+            "Cumulative sums of several channels per random number generator of an array, "
+            "whereby the channels share the generator and the chunk. "
+            "See :cpp:class:`prrng::pcg32_array_multi_cumsum`.",
+            py::arg("size"),
+            py::arg("channels"),
+            py::arg("initstate"),
+            py::arg("initseq"),
+            py::arg("distribution"),
+            py::arg("parameters"),
+            py::arg("align") = prrng::alignment()
+        );
+
+        cls.def_property_readonly("generators", &Parent::generators);
+        cls.def_property_readonly("size", &Parent::size);
+        cls.def_property_readonly("channels", &Parent::channels);
+        cls.def_property_readonly("data", &Parent::data);
+        cls.def_property_readonly("start", &Parent::start);
+        cls.def_property_readonly("index_at_align", &Parent::index_at_align);
+        cls.def_property_readonly("chunk_index_at_align", &Parent::chunk_index_at_align);
+        cls.def_property_readonly(
+            "left_of_align", py::overload_cast<>(&Parent::template left_of_align<Value>, py::const_)
+        );
+        cls.def_property_readonly(
+            "right_of_align",
+            py::overload_cast<>(&Parent::template right_of_align<Value>, py::const_)
+        );
+
+        cls.def(
+            "statistics",
+            &Parent::statistics,
+            "Statistics of the moves of all chunks. "
+            "See :cpp:func:`prrng::pcg32_arrayBase_chunkBase::statistics`."
+        );
+
+        cls.def("reset_statistics", &Parent::reset_statistics, "Reset the statistics.");
+
+        cls.def(
+            "align",
+            &Parent::template align<Value>,
+            "Align chunk with the target of each channel.",
+            py::arg("target"),
+            py::call_guard<py::gil_scoped_release>()
+        );
+
+        cls.def(
+            "contains",
+            &Parent::template contains<Value>,
+            "Check is the target of each channel is contained in the chunk.",
+            py::arg("target")
+        );
+
+        cls.def("__repr__", [](const Parent&) { return "<prrng.pcg32_array_multi_cumsum>"; });
+    }
+
 } // PYBIND11_MODULE
@@ -1,10 +1,17 @@
 #include <catch2/catch_all.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <iostream>
 #include <prrng.h>
+
 #include <xtensor/xio.hpp>
 #include <xtensor/xtensor.hpp>
+#include <xtensor/xview.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 template <class T>
 inline xt::xtensor<uint32_t, 1> myget_n(T& generator, size_t n)
@@ -84,6 +91,52 @@ TEST_CASE("prrng::pgc32", "prrng.h")
         REQUIRE(xt::all(xt::equal(a, b)));
     }
 
+    SECTION("basic - advance using stride")
+    {
+        auto seed = std::time(0);
+
+        prrng::pcg32 gen(seed);
+        prrng::pcg32 regen(seed);
+        prrng::pcg32_stride stride(345);
+
+        for (size_t i = 0; i < 10; ++i) {
+            gen.advance(stride);
+            regen.advance(345);
+            REQUIRE(gen == regen);
+        }
+
+        REQUIRE(gen.distance(prrng::pcg32(seed)) == 10 * 345);
+        gen.advance(prrng::pcg32_stride(-10 * 345));
+        REQUIRE(gen == prrng::pcg32(seed));
+
+        prrng::pcg32_index igen(seed);
+        prrng::pcg32 ref(seed);
+
+        prrng::pcg32_index jgen(seed);
+        prrng::pcg32_stride jump;
+
+        for (ptrdiff_t index : {100, 200, 300, 250, 200, 1000}) {
+            igen.jump_to(index);
+            jgen.jump_to(index, jump);
+            ref.restore(prrng::pcg32(seed).state());
+            ref.advance(index);
+            REQUIRE(igen == ref);
+            REQUIRE(igen.index() == index);
+            REQUIRE(jgen == ref);
+            REQUIRE(jgen.index() == index);
+        }
+
+        // the last jump is kept by the caller
+        REQUIRE(jump.distance() == 800);
+
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(5);
+        prrng::pcg32_array agen(seeds);
+        prrng::pcg32_array aregen(seeds);
+        agen.advance(-12);
+        aregen.advance(xt::xtensor<int64_t, 1>(-12 * xt::ones<int64_t>({5})));
+        REQUIRE(xt::all(xt::equal(agen.state(), aregen.state())));
+    }
+
     SECTION("random - scalar")
     {
         auto seed = std::time(0);
@@ -172,6 +225,55 @@ TEST_CASE("prrng::pgc32", "prrng.h")
         REQUIRE(xt::allclose(a, c));
     }
 
+    SECTION("fast_normal, fast_exponential, fast_gamma - scalar/cumsum")
+    {
+        auto seed = std::time(0);
+        prrng::pcg32 generator(seed);
+        size_t n = 1000;
+
+        auto a = generator.fast_normal(1.2, 0.1);
+        auto b = generator.fast_exponential(1.2);
+        auto c = generator.fast_gamma(0.4, 1.2);
+
+        generator.advance(-3);
+        REQUIRE(a == generator.fast_normal({1}, 1.2, 0.1)(0));
+        REQUIRE(b == generator.fast_exponential({1}, 1.2)(0));
+        REQUIRE(c == generator.fast_gamma({1}, 0.4, 1.2)(0));
+
+        auto x = generator.fast_normal({n}, 1.2, 0.1);
+        generator.advance(-n);
+        REQUIRE(xt::allclose(xt::cumsum(x)(n - 1), generator.cumsum_fast_normal(n, 1.2, 0.1)));
+
+        auto y = generator.fast_gamma({n}, 2.5, 1.2);
+        generator.advance(-n);
+        REQUIRE(xt::allclose(xt::cumsum(y)(n - 1), generator.cumsum_fast_gamma(n, 2.5, 1.2)));
+
+        generator.advance(-n);
+        std::array<size_t, 1> shape = {n};
+        REQUIRE(xt::allclose(
+            y, generator.draw<xt::xtensor<double, 1>>(shape, prrng::fast_gamma, {2.5, 1.2, 0.0})
+        ));
+    }
+
+    SECTION("fast_normal, fast_exponential, fast_gamma - mean")
+    {
+        prrng::pcg32 gen;
+        size_t n = 1000000;
+
+        auto a = gen.fast_normal({n}, 2.0, 0.5);
+        REQUIRE(std::abs((xt::mean(a)() - 2.0) / 2.0) < 1e-3);
+        REQUIRE(std::abs((xt::stddev(a)() - 0.5) / 0.5) < 1e-2);
+
+        auto b = gen.fast_exponential({n}, 2.0);
+        REQUIRE(std::abs((xt::mean(b)() - 2.0) / 2.0) < 1e-2);
+
+        for (double k : {0.3, 1.0, 4.0}) {
+            auto c = gen.fast_gamma({n}, k, 2.0);
+            REQUIRE(std::abs((xt::mean(c)() - 2.0 * k) / (2.0 * k)) < 1e-2);
+            REQUIRE(std::abs((xt::variance(c)() - 4.0 * k) / (4.0 * k)) < 2e-2);
+        }
+    }
+
     SECTION("random - cumsum")
     {
         auto seed = std::time(0);
@@ -200,6 +302,37 @@ TEST_CASE("prrng::pgc32", "prrng.h")
         REQUIRE(xt::allclose(xt::cumsum(a)(n - 1), b));
     }
 
+    SECTION("cumsum - sample skip")
+    {
+        auto seed = std::time(0);
+        prrng::pcg32 generator(seed);
+        prrng::pcg32 reference(seed);
+        size_t n = 10000000;
+
+        REQUIRE(generator.cumsum_normal(0, 1.2, 0.1, false) == 0.0);
+        REQUIRE(generator.distance(reference) == 0);
+
+        generator.cumsum_normal(n, 1.2, 0.1, false);
+        generator.cumsum_exponential(n, 1.2, false);
+        generator.cumsum_gamma(n, 0.4, 1.2, false);
+        generator.cumsum_fast_gamma(n, 0.4, 1.2, false);
+        REQUIRE(generator.distance(reference) == static_cast<int64_t>(4 * n));
+
+        size_t m = 1000;
+        size_t nsum = 100000;
+        xt::xtensor<double, 1> a = xt::empty<double>({m});
+        xt::xtensor<double, 1> b = xt::empty<double>({m});
+        for (size_t i = 0; i < m; ++i) {
+            a(i) = generator.cumsum_fast_normal(nsum, 1.2, 0.1, false);
+            b(i) = generator.cumsum_gamma(nsum, 0.4, 1.2, false);
+        }
+
+        double s = std::sqrt(static_cast<double>(nsum)) * 0.1;
+        REQUIRE(std::abs(xt::mean(a)() - 1.2 * nsum) < 5.0 * s / std::sqrt(m));
+        REQUIRE(std::abs((xt::stddev(a)() - s) / s) < 0.1);
+        REQUIRE(std::abs((xt::mean(b)() - 0.48 * nsum) / (0.48 * nsum)) < 1e-3);
+    }
+
     SECTION("exponential - cumsum")
     {
         auto seed = std::time(0);
@@ -405,6 +538,37 @@ TEST_CASE("prrng::pgc32", "prrng.h")
         REQUIRE(std::abs((m - c) / c) < 1e-3);
     }
 
+    SECTION("fast_randint - mean, 64-bit range")
+    {
+        prrng::pcg32 gen;
+
+        uint32_t low = 500;
+        uint32_t high = 1000;
+        auto a = gen.fast_randint({1000000}, low, high);
+        double m = xt::mean(xt::cast<double>(a))();
+        double c = 0.5 * (static_cast<double>(low) + static_cast<double>(high - 1));
+        REQUIRE(xt::all(a >= low));
+        REQUIRE(xt::all(a < high));
+        REQUIRE(std::abs((m - c) / c) < 1e-3);
+
+        uint64_t big = (uint64_t(1) << 40) + 7;
+        auto b = gen.fast_randint({1000000}, big);
+        REQUIRE(xt::all(b < big));
+        REQUIRE(xt::amax(b)() > (uint64_t(1) << 39));
+        m = xt::mean(xt::cast<double>(b))();
+        c = 0.5 * static_cast<double>(big - 1);
+        REQUIRE(std::abs((m - c) / c) < 1e-2);
+
+        prrng::pcg32 ref;
+        ref.restore(gen.state());
+        uint64_t hi = ref.next_uint32();
+        uint64_t lo = ref.next_uint32();
+        REQUIRE(gen.next_uint64() == ((hi << 32) | lo));
+
+        REQUIRE(gen.fast_randint(1) == 0);
+        REQUIRE(gen.fast_randint(big) < big);
+    }
+
     SECTION("random - historic")
     {
         prrng::pcg32 gen;
@@ -942,6 +1106,1333 @@ TEST_CASE("prrng::pgc32", "prrng.h")
         REQUIRE(xt::allclose(a, regen.random({4, 5})));
     }
 
+    SECTION("pcg32_array - lanes")
+    {
+        size_t n = 3 * PRRNG_PCG32_LANES + 3;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(n);
+        xt::xtensor<uint64_t, 1> seq = xt::arange<uint64_t>(n);
+        prrng::pcg32_array gen(seed, seq);
+        prrng::pcg32_index_array igen(seed, seq);
+
+        auto a = gen.random({7});
+        auto b = gen.normal({7}, 1.0, 2.0);
+        auto c = igen.random({7});
+        auto d = gen.fast_normal({7}, 1.0, 2.0);
+
+        for (size_t i = 0; i < n; ++i) {
+            prrng::pcg32 ref(seed(i), seq(i));
+            REQUIRE(xt::all(xt::equal(xt::view(a, i, xt::all()), ref.random({7}))));
+            REQUIRE(xt::all(xt::equal(xt::view(b, i, xt::all()), ref.normal({7}, 1.0, 2.0))));
+            REQUIRE(xt::all(xt::equal(xt::view(d, i, xt::all()), ref.fast_normal({7}, 1.0, 2.0))));
+            REQUIRE(xt::all(xt::equal(xt::view(c, i, xt::all()), xt::view(a, i, xt::all()))));
+            REQUIRE(gen[i] == ref);
+        }
+    }
+
+    SECTION("pcg32_array - fast_randint")
+    {
+        size_t n = 3 * PRRNG_PCG32_LANES + 3;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(n);
+        xt::xtensor<uint64_t, 1> seq = xt::arange<uint64_t>(n);
+        prrng::pcg32_array gen(seed, seq);
+        prrng::pcg32_soa_array soa(seed, seq);
+
+        // large bound: many rejections
+        uint32_t high = (uint32_t(1) << 31) + 1;
+        auto a = gen.fast_randint({50}, high);
+        auto b = gen.fast_randint({50}, int64_t(-10), int64_t(10));
+        auto c = gen.fast_randint({5}, uint64_t(1) << 50);
+        REQUIRE(xt::all(xt::equal(soa.fast_randint({50}, high), a)));
+        REQUIRE(xt::all(xt::equal(soa.fast_randint({50}, int64_t(-10), int64_t(10)), b)));
+        REQUIRE(xt::all(xt::equal(soa.fast_randint({5}, uint64_t(1) << 50), c)));
+
+        for (size_t i = 0; i < n; ++i) {
+            prrng::pcg32 ref(seed(i), seq(i));
+            REQUIRE(xt::all(xt::equal(xt::view(a, i, xt::all()), ref.fast_randint({50}, high))));
+            auto bi = ref.fast_randint({50}, int64_t(-10), int64_t(10));
+            REQUIRE(xt::all(xt::equal(xt::view(b, i, xt::all()), bi)));
+            auto ci = ref.fast_randint({5}, uint64_t(1) << 50);
+            REQUIRE(xt::all(xt::equal(xt::view(c, i, xt::all()), ci)));
+            REQUIRE(gen[i] == ref);
+        }
+    }
+
+    SECTION("pcg32_array - decide, decide_packed, decide_indices")
+    {
+        size_t n = 2 * prrng::detail::decide_block_size + 13;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(n);
+        xt::xtensor<uint64_t, 1> seq = xt::arange<uint64_t>(n);
+        prrng::pcg32_array gen(seed, seq);
+        prrng::pcg32_soa_array soa(seed, seq);
+        prrng::philox_array cbrng(seed, seq);
+
+        xt::xtensor<double, 1> p = gen.random({});
+        xt::xtensor<bool, 1> mask = gen.random({}) < 0.3;
+        p(0) = 0.0;
+        p(1) = 1.0;
+        soa.restore(gen.state());
+        auto state = gen.state();
+
+        xt::xtensor<bool, 1> d = xt::empty<bool>({n});
+        xt::xtensor<bool, 1> dm = xt::empty<bool>({n});
+        xt::xtensor<bool, 1> dc = xt::empty<bool>({n});
+        std::vector<size_t> index;
+        std::vector<size_t> index_masked;
+
+        for (size_t i = 0; i < n; ++i) {
+            prrng::pcg32 ref = gen[i];
+            d(i) = ref.next_double() < p(i);
+            ref = gen[i];
+            dm(i) = !mask(i) && ref.next_double() < p(i);
+            prrng::philox cref(seed(i), seq(i));
+            dc(i) = !mask(i) && cref.next_double() < p(i);
+            if (d(i)) {
+                index.push_back(i);
+            }
+            if (dm(i)) {
+                index_masked.push_back(i);
+            }
+        }
+
+        // bool output
+        REQUIRE(xt::all(xt::equal(gen.decide(p), d)));
+        gen.restore(state);
+        REQUIRE(xt::all(xt::equal(gen.decide_masked(p, mask), dm)));
+        REQUIRE(xt::all(xt::equal(gen.distance(state), xt::where(mask, 0, 1))));
+        REQUIRE(xt::all(xt::equal(soa.decide(p), d)));
+        REQUIRE(xt::all(xt::equal(cbrng.decide_masked(p, mask), dc)));
+
+        // bit-packed output
+        gen.restore(state);
+        auto packed = gen.decide_packed(p);
+        gen.restore(state);
+        auto packed_masked = gen.decide_masked_packed(p, mask);
+        REQUIRE(packed.size() == (n + 7) / 8);
+        REQUIRE(packed_masked.size() == (n + 7) / 8);
+        REQUIRE(xt::all(xt::equal(gen.distance(state), xt::where(mask, 0, 1))));
+
+        for (size_t i = 0; i < n; ++i) {
+            REQUIRE(static_cast<bool>((packed(i / 8) >> (i % 8)) & 1) == d(i));
+            REQUIRE(static_cast<bool>((packed_masked(i / 8) >> (i % 8)) & 1) == dm(i));
+        }
+
+        soa.restore(state);
+        REQUIRE(xt::all(xt::equal(soa.decide_masked_packed(p, mask), packed_masked)));
+
+        // indices of accepted entries
+        gen.restore(state);
+        auto accepted = gen.decide_indices(p);
+        REQUIRE(accepted.size() == index.size());
+        REQUIRE(std::equal(accepted.begin(), accepted.end(), index.begin()));
+
+        gen.restore(state);
+        auto accepted_masked = gen.decide_masked_indices(p, mask);
+        REQUIRE(accepted_masked.size() == index_masked.size());
+        REQUIRE(std::equal(accepted_masked.begin(), accepted_masked.end(), index_masked.begin()));
+    }
+
+    SECTION("pcg32_soa_array - state/restore/advance/distance")
+    {
+        xt::xtensor<uint64_t, 2> seed = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}};
+        xt::xtensor<uint64_t, 2> seq = seed + 12;
+
+        prrng::pcg32_array ref(seed, seq);
+        prrng::pcg32_soa_array gen(seed, seq);
+        prrng::pcg32_soa_tensor<2> regen(seed, seq);
+
+        REQUIRE(xt::all(xt::equal(gen.state(), ref.state())));
+        REQUIRE(xt::all(xt::equal(gen.initstate(), ref.initstate())));
+        REQUIRE(xt::all(xt::equal(gen.initseq(), ref.initseq())));
+
+        auto i = gen.state();
+        auto a = gen.random({4, 5});
+        auto b = gen.normal({4, 5}, 1.0, 2.0);
+        auto c = gen.exponential({4, 5}, 2.0);
+        auto s = gen.state();
+        REQUIRE(xt::all(xt::equal(a, ref.random({4, 5}))));
+        REQUIRE(xt::all(xt::equal(b, ref.normal({4, 5}, 1.0, 2.0))));
+        REQUIRE(xt::all(xt::equal(c, ref.exponential({4, 5}, 2.0))));
+        REQUIRE(xt::all(xt::equal(s, ref.state())));
+
+        xt::xtensor<int64_t, 2> unit = xt::ones<int64_t>(seed.shape());
+        REQUIRE(xt::all(xt::equal(gen.distance(i), 3 * 4 * 5 * unit)));
+        REQUIRE(xt::all(xt::equal(regen.distance(gen), -3 * 4 * 5 * unit)));
+
+        regen.advance(xt::eval(2 * 4 * 5 * xt::ones<int>(regen.shape())));
+        REQUIRE(xt::all(xt::equal(regen.exponential({4, 5}, 2.0), c)));
+        regen.restore(i);
+        REQUIRE(xt::all(xt::equal(regen.random({4, 5}), a)));
+
+        // test "operator[]" and "operator()"
+
+        for (size_t i = 0; i < gen.shape(0); ++i) {
+            for (size_t j = 0; j < gen.shape(1); ++j) {
+                auto item = gen(i, j);
+                REQUIRE(item.state() == ref(i, j).state());
+                REQUIRE(item.initstate() == ref(i, j).initstate());
+                REQUIRE(item.initseq() == ref(i, j).initseq());
+                REQUIRE(item.random({10}) == ref(i, j).random({10}));
+                REQUIRE(gen[gen.flat_index(std::vector<size_t>{i, j})] == item);
+            }
+        }
+
+        // read-only references of a constant array
+        const prrng::pcg32_soa_array& cgen = gen;
+        static_assert(std::is_same<decltype(cgen[0]), prrng::pcg32_const_reference>::value, "");
+        static_assert(std::is_same<decltype(cgen(0, 0)), prrng::pcg32_const_reference>::value, "");
+
+        for (size_t i = 0; i < gen.size(); ++i) {
+            REQUIRE(cgen[i].state() == ref[i].state());
+            REQUIRE(cgen.flat(i).initstate() == ref[i].initstate());
+            REQUIRE(cgen.flat(i).initseq() == ref[i].initseq());
+            REQUIRE(cgen[i].distance(gen[i].state()) == 0);
+            REQUIRE(cgen[i] == cgen.flat(i));
+        }
+    }
+
+    SECTION("pcg32_index_soa_array - cumsum")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        using soa = prrng::pcg32_arrayBase_cumsum<prrng::pcg32_index_soa_array, Data, Index>;
+
+        class soa_cumsum : public soa {
+        public:
+            soa_cumsum(
+                const std::array<size_t, 1>& shape,
+                const xt::xtensor<uint64_t, 1>& initstate,
+                const xt::xtensor<uint64_t, 1>& initseq,
+                prrng::distribution distribution,
+                const std::vector<double>& parameters,
+                const prrng::alignment& align
+            )
+            {
+                this->init(shape, initstate, initseq, distribution, parameters, align);
+            }
+        };
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        prrng::pcg32_array_cumsum<Data, Index> ref(shape, seed, seq, prrng::weibull, param, align);
+        soa_cumsum chunk(shape, seed, seq, prrng::weibull, param, align);
+        REQUIRE(xt::all(xt::equal(chunk.data(), ref.data())));
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seed.shape());
+            ref.align(target);
+            chunk.align(target);
+            REQUIRE(xt::all(xt::equal(chunk.start(), ref.start())));
+            REQUIRE(xt::all(xt::equal(chunk.index_at_align(), ref.index_at_align())));
+            REQUIRE(xt::allclose(chunk.data(), ref.data()));
+        }
+    }
+
+    SECTION("pcg32_array - float")
+    {
+        using Float = xt::xtensor<float, 2>;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        prrng::pcg32_array gen(seed);
+        auto state = gen.state();
+
+        auto a = gen.random<Float>({7});
+        auto b = gen.exponential<Float>({7}, 2.0);
+        auto s = gen.state();
+
+        for (size_t i = 0; i < seed.size(); ++i) {
+            prrng::pcg32 ref(seed(i));
+            auto r = ref.random<xt::xtensor<float, 1>>({7});
+            REQUIRE(xt::all(xt::equal(xt::view(a, i, xt::all()), r)));
+        }
+
+        gen.restore(state);
+        gen.random<Float>({7});
+        auto u = gen.random<Float>({7});
+        Float e = -xt::log(1.0 - u) * 2.0;
+        REQUIRE(xt::all(xt::equal(b, e)));
+        REQUIRE(xt::all(xt::equal(gen.state(), s)));
+
+        Float out = xt::empty<float>({seed.size(), size_t(7)});
+        gen.restore(state);
+        gen.random(std::array<size_t, 1>{7}, out);
+        REQUIRE(xt::all(xt::equal(out, a)));
+    }
+
+    SECTION("pcg32_array_cumsum - float")
+    {
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        using Double = prrng::pcg32_array_cumsum<xt::xtensor<double, 2>, Index>;
+        using Float = prrng::pcg32_array_cumsum<xt::xtensor<float, 2>, Index>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        Double ref(shape, seed, seq, prrng::weibull, param, align);
+        Float chunk(shape, seed, seq, prrng::weibull, param, align);
+        REQUIRE(xt::allclose(chunk.data(), ref.data()));
+
+        for (ptrdiff_t i : {10, 500, 50, 5000}) {
+            Index index = i * xt::ones<ptrdiff_t>(seed.shape());
+            ref.align_at(index);
+            chunk.align_at(index);
+            REQUIRE(xt::all(xt::equal(chunk.start(), ref.start())));
+            REQUIRE(xt::allclose(chunk.data(), ref.data(), 1e-4));
+        }
+
+        for (double t : {10.0, 500.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seed.shape());
+            chunk.align(target);
+            REQUIRE(xt::all(chunk.left_of_align<xt::xtensor<double, 1>>() <= target));
+            REQUIRE(xt::all(chunk.right_of_align<xt::xtensor<double, 1>>() > target));
+        }
+    }
+
+    SECTION("pcg32_array_cumsum - align subset")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+        Cumsum ref(shape, seed, seq, prrng::weibull, param, align);
+        Cumsum chunk(shape, seed, seq, prrng::weibull, param, align);
+
+        xt::xtensor<double, 1> target = xt::zeros<double>(seed.shape());
+        xt::xtensor<size_t, 1> index = {1, 4, 9};
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> value = t * xt::ones<double>(index.shape());
+            xt::view(target, xt::keep(index)) = value;
+            ref.align(target);
+            chunk.align(index, value);
+            REQUIRE(xt::all(xt::equal(chunk.start(), ref.start())));
+            REQUIRE(xt::all(xt::equal(chunk.index_at_align(), ref.index_at_align())));
+            REQUIRE(xt::allclose(chunk.data(), ref.data()));
+        }
+    }
+
+    SECTION("pcg32_array, pcg32_array_cumsum - serialize")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+
+        xt::xtensor<uint64_t, 2> seed = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}};
+        xt::xtensor<uint64_t, 2> seq = seed + 12;
+        prrng::pcg32_array gen(seed, seq);
+        gen.random({10});
+
+        auto blob = gen.serialize();
+        prrng::pcg32_array regen;
+        REQUIRE(regen.deserialize(blob.data(), blob.size()) == blob.size());
+        REQUIRE(regen.shape() == gen.shape());
+        REQUIRE(xt::all(xt::equal(regen.state(), gen.state())));
+        REQUIRE(xt::all(xt::equal(regen.initseq(), gen.initseq())));
+        REQUIRE(xt::all(xt::equal(regen.random({10}), gen.random({10}))));
+
+        prrng::pcg32_index_array igen(seed, seq);
+        REQUIRE_THROWS(igen.deserialize(blob.data(), blob.size()));
+        REQUIRE_THROWS(regen.deserialize(blob.data(), blob.size() - 8));
+
+        // a corrupt rank or shape is rejected before allocating
+        for (size_t offset : {24, 32}) {
+            std::vector<char> corrupt = blob;
+            uint64_t huge = std::numeric_limits<uint64_t>::max() / 2;
+            std::memcpy(&corrupt[offset], &huge, sizeof(huge));
+            REQUIRE_THROWS_AS(
+                regen.deserialize(corrupt.data(), corrupt.size()), std::runtime_error
+            );
+        }
+
+        xt::xtensor<uint64_t, 1> iseed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> iseq = xt::zeros<uint64_t>(iseed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        Cumsum chunk(shape, iseed, iseq, prrng::weibull, param, align);
+        chunk.align(xt::eval(1000.0 * xt::ones<double>(iseed.shape())));
+
+        for (bool with_data : {true, false}) {
+            auto blob = chunk.serialize(with_data);
+            Cumsum other(shape, iseed, iseq, prrng::weibull, param, align);
+            REQUIRE(other.deserialize(blob.data(), blob.size()) == blob.size());
+            REQUIRE(xt::all(xt::equal(other.start(), chunk.start())));
+            REQUIRE(xt::all(xt::equal(other.index_at_align(), chunk.index_at_align())));
+            REQUIRE(xt::allclose(other.data(), chunk.data()));
+
+            Cumsum copy = chunk;
+            xt::xtensor<double, 1> target = 5000.0 * xt::ones<double>(iseed.shape());
+            copy.align(target);
+            other.align(target);
+            REQUIRE(xt::all(xt::equal(other.start(), copy.start())));
+            REQUIRE(xt::allclose(other.data(), copy.data()));
+
+            Cumsum wrong(shape, iseed, iseq, prrng::exponential, {1.0}, align);
+            REQUIRE_THROWS(wrong.deserialize(blob.data(), blob.size()));
+        }
+    }
+
+    SECTION("pcg32_cumsum - distribution at compile time")
+    {
+        using Data = xt::xtensor<double, 1>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.1};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+
+        using Runtime = prrng::pcg32_cumsum<Data>;
+        using Compiled = prrng::pcg32_cumsum<Data, prrng::weibull>;
+        Runtime ref(shape, seed, 0, prrng::weibull, param, align);
+        Compiled chunk(shape, seed, 0, prrng::weibull, param, align);
+        REQUIRE(xt::all(xt::equal(chunk.data(), ref.data())));
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            ref.align(t);
+            chunk.align(t);
+            REQUIRE(chunk.start() == ref.start());
+            REQUIRE(chunk.index_at_align() == ref.index_at_align());
+            REQUIRE(xt::all(xt::equal(chunk.data(), ref.data())));
+        }
+
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seeds.shape());
+        using Array = prrng::pcg32_array_cumsum<xt::xtensor<double, 2>, Index>;
+        using Static = prrng::pcg32_array_cumsum<xt::xtensor<double, 2>, Index, prrng::weibull>;
+        Array aref(shape, seeds, seq, prrng::weibull, param, align);
+        Static achunk(shape, seeds, seq, prrng::weibull, param, align);
+        REQUIRE(xt::all(xt::equal(achunk.data(), aref.data())));
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seeds.shape());
+            aref.align(target);
+            achunk.align(target);
+            REQUIRE(xt::all(xt::equal(achunk.start(), aref.start())));
+            REQUIRE(xt::all(xt::equal(achunk.data(), aref.data())));
+        }
+    }
+
+    SECTION("block_stream - cumsum, random")
+    {
+        using Data = xt::xtensor<double, 1>;
+        std::array<size_t, 1> shape = {100};
+        std::vector<double> param = {2.0, 1.2, 0.1};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+
+        prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::weibull, param);
+        prrng::pcg32 gen(seed, 0);
+        prrng::block_stream<prrng::pcg32> stream(gen, 100, prrng::weibull, param, true);
+        xt::xtensor<double, 2> out = xt::empty<double>({7, 100});
+        prrng::memory_sink<double> sink(out.data());
+        stream.write(3, sink);
+        stream.write(4, sink);
+        REQUIRE(stream.written() == 7);
+        REQUIRE(sink.data() == out.data() + out.size());
+
+        for (size_t i = 0; i < 7; ++i) {
+            REQUIRE(xt::all(xt::equal(xt::view(out, i, xt::all()), chunk.data())));
+            chunk.next();
+        }
+
+        REQUIRE(stream.back() == out(6, 99));
+
+        prrng::pcg32 ref(seed, 1);
+        prrng::pcg32 other(seed, 1);
+        prrng::block_stream<prrng::pcg32> raw(other, 10, prrng::random);
+        std::vector<double> values;
+        raw.write(5, [&](const double* data, size_t n) {
+            values.insert(values.end(), data, data + n);
+        });
+        REQUIRE(values.size() == 50);
+        auto a = ref.random({50});
+        REQUIRE(std::equal(values.begin(), values.end(), a.begin()));
+        REQUIRE(ref == other);
+    }
+
+    SECTION("pcg32_cumsum, pcg32_array_cumsum - statistics")
+    {
+        using Data = xt::xtensor<double, 1>;
+        std::array<size_t, 1> shape = {100};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+
+        prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::exponential, {1.0});
+
+#ifndef PRRNG_ENABLE_STATISTICS
+        // not collected: the counters are zero
+        chunk.align(1e5);
+        REQUIRE(chunk.statistics().drawn == 0);
+        REQUIRE(chunk.statistics().aligns == 0);
+        REQUIRE(chunk.statistics().summed == 0);
+#else
+        REQUIRE(chunk.statistics().drawn == 100);
+        REQUIRE(chunk.statistics().aligns == 0);
+
+        chunk.reset_statistics();
+        chunk.next();
+        REQUIRE(chunk.statistics().drawn == 100);
+        REQUIRE(chunk.statistics().shifts == 1);
+        REQUIRE(chunk.statistics().summed == 0);
+
+        // far target: the generator skips numbers that are only summed
+        chunk.reset_statistics();
+        chunk.align(1e5);
+        prrng::chunk_statistics stats = chunk.statistics();
+        REQUIRE(stats.aligns == 1);
+        REQUIRE(stats.summed > 0);
+        REQUIRE(stats.recursions > 0);
+        REQUIRE(stats.max_depth == stats.depth);
+        REQUIRE(stats.search_hits + stats.search_misses > 0);
+
+        // moving left: the generator jumps back by two chunks
+        chunk.reset_statistics();
+        chunk.prev();
+        REQUIRE(chunk.statistics().jumps == 1);
+        REQUIRE(chunk.statistics().advanced == 2 * 100);
+        REQUIRE(chunk.statistics().drawn == 100 + 1);
+
+        // array: sum over generators
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(5);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seeds.shape());
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        prrng::pcg32_array_cumsum<xt::xtensor<double, 2>, Index> achunk(
+            shape, seeds, seq, prrng::exponential, {1.0}
+        );
+        REQUIRE(achunk.statistics().drawn == 5 * 100);
+        REQUIRE(achunk.statistics(0).drawn == 100);
+
+        achunk.reset_statistics();
+        achunk.align(1e5 * xt::ones<double>(seeds.shape()));
+        REQUIRE(achunk.statistics().aligns == 5);
+        REQUIRE(achunk.statistics(4).aligns == 1);
+        REQUIRE(achunk.statistics().summed > 0);
+#endif
+    }
+
+    SECTION("pcg32_cumsum, pcg32_array_cumsum - resize, adaptation")
+    {
+        using Data = xt::xtensor<double, 1>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        std::array<size_t, 1> shape = {100};
+        std::array<size_t, 1> large = {100000};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+
+        // "ref" holds the sequence at all global indices used below
+        prrng::pcg32_cumsum<Data> ref(large, seed, 0, prrng::exponential, {1.0});
+        prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::exponential, {1.0});
+
+        chunk.resize(250);
+        REQUIRE(chunk.size() == 250);
+        REQUIRE(xt::allclose(chunk.data(), xt::view(ref.data(), xt::range(0, 250))));
+
+        chunk.align(1000.0);
+        ptrdiff_t start = chunk.start();
+        chunk.resize(50);
+        REQUIRE(chunk.start() == start);
+        REQUIRE(xt::allclose(chunk.data(), xt::view(ref.data(), xt::range(start, start + 50))));
+
+        // the target moves fast: the chunk grows (within bounds), the sequence is not changed
+        chunk.set_adaptation(prrng::adaptation(16, 1024));
+        double target = 1000.0;
+
+        for (size_t i = 0; i < 20; ++i) {
+            target += 500.0;
+            chunk.align(target);
+            ptrdiff_t j = chunk.index_at_align();
+            REQUIRE(chunk.left_of_align() <= target);
+            REQUIRE(chunk.right_of_align() > target);
+            REQUIRE(ref.data()(j) <= target);
+            REQUIRE(ref.data()(j + 1) > target);
+            ptrdiff_t n = static_cast<ptrdiff_t>(chunk.size());
+            auto view = xt::view(ref.data(), xt::range(chunk.start(), chunk.start() + n));
+            REQUIRE(xt::allclose(chunk.data(), view));
+        }
+
+        REQUIRE(chunk.size() == 1024);
+        REQUIRE(chunk.velocity() > 400.0);
+
+        // the target hardly moves: the chunk shrinks
+        for (size_t i = 0; i < 50; ++i) {
+            target += 0.1;
+            chunk.align(target);
+        }
+
+        REQUIRE(chunk.size() < 1024);
+        REQUIRE(chunk.size() >= 16);
+
+        // array: all chunks are resized at once
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(5);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seeds.shape());
+        using Array = prrng::pcg32_array_cumsum<xt::xtensor<double, 2>, Index>;
+        Array aref(large, seeds, seq, prrng::exponential, {1.0});
+        Array achunk(shape, seeds, seq, prrng::exponential, {1.0});
+        achunk.resize(300);
+        REQUIRE(achunk.chunk_size() == 300);
+        auto aview = xt::view(aref.data(), xt::all(), xt::range(0, 300));
+        REQUIRE(xt::allclose(achunk.data(), aview));
+
+        achunk.set_adaptation(prrng::adaptation(16, 4096));
+        xt::xtensor<double, 1> atarget = xt::zeros<double>(seeds.shape());
+
+        for (size_t i = 0; i < 20; ++i) {
+            atarget += 1000.0;
+            achunk.align(atarget);
+            Index index = achunk.index_at_align();
+
+            for (size_t g = 0; g < seeds.size(); ++g) {
+                ptrdiff_t j = index(g);
+                REQUIRE(aref.data()(g, j) <= atarget(g));
+                REQUIRE(aref.data()(g, j + 1) > atarget(g));
+            }
+        }
+
+        REQUIRE(achunk.chunk_size() > 300);
+    }
+
+    SECTION("pcg32_array_ragged_cumsum - align, align_at")
+    {
+        using Data = xt::xtensor<double, 1>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(4);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        xt::xtensor<size_t, 1> sizes = {100, 5000, 20, 300};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        using Ragged = prrng::pcg32_array_ragged_cumsum<Data, Index>;
+        Ragged chunk(sizes, seed, seq, prrng::weibull, param, align);
+        REQUIRE(chunk.offsets().back() == 5420);
+        REQUIRE(chunk.data().size() == 5420);
+
+        // each generator behaves as a scalar chunk of its own size
+        std::vector<prrng::pcg32_cumsum<Data>> ref;
+
+        for (size_t i = 0; i < seed.size(); ++i) {
+            std::array<size_t, 1> shape = {sizes(i)};
+            ref.emplace_back(shape, seed(i), seq(i), prrng::weibull, param, align);
+            REQUIRE(chunk.chunk_size(i) == sizes(i));
+        }
+
+        auto check = [&]() {
+            Index start = chunk.start();
+            Index index = chunk.index_at_align();
+            for (size_t i = 0; i < seed.size(); ++i) {
+                size_t o = chunk.offsets()[i];
+                auto view = xt::view(chunk.data(), xt::range(o, o + sizes(i)));
+                REQUIRE(start(i) == ref[i].start());
+                REQUIRE(index(i) == ref[i].index_at_align());
+                REQUIRE(xt::allclose(view, ref[i].data()));
+            }
+        };
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seed.shape());
+            chunk.align(target);
+            for (size_t i = 0; i < seed.size(); ++i) {
+                ref[i].align(t);
+            }
+            check();
+            auto left = chunk.left_of_align<xt::xtensor<double, 1>>();
+            auto right = chunk.right_of_align<xt::xtensor<double, 1>>();
+            REQUIRE(xt::all(left <= target));
+            REQUIRE(xt::all(right > target));
+        }
+
+        Index index = {3, 12000, 7, 500};
+        chunk.align_at(index);
+        REQUIRE(xt::all(xt::equal(chunk.index_at_align(), index)));
+    }
+
+    SECTION("pcg32, pcg32_array - lazy draws")
+    {
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+        prrng::pcg32 gen(seed);
+        prrng::pcg32 ref(seed);
+
+        xt::xtensor<double, 2> a = gen.lazy_exponential({4, 5}, 2.0);
+        REQUIRE(xt::allclose(a, ref.exponential({4, 5}, 2.0)));
+        REQUIRE(gen == ref);
+
+        // fused with arithmetic, evaluated on assignment
+        xt::xtensor<double, 2> out = xt::empty<double>({4, 5});
+        xt::noalias(out) = 2.0 * gen.lazy_normal({4, 5}, 0.0, 1.0) + 1.0;
+        REQUIRE(xt::allclose(out, 2.0 * ref.normal({4, 5}, 0.0, 1.0) + 1.0));
+        REQUIRE(gen == ref);
+
+        // the generator is advanced before evaluation, the order of evaluation is irrelevant
+        auto lazy = gen.lazy_random({10});
+        auto r = ref.random({10});
+        REQUIRE(gen == ref);
+        REQUIRE(lazy(7) == r(7));
+        REQUIRE(lazy(2) == r(2));
+        REQUIRE(lazy(3) == r(3));
+
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(5);
+        prrng::pcg32_array agen(seeds);
+        prrng::pcg32_array aref(seeds);
+        xt::xtensor<double, 2> b = agen.lazy_weibull({6}, 2.0, 1.5);
+        REQUIRE(xt::allclose(b, aref.weibull({6}, 2.0, 1.5)));
+        REQUIRE(xt::all(xt::equal(agen.state(), aref.state())));
+    }
+
+    SECTION("fast_power, fast_pareto, fast_weibull - error bound")
+    {
+        auto seed = std::time(0);
+        prrng::pcg32 gen(seed);
+        prrng::pcg32 ref(seed);
+        size_t n = 100000;
+        double tol = 4e-15;
+
+        for (double k : {0.05, 0.2, 1.0, 2.5, 20.0}) {
+            auto a = gen.fast_power({n}, k);
+            auto b = ref.power({n}, k);
+            REQUIRE(xt::all(xt::abs(a - b) <= tol * b));
+
+            a = gen.fast_pareto({n}, k, 1.5);
+            b = ref.pareto({n}, k, 1.5);
+            REQUIRE(xt::all(xt::abs(a - b) <= tol * b));
+
+            a = gen.fast_weibull({n}, k, 1.5);
+            b = ref.weibull({n}, k, 1.5);
+            REQUIRE(xt::all(xt::abs(a - b) <= tol * b));
+        }
+
+        REQUIRE(gen.state() == ref.state());
+        REQUIRE(gen.fast_pareto(0.01, 2.0) == ref.pareto(0.01, 2.0));
+        double y = ref.cumsum_weibull(n, 2.5, 1.5);
+        REQUIRE(std::abs(gen.cumsum_fast_weibull(n, 2.5, 1.5) - y) / y < 1e-13);
+
+        std::array<size_t, 1> shape = {n};
+        auto x = gen.fast_power({n}, 0.4);
+        gen.advance(-static_cast<ptrdiff_t>(n));
+        REQUIRE(xt::allclose(
+            x + 1.0, gen.draw<xt::xtensor<double, 1>>(shape, prrng::fast_power, {0.4, 1.0})
+        ));
+
+        xt::xtensor<uint64_t, 1> seeds = seed + xt::arange<uint64_t>(5);
+        prrng::pcg32_array agen(seeds);
+        prrng::pcg32_array aref(seeds);
+        xt::xtensor<double, 2> c = agen.fast_weibull({100}, 2.5, 1.5);
+        xt::xtensor<double, 2> d = aref.weibull({100}, 2.5, 1.5);
+        REQUIRE(xt::allclose(c, d, 1e-14, 0.0));
+    }
+
+    SECTION("pcg32_array_cumsum - lazy first chunk")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true, false, 20);
+        prrng::alignment lazy(0, 5, 0, true, false, 20, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+        Cumsum ref(shape, seed, seq, prrng::weibull, param, align);
+        Cumsum chunk(shape, seed, seq, prrng::weibull, param, lazy);
+        Cumsum other(shape, seed, seq, prrng::weibull, param, lazy);
+
+        // reading all chunks draws all deferred chunks
+        REQUIRE(xt::allclose(other.data(), ref.data()));
+        REQUIRE(xt::all(xt::equal(other.generators().state(), ref.generators().state())));
+
+        // also for a const object
+        const Cumsum constant(shape, seed, seq, prrng::weibull, param, lazy);
+        REQUIRE(constant.serialize_row(3) == ref.serialize_row(3));
+        REQUIRE(xt::allclose(constant.data(), ref.data()));
+        REQUIRE(xt::all(xt::equal(constant.generators().state(), ref.generators().state())));
+
+        // only some generators are used
+        xt::xtensor<size_t, 1> index = {1, 4, 9};
+        xt::xtensor<double, 1> value = 500.0 * xt::ones<double>(index.shape());
+        chunk.align(index, value);
+        chunk.align(2, 50.0);
+        ref.align(index, value);
+        ref.align(2, 50.0);
+        REQUIRE(xt::all(xt::equal(chunk.start(), ref.start())));
+        REQUIRE(xt::all(xt::equal(chunk.index_at_align(), ref.index_at_align())));
+        REQUIRE(xt::allclose(chunk.data(), ref.data()));
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seed.shape());
+            chunk.align(target);
+            ref.align(target);
+            REQUIRE(xt::all(xt::equal(chunk.start(), ref.start())));
+            REQUIRE(xt::all(xt::equal(chunk.index_at_align(), ref.index_at_align())));
+            REQUIRE(xt::allclose(chunk.data(), ref.data()));
+        }
+
+        Cumsum at(shape, seed, seq, prrng::weibull, param, lazy);
+        Index i = {3, 12000, 7, 500, 0, 1, 2, 3, 4, 5, 6};
+        at.align_at(i);
+        ref.align_at(i);
+        REQUIRE(xt::all(xt::equal(at.start(), ref.start())));
+        REQUIRE(xt::allclose(at.data(), ref.data()));
+    }
+
+    SECTION("pcg32_array_partitioned_cumsum - migrate rows")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(10);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+        using Partition = prrng::pcg32_array_partitioned_cumsum<Data, Index>;
+        Cumsum ref(shape, seed, seq, prrng::weibull, param, align);
+
+        xt::xtensor<uint64_t, 1> sa = xt::view(seed, xt::range(0, 6));
+        xt::xtensor<uint64_t, 1> sb = xt::view(seed, xt::range(6, 10));
+        xt::xtensor<uint64_t, 1> qa = xt::zeros<uint64_t>(sa.shape());
+        xt::xtensor<uint64_t, 1> qb = xt::zeros<uint64_t>(sb.shape());
+        Partition a(shape, sa, qa, 0, prrng::weibull, param, align);
+        Partition b(shape, sb, qb, 6, prrng::weibull, param, align);
+
+        auto check = [&](const Partition& part) {
+            for (size_t i = 0; i < part.rows().size(); ++i) {
+                size_t r = part.rows()[i];
+                REQUIRE(part.start()(i) == ref.start()(r));
+                REQUIRE(part.chunk_index_at_align()(i) == ref.chunk_index_at_align()(r));
+                REQUIRE(xt::allclose(xt::view(part.data(), i), xt::view(ref.data(), r)));
+            }
+        };
+
+        auto target = [](double t, size_t n) -> xt::xtensor<double, 1> {
+            return t * xt::ones<double>({n});
+        };
+
+        auto align_all = [&](double t) {
+            ref.align(target(t, seed.size()));
+            a.align(target(t, a.rows().size()));
+            b.align(target(t, b.rows().size()));
+        };
+
+        align_all(1000.0);
+        check(a);
+        check(b);
+
+        // move rows from `a` to `b`: only the serialized rows are copied
+        std::vector<size_t> rows = {1, 4};
+        std::vector<char> blob = a.serialize_rows(rows);
+        a.erase_rows(rows);
+        b.insert_rows(blob.data(), blob.size());
+        REQUIRE(a.rows() == std::vector<size_t>{0, 2, 3, 5});
+        REQUIRE(b.rows() == std::vector<size_t>{1, 4, 6, 7, 8, 9});
+        REQUIRE(b.local_index(4) == 1);
+        REQUIRE(!a.owns(4));
+        check(a);
+        check(b);
+
+        for (double t : {5000.0, 50.0, 20000.0}) {
+            align_all(t);
+            check(a);
+            check(b);
+        }
+
+        REQUIRE_THROWS(b.insert_rows(blob.data(), blob.size()));
+        REQUIRE(b.rows().size() == 6);
+
+        // a corrupt number of rows is rejected before allocating
+        std::vector<char> corrupt = blob;
+        uint64_t huge = std::numeric_limits<uint64_t>::max() / 2;
+        std::memcpy(corrupt.data(), &huge, sizeof(huge));
+        REQUIRE_THROWS_AS(a.insert_rows(corrupt.data(), corrupt.size()), std::runtime_error);
+        REQUIRE(a.rows() == std::vector<size_t>{0, 2, 3, 5});
+
+        // checkpoint and restore in a partition without rows
+        std::vector<char> checkpoint = b.serialize_rows(b.rows());
+        xt::xtensor<uint64_t, 1> none = xt::zeros<uint64_t>({0});
+        Partition c(shape, none, none, 0, prrng::weibull, param, align);
+        c.insert_rows(checkpoint.data(), checkpoint.size());
+        REQUIRE(c.rows() == b.rows());
+        check(c);
+
+        align_all(30000.0);
+        c.align(target(30000.0, c.rows().size()));
+        check(c);
+
+        // rows that are not owned are rejected, without modifying the partition
+        REQUIRE_THROWS_AS(a.local_index(4), std::runtime_error);
+        REQUIRE_THROWS_AS(a.serialize_rows(std::vector<size_t>{9}), std::runtime_error);
+        REQUIRE_THROWS_AS(a.erase_rows(std::vector<size_t>{0, 9}), std::runtime_error);
+        REQUIRE(a.rows() == std::vector<size_t>{0, 2, 3, 5});
+        check(a);
+    }
+
+    SECTION("pcg32_array_partitioned_cumsum - migrate rows, slack and lazy")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(10);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+        using Partition = prrng::pcg32_array_partitioned_cumsum<Data, Index>;
+        Cumsum ref(shape, seed, seq, prrng::weibull, param, align);
+
+        align.slack = 300;
+        align.lazy = true;
+        xt::xtensor<uint64_t, 1> sa = xt::view(seed, xt::range(0, 6));
+        xt::xtensor<uint64_t, 1> sb = xt::view(seed, xt::range(6, 10));
+        xt::xtensor<uint64_t, 1> qa = xt::zeros<uint64_t>(sa.shape());
+        xt::xtensor<uint64_t, 1> qb = xt::zeros<uint64_t>(sb.shape());
+        Partition a(shape, sa, qa, 0, prrng::weibull, param, align);
+        Partition b(shape, sb, qb, 6, prrng::weibull, param, align);
+
+        auto check = [&](const Partition& part) {
+            for (size_t i = 0; i < part.rows().size(); ++i) {
+                size_t r = part.rows()[i];
+                REQUIRE(part.start()(i) == ref.start()(r));
+                REQUIRE(xt::allclose(xt::view(part.data(), i), xt::view(ref.data(), r)));
+            }
+        };
+
+        // migrate before any chunk is drawn, and after aligning
+        for (double t : {0.0, 1000.0}) {
+            if (t > 0) {
+                ref.align(t * xt::ones<double>({seed.size()}));
+                a.align(t * xt::ones<double>({a.rows().size()}));
+                b.align(t * xt::ones<double>({b.rows().size()}));
+            }
+
+            std::vector<size_t> rows = {a.rows().front(), a.rows().back()};
+            std::vector<char> blob = a.serialize_rows(rows);
+            a.erase_rows(rows);
+            b.insert_rows(blob.data(), blob.size());
+            REQUIRE(std::is_sorted(b.rows().begin(), b.rows().end()));
+            check(a);
+            check(b);
+        }
+
+        REQUIRE(a.rows() == std::vector<size_t>{2, 3});
+        REQUIRE(b.rows() == std::vector<size_t>{0, 1, 4, 5, 6, 7, 8, 9});
+
+        // an incompatible blob is rejected, without modifying the partition
+        xt::xtensor<uint64_t, 1> sc = xt::view(seed, xt::range(0, 1));
+        xt::xtensor<uint64_t, 1> qc = xt::zeros<uint64_t>(sc.shape());
+        Partition c(shape, sc, qc, 0, prrng::exponential, std::vector<double>{1.0}, align);
+        std::vector<char> blob = c.serialize_rows(c.rows());
+        REQUIRE_THROWS_AS(a.insert_rows(blob.data(), blob.size()), std::runtime_error);
+        REQUIRE(a.rows() == std::vector<size_t>{2, 3});
+        check(a);
+    }
+
+    SECTION("pcg32_cumsum - prefetch")
+    {
+        using Data = xt::xtensor<double, 1>;
+        std::array<size_t, 1> shape = {1000};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+        prrng::alignment align(0, 10, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        for (ptrdiff_t slack : {0, 2500}) {
+            align.slack = slack;
+            prrng::pcg32_cumsum<Data> ref(shape, seed, 0, prrng::weibull, param, align);
+            prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::weibull, param, align);
+            chunk.set_prefetch(true);
+            REQUIRE(chunk.prefetch());
+
+            auto check = [&]() {
+                REQUIRE(chunk.start() == ref.start());
+                REQUIRE(chunk.index_at_align() == ref.index_at_align());
+                REQUIRE(chunk.generator().index() == ref.generator().index());
+                REQUIRE(chunk.generator().state() == ref.generator().state());
+                REQUIRE(xt::allclose(chunk.data(), ref.data()));
+            };
+
+            chunk.next();
+            ref.next();
+            check();
+
+            double target = ref.data()(0);
+
+            for (size_t i = 0; i < 500; ++i) {
+                target += 1.0 + static_cast<double>(i % 7);
+                chunk.align(target);
+                ref.align(target);
+                check();
+            }
+
+            chunk.align(target + 1e5);
+            ref.align(target + 1e5);
+            check();
+
+            chunk.prev();
+            ref.prev();
+            check();
+            chunk.next(5);
+            ref.next(5);
+            check();
+
+#ifdef PRRNG_ENABLE_STATISTICS
+            REQUIRE(chunk.statistics().prefetched > 0);
+#endif
+
+            prrng::pcg32_cumsum<Data> other = chunk;
+            REQUIRE(other.prefetch());
+            other.next();
+            ref.next();
+            REQUIRE(xt::allclose(other.data(), ref.data()));
+
+            chunk.set_prefetch(false);
+            chunk.next();
+            REQUIRE(xt::allclose(chunk.data(), ref.data()));
+        }
+    }
+
+    SECTION("pcg32_cumsum - prefetch, prev() from the prefetched numbers")
+    {
+        using Data = xt::xtensor<double, 1>;
+        std::array<size_t, 1> shape = {4};
+        prrng::alignment align(0, 0, 0, true);
+        std::vector<double> param = {1.0, 0.0};
+        size_t served = 0;
+
+        for (uint64_t seed = 0; seed < 50; ++seed) {
+            prrng::pcg32_cumsum<Data> ref(shape, seed, 0, prrng::exponential, param, align);
+            prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::exponential, param, align);
+            prrng::pcg32_cumsum<Data> probe(shape, seed, 0, prrng::exponential, param, align);
+            chunk.set_prefetch(true);
+
+            // leaves the prefetched numbers at [2n, 3n)
+            chunk.next();
+            chunk.prev();
+            ref.next();
+            ref.prev();
+
+            // skip to [3n, 4n): the target may be before it, such that [2n, 3n) is drawn by prev()
+            double back = ref.data()(3);
+            double target = back + (back - ref.data()(0)) * (3.0 + 0.5 / 4.0);
+            probe.next();
+            probe.next();
+            probe.next();
+            served += target < probe.data()(0);
+
+            chunk.align(target);
+            ref.align(target);
+            REQUIRE(chunk.start() == ref.start());
+            REQUIRE(chunk.index_at_align() == ref.index_at_align());
+            REQUIRE(chunk.generator().index() == ref.generator().index());
+            REQUIRE(chunk.generator().state() == ref.generator().state());
+            REQUIRE(xt::allclose(chunk.data(), ref.data()));
+        }
+
+        REQUIRE(served > 0);
+    }
+
+    SECTION("pcg32_cumsum - prefetch, custom functions")
+    {
+        using Data = xt::xtensor<double, 1>;
+        std::array<size_t, 1> shape = {100};
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+        std::vector<double> param = {1.0, 0.0};
+        prrng::pcg32_cumsum<Data> chunk(shape, seed, 0, prrng::exponential, param);
+        chunk.set_prefetch(true);
+
+        auto draw = [](size_t n) -> Data { return xt::ones<double>({n}); };
+        auto sum = [](size_t n) -> double { return static_cast<double>(n); };
+        chunk.set_functions(draw, sum, false);
+        REQUIRE(xt::allclose(chunk.data(), xt::arange<double>(1.0, 101.0)));
+
+        chunk.next();
+        REQUIRE(chunk.start() == 100);
+        REQUIRE(xt::allclose(chunk.data(), xt::arange<double>(101.0, 201.0)));
+
+        chunk.next(10);
+        REQUIRE(chunk.start() == 190);
+        REQUIRE(xt::allclose(chunk.data(), xt::arange<double>(191.0, 291.0)));
+
+        chunk.prev();
+        REQUIRE(chunk.start() == 90);
+        REQUIRE(xt::allclose(chunk.data(), xt::arange<double>(91.0, 191.0)));
+    }
+
+    SECTION("pcg32_array_multi_cumsum - align")
+    {
+        using Data = xt::xtensor<double, 3>;
+        using Index = xt::xtensor<ptrdiff_t, 2>;
+        size_t n = 500;
+        size_t k = 3;
+        size_t rows = 20000;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(4);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.1};
+
+        using Multi = prrng::pcg32_array_multi_cumsum<Data, Index>;
+        Multi chunk(n, k, seed, seq, prrng::weibull, param, align);
+        REQUIRE(xt::has_shape(chunk.data(), std::array<size_t, 3>{4, n, k}));
+
+        // channel `c` is the cumsum of every `k`-th random number of the generator
+        xt::xtensor<double, 3> ref = xt::empty<double>({seed.size(), rows, k});
+        for (size_t i = 0; i < seed.size(); ++i) {
+            prrng::pcg32 gen(seed(i), seq(i));
+            auto x = xt::eval(param[2] + gen.weibull({rows, k}, param[0], param[1]));
+            xt::view(ref, i) = xt::cumsum(x, 0);
+        }
+
+        auto check = [&](const xt::xtensor<double, 2>& target) {
+            Index start = chunk.start();
+            Index index = chunk.index_at_align();
+            for (size_t i = 0; i < seed.size(); ++i) {
+                REQUIRE(xt::all(xt::equal(xt::view(start, i), start(i, 0))));
+                REQUIRE(xt::amin(xt::view(chunk.chunk_index_at_align(), i))() == 5);
+                auto r = xt::range(start(i, 0), start(i, 0) + static_cast<ptrdiff_t>(n));
+                REQUIRE(xt::allclose(xt::view(chunk.data(), i), xt::view(ref, i, r)));
+                for (size_t c = 0; c < k; ++c) {
+                    REQUIRE(ref(i, index(i, c), c) < target(i, c));
+                    REQUIRE(ref(i, index(i, c) + 1, c) >= target(i, c));
+                }
+            }
+        };
+
+        for (double t : {10.0, 1000.0, 50.0, 5000.0, 3000.0}) {
+            xt::xtensor<double, 2> target = t * xt::ones<double>({seed.size(), k});
+            xt::view(target, xt::all(), 1) += 1.0;
+            chunk.align(target);
+            check(target);
+            REQUIRE(chunk.contains(target));
+            auto left = chunk.left_of_align<xt::xtensor<double, 2>>();
+            auto right = chunk.right_of_align<xt::xtensor<double, 2>>();
+            REQUIRE(xt::all(left < target));
+            REQUIRE(xt::all(right >= target));
+        }
+
+#ifdef PRRNG_ENABLE_STATISTICS
+        // aligning again to the same targets: the search starts from the last known rows
+        xt::xtensor<double, 2> last = 3000.0 * xt::ones<double>({seed.size(), k});
+        xt::view(last, xt::all(), 1) += 1.0;
+        chunk.reset_statistics();
+        chunk.align(last);
+        check(last);
+        REQUIRE(chunk.statistics().search_hits == seed.size() * k);
+        REQUIRE(chunk.statistics().search_misses == 0);
+#endif
+
+        // the targets of all channels must fit in one chunk
+        xt::xtensor<double, 2> target = 10.0 * xt::ones<double>({seed.size(), k});
+        target(0, 2) = 2000.0;
+        REQUIRE_THROWS_AS(chunk.align(target), std::runtime_error);
+    }
+
+    SECTION("pcg32_array_cumsum - slack, directly after construction")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(5);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        std::vector<double> param = {2.0, 1.2, 0.0};
+        prrng::alignment align(0, 10, 0, true);
+
+        using Chunk = prrng::pcg32_array_cumsum<Data, Index>;
+        Chunk ref(shape, seed, seq, prrng::weibull, param, align);
+        align.slack = 300;
+        Chunk chunk(shape, seed, seq, prrng::weibull, param, align);
+        REQUIRE(xt::allclose(chunk.data(), ref.data()));
+
+        Chunk other(shape, seed, seq, prrng::weibull, param, align);
+        other += 1.0;
+        ref += 1.0;
+        REQUIRE(xt::allclose(other.data(), ref.data()));
+        other -= 1.0;
+        ref -= 1.0;
+        REQUIRE(xt::allclose(other.data(), ref.data()));
+
+        xt::xtensor<double, 1> target = 50.0 * xt::ones<double>(seed.shape());
+        other.align(target);
+        ref.align(target);
+        REQUIRE(xt::all(xt::equal(other.start(), ref.start())));
+        REQUIRE(xt::allclose(other.data(), ref.data()));
+    }
+
+    SECTION("OpenMP - output independent of the number of threads")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        using Cumsum = prrng::pcg32_array_cumsum<Data, Index>;
+        std::array<size_t, 1> shape = {100};
+        std::vector<double> param = {2.0, 1.2, 0.0};
+        prrng::alignment align(0, 5, 0, true);
+#ifdef _OPENMP
+        int threads = omp_get_max_threads();
+#endif
+
+        // below and above the threshold to split the loops over threads (if PRRNG_USE_OPENMP)
+        for (size_t n : {size_t(7), size_t(PRRNG_PARALLEL_THRESHOLD + 3)}) {
+            xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(n);
+            xt::xtensor<uint64_t, 1> seq = xt::arange<uint64_t>(n);
+            xt::xtensor<double, 1> target = 500.0 * xt::ones<double>(seed.shape());
+
+            auto run = [&](int nthreads) {
+#ifdef _OPENMP
+                omp_set_num_threads(nthreads);
+#else
+                (void)nthreads;
+#endif
+                prrng::pcg32_array gen(seed, seq);
+                prrng::pcg32_soa_array soa(seed, seq);
+                Cumsum chunk(shape, seed, seq, prrng::weibull, param, align);
+                chunk.align(target);
+                return std::make_tuple(
+                    xt::eval(gen.random({7})),
+                    xt::eval(gen.fast_randint({7}, uint32_t(100))),
+                    xt::eval(soa.normal({7}, 1.0, 2.0)),
+                    xt::eval(chunk.data()),
+                    xt::eval(chunk.start())
+                );
+            };
+
+            auto serial = run(1);
+            auto parallel = run(4);
+
+            REQUIRE(xt::all(xt::equal(std::get<0>(parallel), std::get<0>(serial))));
+            REQUIRE(xt::all(xt::equal(std::get<1>(parallel), std::get<1>(serial))));
+            REQUIRE(xt::all(xt::equal(std::get<2>(parallel), std::get<2>(serial))));
+            REQUIRE(xt::all(xt::equal(std::get<3>(parallel), std::get<3>(serial))));
+            REQUIRE(xt::all(xt::equal(std::get<4>(parallel), std::get<4>(serial))));
+
+            for (size_t i = 0; i < n; i += n / 7) {
+                prrng::pcg32 ref(seed(i), seq(i));
+                prrng::pcg32 other(seed(i), seq(i));
+                auto a = ref.random({7});
+                auto b = ref.fast_randint({7}, uint32_t(100));
+                auto c = other.normal({7}, 1.0, 2.0);
+                REQUIRE(xt::all(xt::equal(xt::view(std::get<0>(parallel), i, xt::all()), a)));
+                REQUIRE(xt::all(xt::equal(xt::view(std::get<1>(parallel), i, xt::all()), b)));
+                REQUIRE(xt::all(xt::equal(xt::view(std::get<2>(parallel), i, xt::all()), c)));
+            }
+        }
+
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+    }
+
+    SECTION("philox - known answer, random access")
+    {
+        uint32_t ctr[4] = {0, 0, 0, 0};
+        uint32_t key[2] = {0, 0};
+        uint32_t out[4];
+        prrng::detail::philox4x32(ctr, key, out);
+        REQUIRE(out[0] == 0x6627e8d5);
+        REQUIRE(out[1] == 0xe169c58d);
+        REQUIRE(out[2] == 0xbc57ac4c);
+        REQUIRE(out[3] == 0x9b00dbd8);
+
+        std::fill(std::begin(ctr), std::end(ctr), 0xffffffff);
+        std::fill(std::begin(key), std::end(key), 0xffffffff);
+        prrng::detail::philox4x32(ctr, key, out);
+        REQUIRE(out[0] == 0x408f276d);
+        REQUIRE(out[1] == 0x41c83b0e);
+        REQUIRE(out[2] == 0xa20bc7c6);
+        REQUIRE(out[3] == 0x6d5451fd);
+
+        uint64_t seed = static_cast<uint64_t>(std::time(0));
+        prrng::philox gen(seed, 3);
+        prrng::philox ref(seed, 3);
+        std::vector<uint32_t> a(103);
+        std::generate(a.begin(), a.end(), [&]() { return gen(); });
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            REQUIRE(ref.at(i) == a[i]);
+        }
+
+        REQUIRE(gen.distance(ref) == 103);
+        REQUIRE(gen.state() == a.size());
+        ref.advance(57);
+        REQUIRE(ref() == a[57]);
+        ref.advance(-10);
+        REQUIRE(ref() == a[48]);
+        ref.restore(5);
+        REQUIRE(ref() == a[5]);
+
+        auto r = ref.random({20});
+        prrng::philox other(seed, 3);
+        other.advance(6);
+        REQUIRE(xt::all(xt::equal(other.random({20}), r)));
+        REQUIRE(other == ref);
+
+        prrng::philox stream(seed, 4);
+        REQUIRE(stream.at(0) != a[0]);
+    }
+
+    SECTION("philox_array - list")
+    {
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::arange<uint64_t>(seed.size());
+        prrng::philox_array gen(seed, seq);
+
+        auto state = gen.state();
+        auto a = gen.random({7});
+        auto b = gen.exponential({7}, 2.0);
+
+        for (size_t i = 0; i < seed.size(); ++i) {
+            prrng::philox ref(seed(i), seq(i));
+            REQUIRE(xt::all(xt::equal(xt::view(a, i, xt::all()), ref.random({7}))));
+            REQUIRE(xt::all(xt::equal(xt::view(b, i, xt::all()), ref.exponential({7}, 2.0))));
+            REQUIRE(gen[i] == ref);
+        }
+
+        REQUIRE(xt::all(xt::equal(gen.distance(state), 14)));
+        gen.restore(state);
+        REQUIRE(xt::all(xt::equal(gen.random({7}), a)));
+    }
+
+    SECTION("philox_array_cumsum - random access")
+    {
+        using Data = xt::xtensor<double, 2>;
+        using Index = xt::xtensor<ptrdiff_t, 1>;
+        using Cumsum = prrng::philox_array_cumsum<Data, Index>;
+
+        xt::xtensor<uint64_t, 1> seed = std::time(0) + xt::arange<uint64_t>(11);
+        xt::xtensor<uint64_t, 1> seq = xt::zeros<uint64_t>(seed.shape());
+        std::array<size_t, 1> shape = {100};
+        prrng::alignment align(0, 5, 0, true);
+        std::vector<double> param = {2.0, 1.2, 0.0};
+
+        Cumsum walk(shape, seed, seq, prrng::weibull, param, align);
+        Cumsum jump(shape, seed, seq, prrng::weibull, param, align);
+
+        for (ptrdiff_t i : {10, 500, 50, 5000}) {
+            Index index = i * xt::ones<ptrdiff_t>(seed.shape());
+            walk.align_at(index);
+        }
+
+        Index index = 5000 * xt::ones<ptrdiff_t>(seed.shape());
+        jump.align_at(index);
+        REQUIRE(xt::all(xt::equal(jump.start(), walk.start())));
+        REQUIRE(xt::allclose(jump.data(), walk.data()));
+
+        for (double t : {10.0, 500.0, 50.0, 5000.0}) {
+            xt::xtensor<double, 1> target = t * xt::ones<double>(seed.shape());
+            walk.align(target);
+            REQUIRE(xt::all(walk.left_of_align<xt::xtensor<double, 1>>() <= target));
+            REQUIRE(xt::all(walk.right_of_align<xt::xtensor<double, 1>>() > target));
+        }
+    }
+
     SECTION("pcg32_tensor - matrix")
     {
         xt::xtensor<uint64_t, 2> seed = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}};
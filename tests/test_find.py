@@ -22,6 +22,17 @@ class Test_find(unittest.TestCase):
             i = prrng.lower_bound(a, value, i)
             self.assertTrue(np.all(np.equal(tests[:, col], i)))
 
+    def test_find_matrix_small_steps(self):
+        a = np.cumsum(0.1 + np.random.random(50000)).reshape(100, -1)
+        tests = np.random.randint(1, a.shape[1] - 1, a.shape[0])
+        i = np.zeros(a.shape[0], dtype=np.int64)
+
+        for _ in range(500):
+            tests = np.clip(tests + np.random.randint(-3, 4, tests.size), 1, a.shape[1] - 1)
+            value = 0.05 + a[np.arange(a.shape[0]), tests]
+            i = prrng.lower_bound(a, value, i)
+            self.assertTrue(np.all(np.equal(tests, i)))
+
     def test_out_of_bounds(self):
         a = np.arange(10).astype(np.float64)
         self.assertTrue(prrng.lower_bound(a, -1.0) == 0)
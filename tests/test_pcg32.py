@@ -1,3 +1,4 @@
+import concurrent.futures
 import time
 import unittest
 
@@ -98,6 +99,12 @@ class Test_pcg32_basic(unittest.TestCase):
             prrng.distribution.weibull: [(1.1, 0.1, 2.3), gen.weibull],
             prrng.distribution.gamma: [(1.1, 0.1, 2.3), gen.gamma],
             prrng.distribution.normal: [(1.1, 0.1, 2.3), gen.normal],
+            prrng.distribution.fast_normal: [(1.1, 0.1, 2.3), gen.fast_normal],
+            prrng.distribution.fast_exponential: [(0.1, 2.3), gen.fast_exponential],
+            prrng.distribution.fast_gamma: [(1.1, 0.1, 2.3), gen.fast_gamma],
+            prrng.distribution.fast_power: [(0.1, 2.3), gen.fast_power],
+            prrng.distribution.fast_pareto: [(1.1, 0.1, 2.3), gen.fast_pareto],
+            prrng.distribution.fast_weibull: [(1.1, 0.1, 2.3), gen.fast_weibull],
         }
 
         for dist, [param, func] in parameters.items():
@@ -145,6 +152,9 @@ class Test_pcg32_basic(unittest.TestCase):
             prrng.distribution.weibull: [(1.1, 0.1, 2.3), gen.cumsum_weibull],
             prrng.distribution.gamma: [(1.1, 0.1, 2.3), gen.cumsum_gamma],
             prrng.distribution.normal: [(1.1, 0.1, 2.3), gen.cumsum_normal],
+            prrng.distribution.fast_power: [(0.1, 2.3), gen.cumsum_fast_power],
+            prrng.distribution.fast_pareto: [(1.1, 0.1, 2.3), gen.cumsum_fast_pareto],
+            prrng.distribution.fast_weibull: [(1.1, 0.1, 2.3), gen.cumsum_fast_weibull],
         }
 
         for dist, [param, func] in parameters.items():
@@ -169,6 +179,30 @@ class Test_pcg32_basic(unittest.TestCase):
             self.assertAlmostEqual(a[-1], b)
             self.assertAlmostEqual(a[-1], c)
 
+    def test_fast_quantile(self):
+        """
+        The tabulated quantiles reproduce the exact sequence up to their error bound.
+        """
+        seed = int(time.time())
+        gen = prrng.pcg32(seed)
+        ref = prrng.pcg32(seed)
+        n = 10000
+
+        for k in [0.05, 0.2, 1.0, 2.5, 20.0]:
+            a = gen.fast_power([n], k)
+            b = ref.power([n], k)
+            self.assertTrue(np.all(np.abs(a - b) <= 4e-15 * b))
+
+            a = gen.fast_pareto([n], k, 1.5)
+            b = ref.pareto([n], k, 1.5)
+            self.assertTrue(np.all(np.abs(a - b) <= 4e-15 * b))
+
+            a = gen.fast_weibull([n], k, 1.5)
+            b = ref.weibull([n], k, 1.5)
+            self.assertTrue(np.all(np.abs(a - b) <= 4e-15 * b))
+
+        self.assertEqual(gen.state(), ref.state())
+
 
 class Test_pcg32_random(unittest.TestCase):
     """
@@ -1209,6 +1243,36 @@ class Test_pcg32_array(unittest.TestCase):
             np.all(np.where(mask, np.equal(state, gen.state()), np.not_equal(state, gen.state())))
         )
 
+    def test_decide_packed(self):
+        seed = np.arange(150).reshape([10, -1])
+        gen = prrng.pcg32_array(seed)
+        p = gen.random([])
+        mask = gen.random([]) < 0.3
+        state = gen.state()
+
+        decision = gen.decide(p)
+        gen.restore(state)
+        decision_masked = gen.decide_masked(p, mask)
+
+        gen.restore(state)
+        packed = gen.decide_packed(p)
+        bits = np.unpackbits(packed, count=gen.size, bitorder="little").reshape(p.shape)
+        self.assertTrue(np.all(np.equal(bits.astype(bool), decision)))
+
+        gen.restore(state)
+        packed = gen.decide_masked_packed(p, mask)
+        bits = np.unpackbits(packed, count=gen.size, bitorder="little").reshape(p.shape)
+        self.assertTrue(np.all(np.equal(bits.astype(bool), decision_masked)))
+
+        gen.restore(state)
+        index = gen.decide_indices(p)
+        self.assertTrue(np.all(np.equal(index, np.flatnonzero(decision))))
+
+        gen.restore(state)
+        index = gen.decide_masked_indices(p, mask)
+        self.assertTrue(np.all(np.equal(index, np.flatnonzero(decision_masked))))
+        self.assertTrue(np.all(gen.distance(state) == np.where(mask, 0, 1)))
+
     def test_randint(self):
         seed = np.arange(10).reshape([2, -1])
         gen = prrng.pcg32_array(seed)
@@ -1231,6 +1295,30 @@ class Test_pcg32_array(unittest.TestCase):
         self.assertTrue(np.all(a < high))
         self.assertLess((m - c) / c, 1e-3)
 
+    def test_fast_randint(self):
+        seed = np.arange(10).reshape([2, -1])
+        gen = prrng.pcg32_array(seed)
+
+        low = -500
+        high = 1000
+        a = gen.fast_randint([100000], low, high)
+        m = np.mean(a)
+        c = 0.5 * (high - 1 + low)
+        self.assertTrue(np.all(a >= low))
+        self.assertTrue(np.all(a < high))
+        self.assertLess(abs((m - c) / c), 1e-2)
+
+        high = 2**40
+        a = gen.fast_randint([1000], high)
+        self.assertTrue(np.all(a < high))
+        self.assertGreater(np.max(a), 2**39)
+
+        for i in range(seed.size):
+            gen = prrng.pcg32_array(seed)
+            ref = prrng.pcg32(seed.ravel()[i])
+            a = gen.fast_randint([20], 7)
+            self.assertTrue(np.all(a.reshape(seed.size, -1)[i] == ref.fast_randint([20], 7)))
+
     def test_cumsum(self):
         seed = np.arange(10).reshape([2, -1])
         gen = prrng.pcg32_array(seed)
@@ -1246,6 +1334,17 @@ class Test_pcg32_array(unittest.TestCase):
             prrng.distribution.weibull: [(1.1, 0.1, 2.3), gen.weibull, gen.cumsum_weibull],
             prrng.distribution.gamma: [(1.1, 0.1, 2.3), gen.gamma, gen.cumsum_gamma],
             prrng.distribution.normal: [(1.1, 0.1, 2.3), gen.normal, gen.cumsum_normal],
+            prrng.distribution.fast_power: [(0.1, 2.3), gen.fast_power, gen.cumsum_fast_power],
+            prrng.distribution.fast_pareto: [
+                (1.1, 0.1, 2.3),
+                gen.fast_pareto,
+                gen.cumsum_fast_pareto,
+            ],
+            prrng.distribution.fast_weibull: [
+                (1.1, 0.1, 2.3),
+                gen.fast_weibull,
+                gen.cumsum_fast_weibull,
+            ],
         }
 
         for dist, [param, draw, cumsum] in parameters.items():
@@ -1267,6 +1366,98 @@ class Test_pcg32_array(unittest.TestCase):
 
             self.assertTrue(np.allclose(a, b))
 
+    def test_out(self):
+        seed = np.arange(10).reshape([2, -1])
+        gen = prrng.pcg32_array(seed)
+        state = gen.state()
+        n = 100 * np.ones(state.shape, dtype=np.uint64)
+
+        draws = [
+            [gen.random, ()],
+            [gen.delta, (2.3,)],
+            [gen.exponential, (2.3,)],
+            [gen.power, (2.3,)],
+            [gen.gamma, (1.1, 2.3)],
+            [gen.pareto, (1.1, 2.3)],
+            [gen.weibull, (1.1, 2.3)],
+            [gen.normal, (1.1, 2.3)],
+            [gen.fast_normal, (1.1, 2.3)],
+            [gen.fast_exponential, (2.3,)],
+            [gen.fast_gamma, (1.1, 2.3)],
+            [gen.fast_power, (2.3,)],
+            [gen.fast_pareto, (1.1, 2.3)],
+            [gen.fast_weibull, (1.1, 2.3)],
+            [gen.cumsum_random, ()],
+            [gen.cumsum_exponential, (2.3,)],
+            [gen.cumsum_power, (2.3,)],
+            [gen.cumsum_gamma, (1.1, 2.3)],
+            [gen.cumsum_pareto, (1.1, 2.3)],
+            [gen.cumsum_weibull, (1.1, 2.3)],
+            [gen.cumsum_normal, (1.1, 2.3)],
+            [gen.cumsum_fast_normal, (1.1, 2.3)],
+            [gen.cumsum_fast_exponential, (2.3,)],
+            [gen.cumsum_fast_gamma, (1.1, 2.3)],
+            [gen.cumsum_fast_power, (2.3,)],
+            [gen.cumsum_fast_pareto, (1.1, 2.3)],
+            [gen.cumsum_fast_weibull, (1.1, 2.3)],
+        ]
+
+        for draw, param in draws:
+            arg = n if draw.__name__.startswith("cumsum") else [4, 5]
+            gen.restore(state)
+            a = draw(arg, *param)
+            gen.restore(state)
+            out = np.empty_like(a)
+            ret = draw(arg, *param, out=out)
+            self.assertIsNone(ret)
+            self.assertTrue(np.allclose(a, out, equal_nan=True))
+            self.assertEqual(np.all(np.equal(state, gen.state())), draw == gen.delta)
+
+    def test_out_strided(self):
+        """
+        Output to an existing array: arrays that are not C-contiguous are rejected.
+        """
+        seed = np.arange(10).reshape([2, -1])
+        gen = prrng.pcg32_array(seed)
+        state = gen.state()
+        n = 100 * np.ones(state.shape, dtype=np.uint64)
+
+        draws = [
+            [gen.random, (), [4, 5]],
+            [gen.exponential, (2.3,), [4, 5]],
+            [gen.fast_normal, (1.1, 2.3), [4, 5]],
+            [gen.cumsum_random, (), n],
+        ]
+
+        for draw, param, arg in draws:
+            shape = draw(arg, *param).shape
+            views = [
+                np.empty(shape[:-1] + (2 * shape[-1],))[..., ::2],
+                np.empty(shape[::-1]).T,
+                np.empty(shape)[..., ::-1],
+            ]
+            for out in views:
+                gen.restore(state)
+                with self.assertRaises((RuntimeError, TypeError)):
+                    draw(arg, *param, out=out)
+                self.assertTrue(np.all(np.equal(state, gen.state())))
+
+    def test_threads(self):
+        """
+        Independent generators used from different threads give the same result as in serial.
+        """
+        seeds = [np.arange(i, i + 100).reshape([10, 10]) for i in range(4)]
+        serial = [prrng.pcg32_array(seed).normal([1000], 0, 1) for seed in seeds]
+
+        def work(seed):
+            return prrng.pcg32_array(seed).normal([1000], 0, 1)
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+            threaded = list(executor.map(work, seeds))
+
+        for a, b in zip(serial, threaded):
+            self.assertTrue(np.all(np.equal(a, b)))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -390,6 +390,402 @@ class Test_pcg32_cumsum(unittest.TestCase):
             self.assertTrue(np.allclose(x0, chunk.left_of_align))
             self.assertTrue(np.allclose(chunk.data, check))
 
+    def test_array_random_align_at_buffer(self):
+        """
+        Array: random, align with the index already at the margin (within the buffer).
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+        ref = prrng.pcg32_array(initstate, seq)
+        xref = np.cumsum(ref.random([10000]), axis=1)
+
+        n = 100
+        margin = 15
+        align = prrng.alignment(buffer=margin, margin=margin, strict=True)
+        chunk = prrng.pcg32_array_cumsum([n], initstate, seq, prrng.random, [1, 0], align)
+
+        index = 3 * n * np.ones(N, dtype=int)
+        for _ in range(2):
+            chunk.align_at(index)
+            self.assertTrue(np.all(chunk.start == index - margin))
+            self.assertTrue(np.allclose(xref[np.arange(N), index], chunk.left_of_align))
+            self.assertTrue(np.allclose(xref[:, 3 * n - margin : 4 * n - margin], chunk.data))
+
+    def test_array_random_align_slack(self):
+        """
+        Array: random, storing the chunks with slack gives the same chunks.
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        margin = 15
+        args = [[n], initstate, seq, prrng.random, [1, 0]]
+        chunk = prrng.pcg32_array_cumsum(*args, prrng.alignment(margin=margin))
+        other = prrng.pcg32_array_cumsum(*args, prrng.alignment(margin=margin, slack=3 * n))
+
+        target = np.zeros(N)
+        for _ in range(50):
+            target += 3 + np.arange(N)
+            chunk.align(target)
+            other.align(target)
+            self.assertTrue(np.all(chunk.start == other.start))
+            self.assertTrue(np.all(chunk.chunk_index_at_align == other.chunk_index_at_align))
+            self.assertTrue(np.allclose(chunk.left_of_align, other.left_of_align))
+            self.assertTrue(np.allclose(chunk.data, other.data))
+
+        chunk += 1
+        other += 1
+        self.assertTrue(np.allclose(chunk.data, other.data))
+
+    def test_array_random_slack_construct(self):
+        """
+        Array: random, storing the chunks with slack gives the same chunks directly after
+        construction (without aligning first).
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        args = [[n], initstate, seq, prrng.random, [1, 0]]
+        chunk = prrng.pcg32_array_cumsum(*args, prrng.alignment())
+        other = prrng.pcg32_array_cumsum(*args, prrng.alignment(slack=3 * n))
+        self.assertTrue(np.allclose(chunk.data, other.data))
+
+        other = prrng.pcg32_array_cumsum(*args, prrng.alignment(slack=3 * n))
+        chunk += 1
+        other += 1
+        self.assertTrue(np.allclose(chunk.data, other.data))
+
+    def test_array_random_align_lazy(self):
+        """
+        Array: random, deferring the first chunk gives the same chunks.
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        margin = 15
+        args = [[n], initstate, seq, prrng.random, [1, 0]]
+        chunk = prrng.pcg32_array_cumsum(*args, prrng.alignment(margin=margin))
+        other = prrng.pcg32_array_cumsum(*args, prrng.alignment(margin=margin, lazy=True))
+
+        other.align(np.array([3]), np.array([10.0]))
+        chunk.align(np.array([3]), np.array([10.0]))
+
+        target = np.zeros(N)
+        for _ in range(50):
+            target += 3 + np.arange(N)
+            chunk.align(target)
+            other.align(target)
+            self.assertTrue(np.all(chunk.start == other.start))
+            self.assertTrue(np.all(chunk.chunk_index_at_align == other.chunk_index_at_align))
+            self.assertTrue(np.allclose(chunk.data, other.data))
+
+    def test_prefetch(self):
+        """
+        Chunked storage: prefetching the next chunk gives the same chunks.
+        """
+
+        n = 1000
+        args = [[n], seed, 0, prrng.exponential, [1.0, 0.0], prrng.alignment(margin=10)]
+        ref = prrng.pcg32_cumsum(*args)
+        chunk = prrng.pcg32_cumsum(*args)
+        chunk.set_prefetch(True)
+        self.assertTrue(chunk.prefetch)
+
+        target = 0.0
+        for i in range(200):
+            target += 1 + i % 7
+            chunk.align(target)
+            ref.align(target)
+            self.assertEqual(chunk.start, ref.start)
+            self.assertEqual(chunk.index_at_align, ref.index_at_align)
+            self.assertTrue(np.allclose(chunk.data, ref.data))
+
+        chunk.next()
+        ref.next()
+        self.assertTrue(np.allclose(chunk.data, ref.data))
+
+    def test_array_partitioned(self):
+        """
+        Array: partitions of rows behave as the global array, also when moving rows.
+        """
+
+        N = 10
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        args = [prrng.random, [1, 0], prrng.alignment(margin=15)]
+        ref = prrng.pcg32_array_cumsum([n], initstate, seq, *args)
+        a = prrng.pcg32_array_partitioned_cumsum([n], initstate[:6], seq[:6], 0, *args)
+        b = prrng.pcg32_array_partitioned_cumsum([n], initstate[6:], seq[6:], 6, *args)
+
+        def check(part):
+            rows = part.rows
+            self.assertTrue(np.all(part.start == ref.start[rows]))
+            self.assertTrue(np.allclose(part.data, ref.data[rows, :]))
+
+        for t in [500.0, 5000.0]:
+            ref.align(t * np.ones(N))
+            a.align(t * np.ones(len(a.rows)))
+            b.align(t * np.ones(len(b.rows)))
+            check(a)
+            check(b)
+
+        blob = a.serialize_rows([1, 4])
+        a.erase_rows([1, 4])
+        b.insert_rows(blob)
+        self.assertEqual(a.rows, [0, 2, 3, 5])
+        self.assertEqual(b.rows, [1, 4, 6, 7, 8, 9])
+
+        for t in [50.0, 20000.0]:
+            ref.align(t * np.ones(N))
+            a.align(t * np.ones(len(a.rows)))
+            b.align(t * np.ones(len(b.rows)))
+            check(a)
+            check(b)
+
+        with self.assertRaises(RuntimeError):
+            a.erase_rows([0, 4])
+
+        with self.assertRaises(RuntimeError):
+            a.serialize_rows([9])
+
+        self.assertEqual(a.rows, [0, 2, 3, 5])
+        check(a)
+
+    def test_array_random_align_subset(self):
+        """
+        Array: aligning a subset of items is the same as aligning all items.
+        """
+
+        N = 20
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        args = [[n], initstate, seq, prrng.random, [1, 0]]
+        chunk = prrng.pcg32_array_cumsum(*args)
+        other = prrng.pcg32_array_cumsum(*args)
+
+        target = np.zeros(N)
+        for _ in range(50):
+            index = np.random.choice(N, size=4, replace=False)
+            target[index] += np.random.uniform(0, 3 * n, size=index.size)
+            chunk.align(index, target[index])
+            other.align(target)
+            self.assertTrue(np.all(chunk.start == other.start))
+            self.assertTrue(np.all(chunk.chunk_index_at_align == other.chunk_index_at_align))
+            self.assertTrue(np.allclose(chunk.data, other.data))
+
+    def test_array_serialize(self):
+        """
+        Array: restore from a binary blob, with or without the chunk data.
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        args = [[n], initstate, seq, prrng.exponential, [1]]
+        chunk = prrng.pcg32_array_cumsum(*args)
+        chunk.align(50 * n * np.ones(N))
+
+        for with_data in [True, False]:
+            blob = chunk.serialize(with_data)
+            other = prrng.pcg32_array_cumsum(*args)
+            self.assertEqual(other.deserialize(blob), len(blob))
+            self.assertTrue(np.all(chunk.start == other.start))
+            self.assertTrue(np.all(chunk.index_at_align == other.index_at_align))
+            self.assertTrue(np.allclose(chunk.data, other.data))
+
+            buffer = np.frombuffer(blob, dtype=np.uint8)
+            other = prrng.pcg32_array_cumsum(*args)
+            other.deserialize(buffer)
+            other.align(80 * n * np.ones(N))
+            ref = prrng.pcg32_array_cumsum(*args)
+            ref.align(80 * n * np.ones(N))
+            self.assertTrue(np.all(ref.start == other.start))
+            self.assertTrue(np.allclose(ref.data, other.data))
+
+            # the blob is read as raw bytes
+            strided = np.repeat(buffer, 2)[::2]
+            self.assertTrue(np.all(strided == buffer))
+            with self.assertRaises(RuntimeError):
+                other.deserialize(strided)
+            with self.assertRaises(RuntimeError):
+                other.deserialize(memoryview(strided))
+            with self.assertRaises(RuntimeError):
+                other.deserialize(buffer.astype(np.uint16))
+
+    def test_statistics(self):
+        """
+        Statistics of the moves of the chunk.
+        """
+
+        n = 100
+        chunk = prrng.pcg32_cumsum([n], seed, distribution=prrng.exponential, parameters=[1])
+
+        if chunk.statistics().drawn == 0:
+            self.skipTest("statistics are not collected (build with -DUSE_STATISTICS=1)")
+
+        self.assertEqual(chunk.statistics().drawn, n)
+
+        chunk.reset_statistics()
+        chunk.align(50 * n)
+        stats = chunk.statistics()
+        self.assertEqual(stats.aligns, 1)
+        self.assertGreater(stats.summed, 0)
+        self.assertGreater(stats.recursions, 0)
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+        chunk = prrng.pcg32_array_cumsum([n], initstate, seq, prrng.exponential, [1])
+        self.assertEqual(chunk.statistics().drawn, N * n)
+        self.assertEqual(chunk.statistics(0).drawn, n)
+
+        chunk.reset_statistics()
+        chunk.align(50 * n * np.ones(N))
+        self.assertEqual(chunk.statistics().aligns, N)
+        self.assertEqual(chunk.statistics(N - 1).aligns, 1)
+
+    def test_resize_adaptation(self):
+        """
+        Resizing the chunk (by hand or adapted to the target) does not change the sequence.
+        """
+
+        n = 100
+        ref = prrng.pcg32_cumsum([100000], seed, distribution=prrng.exponential, parameters=[1])
+        chunk = prrng.pcg32_cumsum([n], seed, distribution=prrng.exponential, parameters=[1])
+
+        chunk.resize(3 * n)
+        self.assertEqual(chunk.size, 3 * n)
+        self.assertTrue(np.allclose(chunk.data, ref.data[: 3 * n]))
+
+        chunk.set_adaptation(prrng.adaptation(min_size=16, max_size=1024))
+        target = 0.0
+
+        for _ in range(20):
+            target += 500.0
+            chunk.align(target)
+            i = chunk.start
+            self.assertTrue(np.allclose(chunk.data, ref.data[i : i + chunk.size]))
+            self.assertEqual(chunk.index_at_align, np.argmax(ref.data > target) - 1)
+
+        self.assertEqual(chunk.size, 1024)
+        self.assertGreater(chunk.velocity, 400)
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+        ref = prrng.pcg32_array_cumsum([10000], initstate, seq, prrng.exponential, [1])
+        chunk = prrng.pcg32_array_cumsum([n], initstate, seq, prrng.exponential, [1])
+        chunk.resize(2 * n)
+        self.assertEqual(chunk.chunk_size, 2 * n)
+        self.assertTrue(np.allclose(chunk.data, ref.data[:, : 2 * n]))
+
+    def test_ragged(self):
+        """
+        Array with a chunk of different size per generator.
+        """
+
+        N = 4
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+        sizes = np.array([100, 5000, 20, 300], dtype=np.uintp)
+        align = prrng.alignment(margin=5, strict=True)
+        chunk = prrng.pcg32_array_ragged_cumsum(
+            sizes, initstate, seq, prrng.exponential, [1], align
+        )
+        self.assertEqual(chunk.offsets[-1], np.sum(sizes))
+        self.assertEqual(chunk.data.size, np.sum(sizes))
+
+        ref = [
+            prrng.pcg32_cumsum([n], s, q, prrng.exponential, [1], align)
+            for n, s, q in zip(sizes, initstate, seq)
+        ]
+
+        for t in [10.0, 1000.0, 50.0, 5000.0]:
+            chunk.align(t * np.ones(N))
+            for i in range(N):
+                ref[i].align(t)
+                self.assertEqual(chunk.chunk_size(i), sizes[i])
+                self.assertEqual(chunk.start[i], ref[i].start)
+                self.assertEqual(chunk.index_at_align[i], ref[i].index_at_align)
+                self.assertTrue(np.allclose(chunk.chunk(i), ref[i].data))
+
+            self.assertTrue(np.all(chunk.left_of_align <= t))
+            self.assertTrue(np.all(chunk.right_of_align > t))
+
+    def test_multi(self):
+        """
+        Array with several channels per generator that share the generator and the chunk.
+        """
+
+        N = 4
+        K = 3
+        n = 500
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+        align = prrng.alignment(margin=5, strict=True)
+        chunk = prrng.pcg32_array_multi_cumsum(n, K, initstate, seq, prrng.exponential, [1], align)
+        self.assertEqual(chunk.data.shape, (N, n, K))
+
+        ref = []
+        for s, q in zip(initstate, seq):
+            gen = prrng.pcg32(s, q)
+            ref.append(np.cumsum(gen.exponential([20000, K], 1), axis=0))
+
+        for t in [10.0, 1000.0, 50.0, 5000.0]:
+            target = t * np.ones((N, K))
+            target[:, 1] += 1.0
+            chunk.align(target)
+            index = chunk.index_at_align
+            for i in range(N):
+                start = chunk.start[i, 0]
+                self.assertTrue(np.all(chunk.start[i] == start))
+                self.assertEqual(np.min(chunk.chunk_index_at_align[i]), 5)
+                self.assertTrue(np.allclose(chunk.data[i], ref[i][start : start + n]))
+                for c in range(K):
+                    self.assertLess(ref[i][index[i, c], c], target[i, c])
+                    self.assertGreaterEqual(ref[i][index[i, c] + 1, c], target[i, c])
+
+            self.assertTrue(np.all(chunk.left_of_align < target))
+            self.assertTrue(np.all(chunk.right_of_align >= target))
+
+        target = 10 * np.ones((N, K))
+        target[0, 2] = 2000
+        with self.assertRaises(RuntimeError):
+            chunk.align(target)
+
+    def test_array_data_view(self):
+        """
+        Array: the chunk is not copied to Python.
+        """
+
+        N = 6
+        initstate = seed + np.arange(N, dtype=np.uint64)
+        seq = np.zeros_like(initstate)
+
+        n = 100
+        chunk = prrng.pcg32_array_cumsum([n], initstate, seq, prrng.random, [1, 0])
+        data = chunk.data
+        chunk.align(5 * n * np.ones(N))
+        self.assertTrue(np.shares_memory(data, chunk.data))
+        self.assertTrue(np.all(np.equal(data, chunk.data)))
+
     def test_array_delta(self):
         """
         Array: delta.
@@ -0,0 +1,515 @@
+/**
+ * Validation of the distributions and of the fast kernels, with the throughput of each kernel:
+ *
+ * -   Kolmogorov-Smirnov and chi-square tests of a sample of each distribution against the `cdf`
+ *     of prrng::exponential_distribution etc.
+ *     (also for the sum of skipped random numbers, see prrng::alignment::sample_skip).
+ *
+ * -   Bit-exactness of drawing an array of generators (in lock-step lanes,
+ *     see prrng::detail::pcg32_lanes()) against drawing each generator in turn.
+ *
+ * -   Agreement of the chunk of prrng::pcg32_cumsum (after aligning far away)
+ *     with prrng::GeneratorBase::cumsum_exponential() etc.
+ *
+ * Usage: `validate [n]`, with `n` the sample size (default 1000000).
+ * The throughput is in millions of random numbers per second.
+ * The exit status is non-zero if any check fails.
+ */
+
+#include <algorithm>
+#include <boost/math/special_functions/gamma.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <prrng.h>
+#include <vector>
+#include <xtensor/xtensor.hpp>
+#include <xtensor/xview.hpp>
+
+#define SEED 42
+
+using Data1 = xt::xtensor<double, 1>;
+using Data2 = xt::xtensor<double, 2>;
+using clock_type = std::chrono::steady_clock;
+
+/// p-value below which a statistical test fails (a false alarm is very unlikely).
+static constexpr double pmin = 1e-6;
+
+/// Number of failed checks.
+static size_t failures = 0;
+
+static double seconds_since(clock_type::time_point t0)
+{
+    return std::chrono::duration<double>(clock_type::now() - t0).count();
+}
+
+static void report(const char* check, const char* kernel, double rate, const char* result, bool ok)
+{
+    std::printf("%-8s %-20s %10.1f  %-36s %s\n", check, kernel, rate, result, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+/**
+ * p-value of the Kolmogorov-Smirnov test of a sample of the uniform distribution.
+ *
+ * @param u Sample (sorted in place).
+ * @return p-value (asymptotic Kolmogorov distribution).
+ */
+static double ks_pvalue(std::vector<double>& u)
+{
+    std::sort(u.begin(), u.end());
+    double n = static_cast<double>(u.size());
+    double d = 0.0;
+
+    for (size_t i = 0; i < u.size(); ++i) {
+        double k = static_cast<double>(i);
+        d = std::max({d, (k + 1.0) / n - u[i], u[i] - k / n});
+    }
+
+    double lambda = (std::sqrt(n) + 0.12 + 0.11 / std::sqrt(n)) * d;
+
+    if (lambda < 0.2) {
+        return 1.0;
+    }
+
+    double p = 0.0;
+
+    for (int j = 1; j <= 100; ++j) {
+        double term = 2.0 * std::exp(-2.0 * j * j * lambda * lambda);
+        p += j % 2 == 1 ? term : -term;
+    }
+
+    return std::min(std::max(p, 0.0), 1.0);
+}
+
+/**
+ * p-value of the chi-square test of a sample of the uniform distribution.
+ *
+ * @param u Sample.
+ * @param bins Number of bins of equal probability.
+ * @return p-value.
+ */
+static double chi2_pvalue(const std::vector<double>& u, size_t bins)
+{
+    std::vector<double> count(bins, 0.0);
+
+    for (double x : u) {
+        size_t b = static_cast<size_t>(x * static_cast<double>(bins));
+        count[std::min(b, bins - 1)] += 1.0;
+    }
+
+    double expected = static_cast<double>(u.size()) / static_cast<double>(bins);
+    double chi2 = 0.0;
+
+    for (double c : count) {
+        chi2 += (c - expected) * (c - expected) / expected;
+    }
+
+    return boost::math::gamma_q(0.5 * static_cast<double>(bins - 1), 0.5 * chi2);
+}
+
+/**
+ * Test a sample against a cumulative density (by the probability integral transform).
+ *
+ * @param check Name of the check.
+ * @param kernel Name of the kernel.
+ * @param rate Throughput of the kernel.
+ * @param x Sample.
+ * @param cdf Cumulative density, called as `cdf(x)`.
+ */
+template <class Cdf>
+static void check_sample(
+    const char* check,
+    const char* kernel,
+    double rate,
+    const Data1& x,
+    const Cdf& cdf
+)
+{
+    Data1 p = cdf(x);
+    std::vector<double> u(p.begin(), p.end());
+    double chi2 = chi2_pvalue(u, 100);
+    double ks = ks_pvalue(u);
+    char result[64];
+    std::snprintf(result, sizeof(result), "KS p = %.1e, chi2 p = %.1e", ks, chi2);
+    report(check, kernel, rate, result, ks > pmin && chi2 > pmin);
+}
+
+/**
+ * Draw a sample of a distribution and test it against its cumulative density.
+ *
+ * @param kernel Name of the kernel.
+ * @param n Sample size.
+ * @param draw Draw the sample, called as `draw(generator, shape)`.
+ * @param cdf Cumulative density, called as `cdf(x)`.
+ */
+template <class Draw, class Cdf>
+static void check_distribution(const char* kernel, size_t n, const Draw& draw, const Cdf& cdf)
+{
+    prrng::pcg32 gen(SEED);
+    std::array<size_t, 1> shape = {n};
+    auto t0 = clock_type::now();
+    Data1 x = draw(gen, shape);
+    double rate = static_cast<double>(n) / seconds_since(t0) * 1e-6;
+    check_sample("cdf", kernel, rate, x, cdf);
+}
+
+/**
+ * Check that drawing an array of generators (in lock-step lanes) is bit-exact with drawing each
+ * generator in turn.
+ *
+ * @param kernel Name of the kernel.
+ * @param n Total number of random numbers.
+ * @param draw Draw, called as `draw(generator, shape)` for arrays and scalar generators.
+ */
+template <class Draw>
+static void check_lanes(const char* kernel, size_t n, const Draw& draw)
+{
+    size_t ngen = 1000;
+    size_t m = std::max(n / ngen, size_t(1));
+    double total = static_cast<double>(ngen * m) * 1e-6;
+    xt::xtensor<uint64_t, 1> seeds = SEED + xt::arange<uint64_t>(ngen);
+    std::array<size_t, 1> shape = {m};
+
+    prrng::pcg32_array array(seeds);
+    auto t0 = clock_type::now();
+    Data2 a = draw(array, shape);
+    double rate = total / seconds_since(t0);
+
+    prrng::pcg32_soa_array soa(seeds);
+    t0 = clock_type::now();
+    Data2 b = draw(soa, shape);
+    double soa_rate = total / seconds_since(t0);
+
+    bool equal = true;
+    xt::xtensor<uint64_t, 1> state = xt::empty<uint64_t>({ngen});
+    double scalar = 0.0;
+
+    for (size_t i = 0; i < ngen; ++i) {
+        prrng::pcg32 gen(seeds(i));
+        t0 = clock_type::now();
+        Data1 ref = draw(gen, shape);
+        scalar += seconds_since(t0);
+        state(i) = gen.state();
+        equal = equal && xt::all(xt::equal(xt::view(a, i), ref));
+        equal = equal && xt::all(xt::equal(xt::view(b, i), ref));
+    }
+
+    equal = equal && xt::all(xt::equal(array.state(), state));
+    equal = equal && xt::all(xt::equal(soa.state(), state));
+
+    char result[64];
+    std::snprintf(result, sizeof(result), "scalar %.1f, soa %.1f", total / scalar, soa_rate);
+    report("lanes", kernel, rate, result, equal);
+}
+
+/**
+ * Check that the chunk of prrng::pcg32_cumsum agrees with the cumsum of the generator,
+ * also after skipping far ahead (using the exact sum of the skipped random numbers).
+ *
+ * @param kernel Name of the kernel.
+ * @param n Typical number of random numbers to skip.
+ * @param distribution Distribution of the chunk.
+ * @param param Parameters of the distribution (no offset).
+ * @param sum Cumsum of the generator, called as `sum(generator, n, exact)`.
+ */
+template <class Sum>
+static void check_cumsum(
+    const char* kernel,
+    size_t n,
+    prrng::distribution distribution,
+    const std::vector<double>& param,
+    const Sum& sum
+)
+{
+    std::array<size_t, 1> shape = {1000};
+    prrng::pcg32_cumsum<Data1> chunk(shape, SEED, PRRNG_PCG32_INITSEQ, distribution, param);
+    double mean = chunk.data()(shape[0] - 1) / static_cast<double>(shape[0]);
+    double error = 0.0;
+    double drawn = 0.0;
+    double seconds = 0.0;
+
+    for (double factor : {0.5, 0.01, 1.0, 0.2}) {
+        chunk.align(factor * static_cast<double>(n) * mean);
+        size_t m = static_cast<size_t>(chunk.start() + 1);
+        prrng::pcg32 gen(SEED);
+        auto t0 = clock_type::now();
+        double ref = sum(gen, m, true);
+        seconds += seconds_since(t0);
+        drawn += static_cast<double>(m);
+        error = std::max(error, std::abs(chunk.data()(0) - ref) / std::abs(ref));
+    }
+
+    char result[64];
+    std::snprintf(result, sizeof(result), "relative error %.1e", error);
+    report("cumsum", kernel, drawn / seconds * 1e-6, result, error < 1e-9);
+}
+
+/**
+ * Check that the sampled sum of skipped random numbers follows the law of the sum.
+ *
+ * @param kernel Name of the kernel.
+ * @param n Sample size.
+ * @param m Number of random numbers per sum.
+ * @param sum Cumsum of the generator, called as `sum(generator, m, exact)`.
+ * @param cdf Cumulative density of the sum, called as `cdf(x)`.
+ */
+template <class Sum, class Cdf>
+static void check_skip(const char* kernel, size_t n, size_t m, const Sum& sum, const Cdf& cdf)
+{
+    prrng::pcg32 gen(SEED);
+    Data1 x = xt::empty<double>({n});
+    auto t0 = clock_type::now();
+
+    for (size_t i = 0; i < n; ++i) {
+        x(i) = sum(gen, m, false);
+    }
+
+    double rate = static_cast<double>(n * m) / seconds_since(t0) * 1e-6;
+    check_sample("skip", kernel, rate, x, cdf);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t n = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 1000000;
+
+    std::printf("%-8s %-20s %10s  %-36s %s\n", "check", "kernel", "Mnum/s", "result", "status");
+
+    // distributions against their cumulative density
+
+    check_distribution(
+        "random",
+        n,
+        [](auto& gen, const auto& shape) { return gen.random(shape); },
+        [](const Data1& x) { return Data1(x); }
+    );
+    check_distribution(
+        "exponential",
+        n,
+        [](auto& gen, const auto& shape) { return gen.exponential(shape, 2.0); },
+        [](const Data1& x) { return prrng::exponential_distribution(2.0).cdf(x); }
+    );
+    check_distribution(
+        "fast_exponential",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_exponential(shape, 2.0); },
+        [](const Data1& x) { return prrng::exponential_distribution(2.0).cdf(x); }
+    );
+    check_distribution(
+        "power",
+        n,
+        [](auto& gen, const auto& shape) { return gen.power(shape, 2.0); },
+        [](const Data1& x) { return prrng::power_distribution(2.0).cdf(x); }
+    );
+    check_distribution(
+        "fast_power",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_power(shape, 2.0); },
+        [](const Data1& x) { return prrng::power_distribution(2.0).cdf(x); }
+    );
+    check_distribution(
+        "gamma",
+        n,
+        [](auto& gen, const auto& shape) { return gen.gamma(shape, 2.5, 1.5); },
+        [](const Data1& x) { return prrng::gamma_distribution(2.5, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "fast_gamma",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_gamma(shape, 2.5, 1.5); },
+        [](const Data1& x) { return prrng::gamma_distribution(2.5, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "fast_gamma (k < 1)",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_gamma(shape, 0.5, 1.5); },
+        [](const Data1& x) { return prrng::gamma_distribution(0.5, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "pareto",
+        n,
+        [](auto& gen, const auto& shape) { return gen.pareto(shape, 2.0, 1.5); },
+        [](const Data1& x) { return prrng::pareto_distribution(2.0, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "fast_pareto",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_pareto(shape, 2.0, 1.5); },
+        [](const Data1& x) { return prrng::pareto_distribution(2.0, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "weibull",
+        n,
+        [](auto& gen, const auto& shape) { return gen.weibull(shape, 2.0, 1.5); },
+        [](const Data1& x) { return prrng::weibull_distribution(2.0, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "fast_weibull",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_weibull(shape, 2.0, 1.5); },
+        [](const Data1& x) { return prrng::weibull_distribution(2.0, 1.5).cdf(x); }
+    );
+    check_distribution(
+        "normal",
+        n,
+        [](auto& gen, const auto& shape) { return gen.normal(shape, 1.0, 2.0); },
+        [](const Data1& x) { return prrng::normal_distribution(1.0, 2.0).cdf(x); }
+    );
+    check_distribution(
+        "fast_normal",
+        n,
+        [](auto& gen, const auto& shape) { return gen.fast_normal(shape, 1.0, 2.0); },
+        [](const Data1& x) { return prrng::normal_distribution(1.0, 2.0).cdf(x); }
+    );
+
+    // arrays of generators (lock-step lanes) against scalar generators
+
+    check_lanes("random", n, [](auto& gen, const auto& shape) { return gen.random(shape); });
+    check_lanes("exponential", n, [](auto& gen, const auto& shape) {
+        return gen.exponential(shape, 2.0);
+    });
+    check_lanes("weibull", n, [](auto& gen, const auto& shape) {
+        return gen.weibull(shape, 2.0, 1.5);
+    });
+    check_lanes("fast_normal", n, [](auto& gen, const auto& shape) {
+        return gen.fast_normal(shape, 1.0, 2.0);
+    });
+
+    // chunks against the cumsum of the generator (with (nearly) only positive increments)
+
+    check_cumsum("random", n, prrng::random, {1.0}, [](prrng::pcg32& gen, size_t m, bool) {
+        return gen.cumsum_random(m);
+    });
+    check_cumsum(
+        "exponential",
+        n,
+        prrng::exponential,
+        {2.0},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_exponential(m, 2.0, exact);
+        }
+    );
+    check_cumsum(
+        "fast_exponential",
+        n,
+        prrng::fast_exponential,
+        {2.0},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_fast_exponential(m, 2.0, exact);
+        }
+    );
+    check_cumsum("power", n, prrng::power, {2.0}, [](prrng::pcg32& gen, size_t m, bool) {
+        return gen.cumsum_power(m, 2.0);
+    });
+    check_cumsum(
+        "gamma",
+        n,
+        prrng::gamma,
+        {2.5, 1.5},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_gamma(m, 2.5, 1.5, exact);
+        }
+    );
+    check_cumsum(
+        "fast_gamma",
+        n,
+        prrng::fast_gamma,
+        {2.5, 1.5},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_fast_gamma(m, 2.5, 1.5, exact);
+        }
+    );
+    check_cumsum("pareto", n, prrng::pareto, {2.0, 1.5}, [](prrng::pcg32& gen, size_t m, bool) {
+        return gen.cumsum_pareto(m, 2.0, 1.5);
+    });
+    check_cumsum("weibull", n, prrng::weibull, {2.0, 1.5}, [](prrng::pcg32& gen, size_t m, bool) {
+        return gen.cumsum_weibull(m, 2.0, 1.5);
+    });
+    check_cumsum(
+        "normal",
+        n,
+        prrng::normal,
+        {1.0, 0.2},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_normal(m, 1.0, 0.2, exact);
+        }
+    );
+    check_cumsum(
+        "fast_normal",
+        n,
+        prrng::fast_normal,
+        {1.0, 0.2},
+        [](prrng::pcg32& gen, size_t m, bool exact) {
+            return gen.cumsum_fast_normal(m, 1.0, 0.2, exact);
+        }
+    );
+
+    // sampled sum of skipped random numbers against the law of the sum
+
+    size_t m = 100;
+    size_t nsum = std::max(n / m, size_t(100));
+    double dm = static_cast<double>(m);
+
+    check_skip(
+        "exponential",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_exponential(k, 2.0, exact);
+        },
+        [dm](const Data1& x) { return prrng::gamma_distribution(dm, 2.0).cdf(x); }
+    );
+    check_skip(
+        "fast_exponential",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_fast_exponential(k, 2.0, exact);
+        },
+        [dm](const Data1& x) { return prrng::gamma_distribution(dm, 2.0).cdf(x); }
+    );
+    check_skip(
+        "gamma",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_gamma(k, 2.5, 1.5, exact);
+        },
+        [dm](const Data1& x) { return prrng::gamma_distribution(2.5 * dm, 1.5).cdf(x); }
+    );
+    check_skip(
+        "fast_gamma",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_fast_gamma(k, 2.5, 1.5, exact);
+        },
+        [dm](const Data1& x) { return prrng::gamma_distribution(2.5 * dm, 1.5).cdf(x); }
+    );
+    check_skip(
+        "normal",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_normal(k, 1.0, 2.0, exact);
+        },
+        [dm](const Data1& x) {
+            return prrng::normal_distribution(dm, 2.0 * std::sqrt(dm)).cdf(x);
+        }
+    );
+    check_skip(
+        "fast_normal",
+        nsum,
+        m,
+        [](prrng::pcg32& gen, size_t k, bool exact) {
+            return gen.cumsum_fast_normal(k, 1.0, 2.0, exact);
+        },
+        [dm](const Data1& x) {
+            return prrng::normal_distribution(dm, 2.0 * std::sqrt(dm)).cdf(x);
+        }
+    );
+
+    std::printf("%zu check(s) failed\n", failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}